@@ -58,14 +58,32 @@ namespace phylanx { namespace execution_tree {
         {
         }
 
+        // a copy of an annotation describes a different value, it gets a
+        // new version
+        annotation(annotation const& rhs)
+          : data_(rhs.data_)
+        {
+        }
+        annotation(annotation&& rhs) = default;
+
+        annotation& operator=(annotation const& rhs)
+        {
+            data_ = rhs.data_;
+            version_ = next_version();
+            return *this;
+        }
+        annotation& operator=(annotation&& rhs) = default;
+
         annotation& operator=(ir::range const& rhs)
         {
             data_ = rhs;
+            version_ = next_version();
             return *this;
         }
         annotation& operator=(ir::range&& rhs)
         {
             data_ = std::move(rhs);
+            version_ = next_version();
             return *this;
         }
 
@@ -121,8 +139,25 @@ namespace phylanx { namespace execution_tree {
         PHYLANX_EXPORT void increment_generation(
             std::string const& name, std::string const& codename);
 
+        // The version identifies the value this annotation is attached to on
+        // this locality. It is unique for each annotation object and changes
+        // whenever the annotation is modified or the annotated value is
+        // stored to (see update_version). It is not part of the comparison
+        // and is not serialized.
+        std::int64_t version() const
+        {
+            return version_;
+        }
+        void update_version()
+        {
+            version_ = next_version();
+        }
+
     private:
+        PHYLANX_EXPORT static std::int64_t next_version();
+
         ir::range data_;
+        std::int64_t version_ = next_version();
 
         friend class hpx::serialization::access;
 
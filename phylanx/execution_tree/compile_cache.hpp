@@ -0,0 +1,71 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_EXECUTION_TREE_COMPILE_CACHE_2020_OCT_12_0245PM)
+#define PHYLANX_EXECUTION_TREE_COMPILE_CACHE_2020_OCT_12_0245PM
+
+#include <phylanx/config.hpp>
+#include <phylanx/ast/node.hpp>
+#include <phylanx/execution_tree/compiler/actors.hpp>
+#include <phylanx/execution_tree/compiler/compiler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace execution_tree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Statistics collected by the cache of parsed source code
+    struct compile_cache_statistics
+    {
+        std::int64_t hits_;         // number of times parsing was avoided
+        std::int64_t misses_;       // number of times the code was parsed
+        std::int64_t entries_;      // number of sources currently cached
+    };
+
+    /// Enable or disable the cache of parsed source code. Compiling the same
+    /// source code again will reuse the expressions parsed by the earlier
+    /// compilation, independently of the name, environment, and locality
+    /// used. The cache is initially enabled if the configuration setting
+    /// 'phylanx.compile_cache' is set to '1' (default: '0'). At most
+    /// 'phylanx.compile_cache_size' entries are cached (default: 256).
+    ///
+    /// Note: every compilation creates its own primitive components, bound
+    ///       to the variables defined in the environment at that time.
+    PHYLANX_EXPORT void enable_compile_cache(bool enable);
+    PHYLANX_EXPORT bool compile_cache_enabled();
+
+    /// Remove all entries from the cache of parsed source code
+    PHYLANX_EXPORT void clear_compile_cache();
+
+    /// Retrieve (and optionally reset) the statistics of the cache
+    PHYLANX_EXPORT compile_cache_statistics get_compile_cache_statistics(
+        bool reset = false);
+
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// Look up the expressions parsed by an earlier compilation of the
+        /// given source code.
+        PHYLANX_EXPORT bool find_compiled(std::string const& source,
+            std::vector<ast::expression>& exprs);
+
+        /// Add the expressions parsed for the given source code to the cache.
+        PHYLANX_EXPORT void add_compiled(std::string const& source,
+            std::vector<ast::expression> const& exprs);
+
+        /// Parse the given source code. If the configuration setting
+        /// 'phylanx.compile_cache_path' refers to a directory, the generated
+        /// AST is stored there (keyed by the hash of the source code) and is
+        /// reused instead of parsing the same code again, even after a
+        /// restart of the application.
+        PHYLANX_EXPORT std::vector<ast::expression> generate_ast(
+            std::string const& source);
+    }
+}}
+
+#endif
@@ -19,11 +19,14 @@
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/errors/throw_exception.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
 #include <cstddef>
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -85,10 +88,184 @@ namespace phylanx { namespace execution_tree { namespace compiler
         factory_function_type creator_;     // creator function for the primitive
         std::vector<std::string> args_;     // argument names
         std::vector<std::string> defaults_; // default values
+        std::vector<ast::expression> default_asts_; // parsed default values
     };
 
-    using expression_pattern_list =
-        std::multimap<std::string, expression_pattern>;
+    ///////////////////////////////////////////////////////////////////////////
+    /// Index of a list of expression patterns that allows to find the
+    /// patterns that could possibly match a given expression without trying
+    /// each of them. Patterns for function calls are indexed by the function
+    /// name and their arity, all other patterns by the kind of their topmost
+    /// AST node.
+    class expression_pattern_index
+    {
+        using patterns_type = std::multimap<std::string, expression_pattern>;
+
+    public:
+        using const_iterator = patterns_type::const_iterator;
+
+        PHYLANX_EXPORT explicit expression_pattern_index(
+            patterns_type const& patterns);
+
+        /// Return the patterns that could match the given expression in the
+        /// order they appear in the indexed list.
+        PHYLANX_EXPORT std::vector<const_iterator> find(
+            ast::expression const& expr) const;
+
+        /// Return the size of the pattern list this index was built for.
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+    private:
+        struct candidate
+        {
+            const_iterator pattern_;
+            std::size_t min_arity_;     // number of non-variadic arguments
+            bool variadic_;             // pattern accepts more arguments
+        };
+
+        std::map<std::string, std::vector<candidate>> candidates_;
+        std::vector<candidate> wildcards_;  // patterns that match anything
+        std::vector<const_iterator> all_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The list of all known expression patterns, ordered by the name of the
+    /// primitive they represent. The list maintains an index that is
+    /// (re-)built on first use after the list was modified. The patterns can
+    /// be modified only through the list itself, which discards the index.
+    class expression_pattern_list
+    {
+        using patterns_type = std::multimap<std::string, expression_pattern>;
+
+    public:
+        using key_type = patterns_type::key_type;
+        using mapped_type = patterns_type::mapped_type;
+        using value_type = patterns_type::value_type;
+        using size_type = patterns_type::size_type;
+        using const_iterator = patterns_type::const_iterator;
+
+        expression_pattern_list() = default;
+
+        expression_pattern_list(expression_pattern_list const& rhs)
+          : patterns_(rhs.patterns_)
+        {
+        }
+        expression_pattern_list(expression_pattern_list&& rhs)
+          : patterns_(std::move(rhs.patterns_))
+        {
+            rhs.reset_index();
+        }
+
+        expression_pattern_list& operator=(expression_pattern_list const& rhs)
+        {
+            if (this != &rhs)
+            {
+                patterns_ = rhs.patterns_;
+                reset_index();
+            }
+            return *this;
+        }
+        expression_pattern_list& operator=(expression_pattern_list&& rhs)
+        {
+            if (this != &rhs)
+            {
+                patterns_ = std::move(rhs.patterns_);
+                reset_index();
+                rhs.reset_index();
+            }
+            return *this;
+        }
+
+        // modifiers
+        const_iterator insert(value_type const& value)
+        {
+            reset_index();
+            return patterns_.insert(value);
+        }
+        const_iterator insert(value_type&& value)
+        {
+            reset_index();
+            return patterns_.insert(std::move(value));
+        }
+
+        template <typename... Ts>
+        const_iterator emplace(Ts&&... ts)
+        {
+            reset_index();
+            return patterns_.emplace(std::forward<Ts>(ts)...);
+        }
+
+        const_iterator erase(const_iterator it)
+        {
+            reset_index();
+            return patterns_.erase(it);
+        }
+        size_type erase(key_type const& key)
+        {
+            reset_index();
+            return patterns_.erase(key);
+        }
+
+        void clear()
+        {
+            reset_index();
+            patterns_.clear();
+        }
+
+        // read-only access
+        const_iterator begin() const
+        {
+            return patterns_.begin();
+        }
+        const_iterator end() const
+        {
+            return patterns_.end();
+        }
+
+        size_type size() const
+        {
+            return patterns_.size();
+        }
+        bool empty() const
+        {
+            return patterns_.empty();
+        }
+
+        const_iterator find(key_type const& key) const
+        {
+            return patterns_.find(key);
+        }
+        const_iterator lower_bound(key_type const& key) const
+        {
+            return patterns_.lower_bound(key);
+        }
+        std::pair<const_iterator, const_iterator> equal_range(
+            key_type const& key) const
+        {
+            return patterns_.equal_range(key);
+        }
+
+        /// Return the index for this list, building it if the list was
+        /// modified since it was last built.
+        PHYLANX_EXPORT std::shared_ptr<expression_pattern_index const>
+        index() const;
+
+    private:
+        void reset_index()
+        {
+            std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+            index_.reset();
+        }
+
+        patterns_type patterns_;
+
+        mutable hpx::lcos::local::spinlock mtx_;
+        mutable std::shared_ptr<expression_pattern_index const> index_;
+    };
 
     PHYLANX_EXPORT expression_pattern_list const& generate_patterns();
 
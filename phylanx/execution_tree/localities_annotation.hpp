@@ -74,6 +74,10 @@ namespace phylanx { namespace execution_tree
         locality_information locality_;
         annotation_information annotation_;
         std::vector<tiling_information> tiles_;
+
+        // version of the annotated value on this locality (see
+        // annotation::version), -1 if the value is not annotated
+        std::int64_t version_ = -1;
     };
 
     PHYLANX_EXPORT localities_information extract_localities_information(
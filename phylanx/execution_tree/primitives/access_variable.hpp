@@ -46,6 +46,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
     private:
         util::hashed_string target_name_;   // name of the represented variable
+        variable_location target_location_; // where the variable was found
     };
 }}}
 
@@ -269,6 +269,33 @@ namespace phylanx { namespace execution_tree
     PHYLANX_EXPORT bool is_numeric_operand_strict(
         primitive_argument_type const& val);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract a ir::node_data<float> type from a given primitive_argument_type,
+    // throw if it doesn't hold one.
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<float>&& extract_float32_value_strict(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT bool is_float32_operand_strict(
+        primitive_argument_type const& val);
+
+    // Return whether the given argument holds compressed (sparse) data
+    PHYLANX_EXPORT bool is_sparse_operand(primitive_argument_type const& val);
+
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::size_t extract_numeric_value_dimension(
         primitive_argument_type const& val,
@@ -516,6 +543,13 @@ namespace phylanx { namespace execution_tree
         return extract_numeric_value(val, name, codename);
     }
     template <>
+    inline ir::node_data<float> extract_node_data(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value(val, name, codename);
+    }
+    template <>
     inline ir::node_data<std::int64_t> extract_node_data(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
@@ -543,6 +577,13 @@ namespace phylanx { namespace execution_tree
         return extract_numeric_value(std::move(val), name, codename);
     }
     template <>
+    inline ir::node_data<float> extract_node_data(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value(std::move(val), name, codename);
+    }
+    template <>
     inline ir::node_data<std::int64_t> extract_node_data(
         primitive_argument_type&& val, std::string const& name,
         std::string const& codename)
@@ -571,6 +612,13 @@ namespace phylanx { namespace execution_tree
         return extract_numeric_value_strict(val, name, codename);
     }
     template <>
+    inline ir::node_data<float> extract_node_data_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value_strict(val, name, codename);
+    }
+    template <>
     inline ir::node_data<std::int64_t> extract_node_data_strict(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
@@ -598,6 +646,13 @@ namespace phylanx { namespace execution_tree
         return extract_numeric_value_strict(std::move(val), name, codename);
     }
     template <>
+    inline ir::node_data<float> extract_node_data_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value_strict(std::move(val), name, codename);
+    }
+    template <>
     inline ir::node_data<std::int64_t> extract_node_data_strict(
         primitive_argument_type&& val, std::string const& name,
         std::string const& codename)
@@ -625,6 +680,12 @@ namespace phylanx { namespace execution_tree
         return extract_scalar_numeric_value(val, name, codename);
     }
     template <>
+    inline float extract_scalar_data(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        return float(extract_scalar_numeric_value(val, name, codename));
+    }
+    template <>
     inline std::int64_t extract_scalar_data(primitive_argument_type const& val,
         std::string const& name, std::string const& codename)
     {
@@ -649,6 +710,13 @@ namespace phylanx { namespace execution_tree
         return extract_scalar_numeric_value(std::move(val), name, codename);
     }
     template <>
+    inline float extract_scalar_data(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        return float(
+            extract_scalar_numeric_value(std::move(val), name, codename));
+    }
+    template <>
     inline std::int64_t extract_scalar_data(primitive_argument_type&& val,
         std::string const& name, std::string const& codename)
     {
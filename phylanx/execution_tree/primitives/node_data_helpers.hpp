@@ -28,9 +28,10 @@ namespace phylanx { namespace execution_tree
     enum node_data_type
     {
         node_data_type_double = 0,
-        node_data_type_int64 = 1,
-        node_data_type_bool = 2,
-        node_data_type_unknown = 3,     // must be largest value
+        node_data_type_float32 = 1,
+        node_data_type_int64 = 2,
+        node_data_type_bool = 3,
+        node_data_type_unknown = 4,     // must be largest value
     };
 
     /// Extract node_data_type from a primitive name
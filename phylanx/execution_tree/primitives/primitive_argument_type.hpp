@@ -21,8 +21,11 @@
 #include <hpx/include/runtime.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
+#include <boost/container/static_vector.hpp>
 #include <boost/utility/string_ref.hpp>
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <map>
@@ -95,12 +98,106 @@ namespace phylanx { namespace execution_tree
     ///////////////////////////////////////////////////////////////////////////
     enum class language { cxx = 0, python = 1 };
 
+    /// The location of a variable in a chain of frames, i.e. the number of
+    /// frames to skip and the index of the variable in the frame it was found
+    /// in. Primitives accessing a variable keep one of these to avoid
+    /// searching for it on each evaluation. A location is a hint only, it is
+    /// verified on every use and recomputed if it doesn't match.
+    class variable_location
+    {
+    public:
+        variable_location() noexcept
+          : location_(invalid_location)
+        {
+        }
+
+        variable_location(variable_location const& rhs) noexcept
+          : location_(rhs.location_.load(std::memory_order_relaxed))
+        {
+        }
+
+        variable_location& operator=(variable_location const& rhs) noexcept
+        {
+            location_.store(rhs.location_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            return *this;
+        }
+
+    private:
+        friend class variable_frame;
+
+        static constexpr std::uint64_t invalid_location = ~std::uint64_t(0);
+
+        // frame depth is stored in the upper, slot in the lower 32 bits
+        mutable std::atomic<std::uint64_t> location_;
+    };
+
     class variable_frame
     {
-        using allocator_type = hpx::util::internal_allocator<
-            std::pair<util::hashed_string const, primitive_argument_type>>;
-        using variables_map_type = std::map<util::hashed_string,
-            primitive_argument_type, std::less<>, allocator_type>;
+        using value_type =
+            std::pair<util::hashed_string, primitive_argument_type>;
+
+        // frames usually hold very few variables, linearly searching them
+        // (comparing the precomputed hashes first) is faster than any tree or
+        // hash table lookup. References to the stored variables are handed
+        // out (see define_variable), so the container must not move its
+        // elements when new variables are added. The first few variables are
+        // stored inline, further ones in separately allocated segments.
+        class variables_type
+        {
+            static constexpr std::size_t segment_size = 4;
+            using segment_type =
+                boost::container::static_vector<value_type, segment_size>;
+
+        public:
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            value_type& operator[](std::size_t slot) noexcept
+            {
+                return slot < segment_size ?
+                    first_[slot] :
+                    (*more_[slot / segment_size - 1])[slot % segment_size];
+            }
+            value_type const& operator[](std::size_t slot) const noexcept
+            {
+                return slot < segment_size ?
+                    first_[slot] :
+                    (*more_[slot / segment_size - 1])[slot % segment_size];
+            }
+
+            template <typename... Ts>
+            value_type& emplace_back(Ts&&... ts)
+            {
+                segment_type* segment = &first_;
+                if (size_ >= segment_size)
+                {
+                    std::size_t const index = size_ / segment_size - 1;
+                    if (index == more_.size())
+                    {
+                        more_.push_back(std::make_unique<segment_type>());
+                    }
+                    segment = more_[index].get();
+                }
+                segment->emplace_back(std::forward<Ts>(ts)...);
+                ++size_;
+                return segment->back();
+            }
+
+            void clear() noexcept
+            {
+                first_.clear();
+                more_.clear();
+                size_ = 0;
+            }
+
+        private:
+            segment_type first_;
+            std::vector<std::unique_ptr<segment_type>> more_;
+            std::size_t size_ = 0;
+        };
 
     public:
         variable_frame() = default;
@@ -118,6 +215,14 @@ namespace phylanx { namespace execution_tree
             util::hashed_string const& name) noexcept;
         inline primitive_argument_type const* get_var(
             util::hashed_string const& name) const noexcept;
+
+        inline primitive_argument_type* get_var(
+            util::hashed_string const& name,
+            variable_location const& loc) noexcept;
+        inline primitive_argument_type const* get_var(
+            util::hashed_string const& name,
+            variable_location const& loc) const noexcept;
+
         inline primitive_argument_type& set_var(
             util::hashed_string const& name, primitive_argument_type&& var,
             bool define_globally = false);
@@ -131,8 +236,24 @@ namespace phylanx { namespace execution_tree
         PHYLANX_EXPORT void serialize(hpx::serialization::input_archive& ar,
             unsigned);
 
+        inline std::size_t find_slot(
+            util::hashed_string const& name) const noexcept;
+
+        // every defined variable sets one bit (selected by its hash) in
+        // defined_, a clear bit proves that a variable is not defined in this
+        // frame without searching it
+        static std::uint64_t name_bit(util::hashed_string const& name) noexcept
+        {
+            return std::uint64_t(1) << (name.hash() % 64);
+        }
+        bool may_define(util::hashed_string const& name) const noexcept
+        {
+            return (defined_ & name_bit(name)) != 0;
+        }
+
     private:
-        variables_map_type variables_;
+        variables_type variables_;
+        std::uint64_t defined_ = 0;
         std::shared_ptr<variable_frame> nextframe_;
         language lang_;
         std::string name_;
@@ -202,6 +323,19 @@ namespace phylanx { namespace execution_tree
             return variables_->get_var(name);
         }
 
+        primitive_argument_type* get_var(util::hashed_string const& name,
+            variable_location const& loc) noexcept
+        {
+            HPX_ASSERT(bool(variables_));
+            return variables_->get_var(name, loc);
+        }
+        primitive_argument_type const* get_var(util::hashed_string const& name,
+            variable_location const& loc) const noexcept
+        {
+            HPX_ASSERT(bool(variables_));
+            return variables_->get_var(name, loc);
+        }
+
         inline primitive_argument_type& set_var(util::hashed_string const& name,
             primitive_argument_type&& var, bool define_globally = false);
 
@@ -377,6 +511,7 @@ namespace phylanx { namespace execution_tree
           , util::recursive_wrapper<hpx::shared_future<primitive_argument_type>>
           , ir::range
           , phylanx::ir::dictionary
+          , ir::node_data<float>
         >;
 
     PHYLANX_EXPORT primitive_argument_type extract_copy_value(
@@ -397,7 +532,8 @@ namespace phylanx { namespace execution_tree
             primitive_index = 5,
             future_index = 6,
             list_index = 7,
-            dictionary_index = 8
+            dictionary_index = 8,
+            float32_index = 9
         };
 
         using annotation_ptr = std::shared_ptr<execution_tree::annotation>;
@@ -707,6 +843,88 @@ namespace phylanx { namespace execution_tree
           , annotation_(ann)
         {}
 
+        // float
+        explicit primitive_argument_type(float val)
+          : argument_value_type{ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicVector<float> const& val)
+          : argument_value_type{ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicVector<float>&& val)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicMatrix<float> const& val)
+          : argument_value_type{ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicMatrix<float>&& val)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicTensor<float> const& val)
+          : argument_value_type{ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicTensor<float>&& val)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+        {}
+        explicit primitive_argument_type(
+            blaze::DynamicArray<4UL, float> const& val)
+          : argument_value_type{phylanx::ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicArray<4UL, float>&& val)
+          : argument_value_type{phylanx::ir::node_data<float>{std::move(val)}}
+        {}
+
+        primitive_argument_type(float val, annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{val}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicVector<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{val}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicVector<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicMatrix<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{val}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicMatrix<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicTensor<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{val}}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(blaze::DynamicTensor<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{ir::node_data<float>{std::move(val)}}
+          , annotation_(ann)
+        {}
+
+        primitive_argument_type(ir::node_data<float> const& val)
+          : argument_value_type{val}
+        {}
+        primitive_argument_type(ir::node_data<float>&& val)
+          : argument_value_type{std::move(val)}
+        {}
+        primitive_argument_type(ir::node_data<float> const& val,
+                annotation_ptr const& ann)
+          : argument_value_type{val}
+          , annotation_(ann)
+        {}
+        primitive_argument_type(ir::node_data<float>&& val,
+                annotation_ptr const& ann)
+          : argument_value_type{std::move(val)}
+          , annotation_(ann)
+        {}
+
         // primitive
         primitive_argument_type(primitive const& val)
           : argument_value_type{val}
@@ -1012,34 +1230,95 @@ namespace phylanx { namespace execution_tree
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    std::size_t variable_frame::find_slot(
+        util::hashed_string const& name) const noexcept
+    {
+        std::size_t const size = variables_.size();
+        for (std::size_t slot = 0; slot != size; ++slot)
+        {
+            if (variables_[slot].first == name)
+            {
+                return slot;
+            }
+        }
+        return size;
+    }
+
     primitive_argument_type* variable_frame::get_var(
         util::hashed_string const& name) noexcept
     {
-        auto it = variables_.find(name);
-        if (it == variables_.end())
+        return const_cast<primitive_argument_type*>(
+            static_cast<variable_frame const*>(this)->get_var(name));
+    }
+
+    primitive_argument_type const* variable_frame::get_var(
+        util::hashed_string const& name) const noexcept
+    {
+        for (variable_frame const* frame = this; frame != nullptr;
+             frame = frame->nextframe_.get())
         {
-            if (!nextframe_)
+            std::size_t const slot = frame->find_slot(name);
+            if (slot != frame->variables_.size())
             {
-                return nullptr;
+                return &frame->variables_[slot].second;
             }
-            return nextframe_->get_var(name);
         }
-        return &it->second;
+        return nullptr;
+    }
+
+    primitive_argument_type* variable_frame::get_var(
+        util::hashed_string const& name, variable_location const& loc) noexcept
+    {
+        return const_cast<primitive_argument_type*>(
+            static_cast<variable_frame const*>(this)->get_var(name, loc));
     }
 
     primitive_argument_type const* variable_frame::get_var(
-        util::hashed_string const& name) const noexcept
+        util::hashed_string const& name,
+        variable_location const& loc) const noexcept
     {
-        auto it = variables_.find(name);
-        if (it == variables_.end())
+        std::uint64_t const location =
+            loc.location_.load(std::memory_order_relaxed);
+
+        if (location != variable_location::invalid_location)
         {
-            if (!nextframe_)
+            std::uint64_t depth = location >> 32;
+            std::size_t const slot = location & 0xffffffff;
+
+            // the variable must not be shadowed by any of the frames in
+            // between, frames that have never defined a variable with a
+            // similar hash don't need to be searched
+            variable_frame const* frame = this;
+            while (depth != 0 && frame != nullptr &&
+                (!frame->may_define(name) ||
+                    frame->find_slot(name) == frame->variables_.size()))
             {
-                return nullptr;
+                frame = frame->nextframe_.get();
+                --depth;
+            }
+
+            if (depth == 0 && frame != nullptr &&
+                slot < frame->variables_.size() &&
+                frame->variables_[slot].first == name)
+            {
+                return &frame->variables_[slot].second;
             }
-            return nextframe_->get_var(name);
         }
-        return &it->second;
+
+        // search all frames and remember where the variable was found
+        std::uint64_t depth = 0;
+        for (variable_frame const* frame = this; frame != nullptr;
+             frame = frame->nextframe_.get(), ++depth)
+        {
+            std::size_t const slot = frame->find_slot(name);
+            if (slot != frame->variables_.size())
+            {
+                loc.location_.store((depth << 32) | slot,
+                    std::memory_order_relaxed);
+                return &frame->variables_[slot].second;
+            }
+        }
+        return nullptr;
     }
 
     primitive_argument_type& variable_frame::set_var(
@@ -1054,17 +1333,15 @@ namespace phylanx { namespace execution_tree
 
         // non-global variables are always created in the currently top-most
         // environment
-        auto it = variables_.find(name);
-        if (it == variables_.end())
+        std::size_t const slot = find_slot(name);
+        if (slot == variables_.size())
         {
-            using value_type = variables_map_type::value_type;
-            it = variables_.insert(value_type(name, std::move(var))).first;
+            defined_ |= name_bit(name);
+            return variables_.emplace_back(name, std::move(var)).second;
         }
-        else
-        {
-            it->second = std::move(var);
-        }
-        return it->second;
+
+        variables_[slot].second = std::move(var);
+        return variables_[slot].second;
     }
 
     ////////////////////////////////////////////////////////////////////////////
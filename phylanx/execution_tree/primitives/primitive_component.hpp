@@ -101,6 +101,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         PHYLANX_EXPORT std::int64_t get_eval_count(bool reset) const;
         PHYLANX_EXPORT std::int64_t get_eval_duration(bool reset) const;
         PHYLANX_EXPORT std::int64_t get_direct_execution(bool reset) const;
+        PHYLANX_EXPORT std::int64_t get_allocated_bytes(bool reset) const;
+        PHYLANX_EXPORT std::int64_t get_copied_bytes(bool reset) const;
+        PHYLANX_EXPORT std::int64_t get_peak_bytes(bool reset) const;
 
         PHYLANX_EXPORT void enable_measurements();
 
@@ -9,6 +9,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/util/adaptive_execution.hpp>
+#include <phylanx/util/memory_counters.hpp>
 
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/include/lcos.hpp>
@@ -16,6 +18,7 @@
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/modules/naming.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
@@ -98,6 +101,9 @@ namespace phylanx { namespace execution_tree
             std::int64_t get_eval_count(bool reset) const;
             std::int64_t get_eval_duration(bool reset) const;
             std::int64_t get_direct_execution(bool reset) const;
+            std::int64_t get_allocated_bytes(bool reset) const;
+            std::int64_t get_copied_bytes(bool reset) const;
+            std::int64_t get_peak_bytes(bool reset) const;
 
             void enable_measurements();
 
@@ -126,6 +132,12 @@ namespace phylanx { namespace execution_tree
             std::string generate_error_message(
                 std::string const& msg, eval_context const& ctx) const;
 
+            // record the evaluation in the execution trace once the given
+            // future becomes ready
+            hpx::future<primitive_argument_type> trace_eval(
+                hpx::future<primitive_argument_type>&& f,
+                std::uint64_t started_at) const;
+
             static bool get_sync_execution();
             static std::int64_t get_ec_threshold();
             static std::int64_t get_exec_upper_threshold();
@@ -142,8 +154,15 @@ namespace phylanx { namespace execution_tree
             mutable std::int64_t eval_count_;
             mutable std::int64_t eval_duration_;
             mutable std::int64_t execute_directly_;
+            hpx::intrusive_ptr<util::memory_counters> memory_counters_;
             bool measurements_enabled_;
 
+            // online tuner for selecting direct execution
+            mutable util::adaptive_execution tuner_;
+
+            // identifier of this primitive in the execution trace
+            mutable std::atomic<std::int64_t> trace_name_{-1};
+
 #if defined(HPX_HAVE_APEX)
             std::string eval_name_;
 #ifdef PHYLANX_HAVE_TASK_INLINING_POLICY
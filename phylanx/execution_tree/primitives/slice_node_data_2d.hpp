@@ -1202,6 +1202,157 @@ namespace phylanx { namespace execution_tree
                 "unsupported indexing type", name, codename, ctx.back_trace()));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Extract the range to slice along one dimension of sparse data or
+        // of a referenced matrix. Returns false if the index can't be
+        // represented as a contiguous range of rows or columns.
+        inline bool extract_contiguous_slicing(primitive_argument_type const& arg,
+            std::size_t size, ir::slicing_indices& result,
+            std::string const& name, std::string const& codename,
+            eval_context const& ctx)
+        {
+            if (!valid(arg))
+            {
+                // an explicit 'nil' is equivalent to np.newaxis
+                if (is_explicit_nil(arg))
+                {
+                    return false;
+                }
+                result = ir::slicing_indices(0, std::int64_t(size), 1);
+                return true;
+            }
+
+            if (!is_list_operand_strict(arg) ||
+                extract_slicing_index_type(arg, name, codename) !=
+                    slicing_index_basic)
+            {
+                return false;
+            }
+
+            result = util::slicing_helpers::extract_slicing(
+                arg, size, name, codename, ctx);
+
+            return !result.single_value() && result.step() == 1 &&
+                result.start() >= 0 && result.start() <= result.stop() &&
+                result.stop() <= std::int64_t(size);
+        }
+
+        // A contiguous range of rows of referenced data (spanning all
+        // columns) is returned as a reference to the same memory, as each
+        // of the rows is still aligned and padded. The memory is owned by
+        // whoever owns the referenced data.
+        //
+        // TODO: Column windows are still copied. Their rows don't start
+        //       at aligned addresses and the elements following them are
+        //       not zero, which violates the requirements of
+        //       custom_storage2d_type. Returning them as references needs
+        //       an unaligned, unpadded (strided) 2d view alternative in
+        //       node_data::storage_type that is handled by matrix() and
+        //       the kernels. The same view would allow borrowing numpy
+        //       arrays that are not aligned or padded.
+        template <typename T>
+        bool slice2d_rows_ref(ir::node_data<T> const& data,
+            primitive_argument_type const& rows,
+            primitive_argument_type const& columns, ir::node_data<T>& result,
+            std::string const& name, std::string const& codename,
+            eval_context const& ctx)
+        {
+            if (!data.is_ref() || data.is_sparse())
+            {
+                return false;
+            }
+
+            auto m = data.matrix();
+
+            ir::slicing_indices row_indices, column_indices;
+            if (!extract_contiguous_slicing(columns, m.columns(),
+                    column_indices, name, codename, ctx) ||
+                column_indices.start() != 0 ||
+                column_indices.stop() != std::int64_t(m.columns()) ||
+                !extract_contiguous_slicing(
+                    rows, m.rows(), row_indices, name, codename, ctx) ||
+                row_indices.start() == row_indices.stop())
+            {
+                return false;
+            }
+
+            result = ir::node_data<T>{
+                typename ir::node_data<T>::custom_storage2d_type{
+                    m.data() + row_indices.start() * m.spacing(),
+                    std::size_t(row_indices.stop() - row_indices.start()),
+                    m.columns(), m.spacing()}};
+            return true;
+        }
+
+        // A single row of referenced data is returned as a reference to the
+        // same memory as well.
+        template <typename T>
+        bool slice1d_row_ref(ir::node_data<T> const& data,
+            primitive_argument_type const& index, ir::node_data<T>& result,
+            std::string const& name, std::string const& codename)
+        {
+            if (!data.is_ref() || data.is_sparse() ||
+                !is_integer_operand_strict(index))
+            {
+                return false;
+            }
+
+            auto idx = extract_integer_value_strict(index, name, codename);
+            if (idx.num_dimensions() != 0)
+            {
+                return false;
+            }
+
+            auto m = data.matrix();
+
+            std::int64_t row = idx.scalar();
+            if (row < 0)
+            {
+                row += std::int64_t(m.rows());
+            }
+            if (row < 0 || row >= std::int64_t(m.rows()) || m.columns() == 0)
+            {
+                return false;
+            }
+
+            result = ir::node_data<T>{
+                typename ir::node_data<T>::custom_storage1d_type{
+                    m.data() + row * m.spacing(), m.columns(), m.spacing()}};
+            return true;
+        }
+    }
+
+    // Slicing compressed data with contiguous ranges results in compressed
+    // data, all other forms of indexing are applied to a dense copy.
+    template <typename T>
+    ir::node_data<T> slice2d_extract2d_sparse(ir::node_data<T> const& data,
+        execution_tree::primitive_argument_type const& rows,
+        execution_tree::primitive_argument_type const& columns,
+        std::string const& name, std::string const& codename,
+        eval_context ctx)
+    {
+        auto const& m = data.sparse_matrix();
+
+        ir::slicing_indices row_indices, column_indices;
+        if (detail::extract_contiguous_slicing(
+                rows, m.rows(), row_indices, name, codename, ctx) &&
+            detail::extract_contiguous_slicing(
+                columns, m.columns(), column_indices, name, codename, ctx))
+        {
+            return ir::node_data<T>{
+                typename ir::node_data<T>::sparse_storage2d_type{
+                    blaze::submatrix(m, row_indices.start(),
+                        column_indices.start(),
+                        row_indices.stop() - row_indices.start(),
+                        column_indices.stop() - column_indices.start())}};
+        }
+
+        return slice2d<T>(data.matrix_copy(), rows, columns,
+            detail::slice_identity<T>{}, name, codename, ctx);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     ir::node_data<T> slice1d_extract2d(ir::node_data<T> const& data,
@@ -1209,6 +1360,20 @@ namespace phylanx { namespace execution_tree
         std::string const& name, std::string const& codename,
         eval_context ctx)
     {
+        if (data.is_sparse())
+        {
+            return slice2d_extract2d_sparse<T>(data, indices,
+                primitive_argument_type{}, name, codename, std::move(ctx));
+        }
+
+        ir::node_data<T> result;
+        if (detail::slice1d_row_ref(data, indices, result, name, codename) ||
+            detail::slice2d_rows_ref(data, indices, primitive_argument_type{},
+                result, name, codename, ctx))
+        {
+            return result;
+        }
+
         return slice2d<T>(data.matrix(), indices, primitive_argument_type{},
             detail::slice_identity<T>{}, name, codename, ctx);
     }
@@ -1289,6 +1454,21 @@ namespace phylanx { namespace execution_tree
         std::string const& name, std::string const& codename,
         eval_context ctx)
     {
+        if (data.is_sparse())
+        {
+            return slice2d_extract2d_sparse<T>(
+                data, rows, columns, name, codename, std::move(ctx));
+        }
+
+        ir::node_data<T> result;
+        if ((!valid(columns) && !is_explicit_nil(columns) &&
+                detail::slice1d_row_ref(data, rows, result, name, codename)) ||
+            detail::slice2d_rows_ref(
+                data, rows, columns, result, name, codename, ctx))
+        {
+            return result;
+        }
+
         return slice2d<T>(data.matrix(), rows, columns,
             detail::slice_identity<T>{}, name, codename, ctx);
     }
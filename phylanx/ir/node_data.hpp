@@ -14,11 +14,14 @@
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/errors/throw_exception.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iosfwd>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -26,6 +29,11 @@
 #include <blaze/Math.h>
 #include <blaze_tensor/Math.h>
 
+namespace phylanx { namespace util
+{
+    struct memory_counters;
+}}
+
 namespace phylanx { namespace ir
 {
     ///////////////////////////////////////////////////////////////////////////
@@ -37,6 +45,52 @@ namespace phylanx { namespace ir
         /// \cond NOINTERNAL
 
         ///////////////////////////////////////////////////////////////////////
+        // Memory layout of dense node_data. Data of any dimensionality is
+        // stored as a sequence of rows holding 'columns_' consecutive
+        // elements (the innermost dimension), with consecutive rows being
+        // 'spacing_' elements apart (Blaze pads rows for alignment). The data
+        // pointer is null if the data is not stored densely (sparse data).
+        template <typename T>
+        struct node_data_span
+        {
+            bool contiguous() const
+            {
+                return columns_ == spacing_ || size_ == 0;
+            }
+
+            std::size_t rows() const
+            {
+                return columns_ == 0 ? 0 : size_ / columns_;
+            }
+
+            // copy all elements to the given output, row by row
+            template <typename OutIter>
+            OutIter copy(OutIter dest) const
+            {
+                if (contiguous())
+                {
+                    return std::copy(data_, data_ + size_, dest);
+                }
+
+                T const* row = data_;
+                for (std::size_t i = 0, rows_ = rows(); i != rows_; ++i)
+                {
+                    dest = std::copy(row, row + columns_, dest);
+                    row += spacing_;
+                }
+                return dest;
+            }
+
+            T const* data_;
+            std::size_t size_;
+            std::size_t columns_;
+            std::size_t spacing_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The iterator walks the memory of dense data directly, skipping the
+        // padding at the end of each row. Sparse data is accessed through
+        // node_data::operator[].
         template <typename T>
         class node_data_iterator
           : public hpx::util::iterator_facade<node_data_iterator<T>,
@@ -56,37 +110,68 @@ namespace phylanx { namespace ir
                     T const*>;
 
         public:
-            node_data_iterator(node_data<T> const& nd, std::size_t index = 0)
-              : nd_(nd), index_(index)
+            node_data_iterator()
+              : nd_(nullptr), base_(nullptr), ptr_(nullptr), index_(0)
+              , column_(0), columns_(0), spacing_(0)
             {
             }
 
+            inline node_data_iterator(
+                node_data<T> const& nd, std::size_t index = 0);
+
         private:
             friend class hpx::util::iterator_core_access;
 
             typename base_type::reference dereference() const
             {
-                return nd_[index_];
+                if (base_ != nullptr)
+                {
+                    return *ptr_;
+                }
+                return (*nd_)[index_];
             }
 
             bool equal(node_data_iterator const& x) const
             {
-                return &nd_ == &x.nd_ && index_ == x.index_;
+                return nd_ == x.nd_ && index_ == x.index_;
             }
 
             void advance(typename base_type::difference_type n)
             {
                 index_ += n;
+                seek();
             }
 
             void increment()
             {
                 ++index_;
+                if (base_ != nullptr)
+                {
+                    ++ptr_;
+                    if (++column_ == columns_)
+                    {
+                        column_ = 0;
+                        ptr_ += spacing_ - columns_;
+                    }
+                }
             }
 
             void decrement()
             {
                 --index_;
+                if (base_ != nullptr)
+                {
+                    if (column_ == 0)
+                    {
+                        column_ = columns_ - 1;
+                        ptr_ -= spacing_ - columns_ + 1;
+                    }
+                    else
+                    {
+                        --column_;
+                        --ptr_;
+                    }
+                }
             }
 
             typename base_type::difference_type distance_to(
@@ -95,8 +180,88 @@ namespace phylanx { namespace ir
                 return y.index_ - index_;
             }
 
-            node_data<T> const& nd_;
+            void seek()
+            {
+                if (base_ != nullptr && columns_ != 0)
+                {
+                    column_ = index_ % columns_;
+                    ptr_ = base_ + (index_ / columns_) * spacing_ + column_;
+                }
+            }
+
+            node_data<T> const* nd_;
+            T const* base_;
+            T const* ptr_;
             std::size_t index_;
+            std::size_t column_;
+            std::size_t columns_;
+            std::size_t spacing_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Compressed (sparse) data is shared between the node_data instances
+        // copied or referenced from each other. The dense representation
+        // needed by code that is not aware of compressed storage is created
+        // on first use and is shared as well.
+        template <typename T>
+        class sparse_storage
+        {
+        public:
+            using matrix_type = blaze::CompressedMatrix<T, blaze::rowMajor>;
+            using dense_type = blaze::DynamicMatrix<T>;
+
+            explicit sparse_storage(matrix_type const& m)
+              : matrix_(m)
+              , dense_(nullptr)
+            {
+            }
+
+            explicit sparse_storage(matrix_type&& m)
+              : matrix_(std::move(m))
+              , dense_(nullptr)
+            {
+            }
+
+            ~sparse_storage()
+            {
+                delete dense_.load(std::memory_order_relaxed);
+            }
+
+            sparse_storage(sparse_storage const&) = delete;
+            sparse_storage& operator=(sparse_storage const&) = delete;
+
+            matrix_type const& matrix() const
+            {
+                return matrix_;
+            }
+
+            // the compressed data may be modified only if it is not shared
+            matrix_type& matrix()
+            {
+                delete dense_.exchange(nullptr, std::memory_order_relaxed);
+                return matrix_;
+            }
+
+            dense_type const& dense() const
+            {
+                dense_type* d = dense_.load(std::memory_order_acquire);
+                if (d == nullptr)
+                {
+                    // concurrent readers may race creating the dense data,
+                    // only one of them installs its result
+                    std::unique_ptr<dense_type> p(new dense_type(matrix_));
+                    if (dense_.compare_exchange_strong(
+                            d, p.get(), std::memory_order_acq_rel))
+                    {
+                        d = p.release();
+                    }
+                }
+                return *d;
+            }
+
+        private:
+            matrix_type matrix_;
+            mutable std::atomic<dense_type*> dense_;
         };
     }
 
@@ -141,10 +306,18 @@ namespace phylanx { namespace ir
         using custom_storage4d_type =
             blaze::CustomArray<4UL, T, blaze::aligned, blaze::padded>;
 
+        // compressed row storage (CSR) for mostly-zero 2-dimensional data,
+        // the compressed data is shared by copies and references
+        using sparse_storage2d_type =
+            blaze::CompressedMatrix<T, blaze::rowMajor>;
+        using shared_sparse_storage2d_type =
+            std::shared_ptr<detail::sparse_storage<T>>;
+
         using storage_type = util::variant<storage0d_type, storage1d_type,
             storage2d_type, storage3d_type, storage4d_type,
             custom_storage0d_type, custom_storage1d_type, custom_storage2d_type,
-            custom_storage3d_type, custom_storage4d_type>;
+            custom_storage3d_type, custom_storage4d_type,
+            shared_sparse_storage2d_type>;
 
         enum variant_index
         {
@@ -157,7 +330,8 @@ namespace phylanx { namespace ir
             custom_storage1d = 6,
             custom_storage2d = 7,
             custom_storage3d = 8,
-            custom_storage4d = 9
+            custom_storage4d = 9,
+            sparse_storage2d = 10
         };
 
         using dimensions_type = std::array<std::size_t, max_dimensions>;
@@ -188,6 +362,10 @@ namespace phylanx { namespace ir
         explicit node_data(custom_storage2d_type const& values);
         explicit node_data(custom_storage2d_type && values);
 
+        /// Create node data for a sparse 2-dimensional value
+        explicit node_data(sparse_storage2d_type const& values);
+        explicit node_data(sparse_storage2d_type && values);
+
         /// Create node data for a 3-dimensional value
         explicit node_data(storage3d_type const& values);
         explicit node_data(storage3d_type && values);
@@ -236,6 +414,14 @@ namespace phylanx { namespace ir
         template <typename U>
         static storage_type init_data_from_type(node_data<U> const& d)
         {
+            if (d.is_sparse())
+            {
+                increment_copy_construction_count();
+                return storage_type(
+                    std::make_shared<detail::sparse_storage<T>>(
+                        sparse_storage2d_type(d.sparse_matrix())));
+            }
+
             std::size_t dims = d.num_dimensions();
 
             switch (dims)
@@ -275,11 +461,15 @@ namespace phylanx { namespace ir
         node_data(node_data const& d);
         node_data(node_data && d);
 
+        /// Owned dense storage is handed to the buffer pool for reuse
+        ~node_data();
+
         template <typename U, typename U1 =
             typename std::enable_if<!std::is_same<T, U>::value>::type>
         explicit node_data(node_data<U> const& d)
           : data_(init_data_from_type(d))
         {
+            track_allocation(true);
         }
 
         node_data& operator=(storage0d_type val);
@@ -299,6 +489,9 @@ namespace phylanx { namespace ir
         node_data& operator=(custom_storage2d_type const& val);
         node_data& operator=(custom_storage2d_type && val);
 
+        node_data& operator=(sparse_storage2d_type const& val);
+        node_data& operator=(sparse_storage2d_type && val);
+
         node_data& operator=(storage3d_type const& val);
         node_data& operator=(storage3d_type && val);
 
@@ -332,7 +525,10 @@ namespace phylanx { namespace ir
             typename std::enable_if<!std::is_same<T, U>::value>::type>
         node_data& operator=(node_data<U> const& d)
         {
-            data_ = init_data_from_type(d);
+            storage_type data = init_data_from_type(d);
+            track_deallocation();
+            data_ = std::move(data);
+            track_allocation(true);
             return *this;
         }
 
@@ -389,6 +585,16 @@ namespace phylanx { namespace ir
         custom_storage2d_type matrix() &&;
         custom_storage2d_type matrix() const&&;
 
+        /// Access the compressed representation of sparse 2-dimensional data.
+        /// The compressed data is shared with copies and references of this
+        /// instance, sparse_matrix_non_ref() creates a private copy first if
+        /// needed. matrix() gives access to a dense representation of sparse
+        /// data: the non-const overloads convert this instance to dense
+        /// storage, the const overloads refer to a dense copy shared by all
+        /// instances referring to the same compressed data.
+        sparse_storage2d_type const& sparse_matrix() const;
+        sparse_storage2d_type& sparse_matrix_non_ref();
+
         storage1d_type& vector_non_ref();
         storage1d_type const& vector_non_ref() const;
 
@@ -435,6 +641,13 @@ namespace phylanx { namespace ir
         /// instance of node_data
         bool is_ref() const;
 
+        /// Return whether the internal representation uses compressed row
+        /// storage
+        bool is_sparse() const
+        {
+            return data_.index() == sparse_storage2d;
+        }
+
         explicit operator bool() const;
 
         bool operator!() const
@@ -442,6 +655,22 @@ namespace phylanx { namespace ir
             return !bool(*this);
         }
 
+        /// Return the memory layout of the stored data, the data pointer of
+        /// the returned span is null for sparse data.
+        detail::node_data_span<T> span() const;
+
+        /// Copy all elements (in row-major order) to the given output
+        template <typename OutIter>
+        OutIter copy_to(OutIter dest) const
+        {
+            detail::node_data_span<T> s = span();
+            if (s.data_ == nullptr)
+            {
+                return std::copy(begin(), end(), dest);
+            }
+            return s.copy(dest);
+        }
+
         using const_iterator = detail::node_data_iterator<T>;
 
         const_iterator begin() const;
@@ -466,7 +695,21 @@ namespace phylanx { namespace ir
         void serialize(hpx::serialization::input_archive& ar, unsigned);
         void serialize(hpx::serialization::output_archive& ar, unsigned);
 
+        // return the memory held by the stored data to the buffer pool
+        void recycle();
+
+        // replace compressed data with an equivalent dense matrix
+        void make_dense();
+
+        // account for the memory owned by the stored data (if counting is
+        // enabled)
+        std::int64_t owned_bytes() const;
+        void track_allocation(bool copied);
+        void track_deallocation();
+
         storage_type data_;
+        std::int64_t tracked_bytes_ = 0;
+        util::memory_counters* tracked_by_ = nullptr;
         /// \endcond
     };
 
@@ -485,9 +728,40 @@ namespace phylanx { namespace ir
         bool enabled_;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename T>
+        node_data_iterator<T>::node_data_iterator(
+                node_data<T> const& nd, std::size_t index)
+          : nd_(&nd), base_(nullptr), ptr_(nullptr), index_(index)
+          , column_(0), columns_(0), spacing_(0)
+        {
+            node_data_span<T> s = nd.span();
+            if (s.data_ != nullptr)
+            {
+                base_ = s.data_;
+                if (s.contiguous())
+                {
+                    // treat contiguous data as a single row
+                    columns_ = spacing_ = s.size_;
+                }
+                else
+                {
+                    columns_ = s.columns_;
+                    spacing_ = s.spacing_;
+                }
+                ptr_ = base_;
+                seek();
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT bool operator==(
         node_data<double> const& lhs, node_data<double> const& rhs);
+    PHYLANX_EXPORT bool operator==(
+        node_data<float> const& lhs, node_data<float> const& rhs);
     PHYLANX_EXPORT bool operator==(
         node_data<std::uint8_t> const& lhs, node_data<std::uint8_t> const& rhs);
     PHYLANX_EXPORT bool operator==(
@@ -503,6 +777,9 @@ namespace phylanx { namespace ir
     PHYLANX_EXPORT bool allclose(node_data<double> const& lhs,
         node_data<double> const& rhs, double rtol = 1e-5, double atol = 1e-8,
         bool equal_nan = false);
+    PHYLANX_EXPORT bool allclose(node_data<float> const& lhs,
+        node_data<float> const& rhs, double rtol = 1e-5, double atol = 1e-8,
+        bool equal_nan = false);
 
     inline bool allclose(node_data<std::uint8_t> const& lhs,
         node_data<std::uint8_t> const& rhs, double rtol = 0, double atol = 0,
@@ -521,6 +798,8 @@ namespace phylanx { namespace ir
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::ostream& operator<<(
         std::ostream& out, node_data<double> const& nd);
+    PHYLANX_EXPORT std::ostream& operator<<(
+        std::ostream& out, node_data<float> const& nd);
     PHYLANX_EXPORT std::ostream& operator<<(
         std::ostream& out, node_data<std::uint8_t> const& nd);
     PHYLANX_EXPORT std::ostream& operator<<(
@@ -435,6 +435,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         std::move(ops), std::move(axis));
 
                 case node_data_type_unknown: HPX_FALLTHROUGH;
+                case node_data_type_float32:
                 case node_data_type_double:
                     return this_->template cumulative_helper<double>(
                         std::move(ops), std::move(axis));
@@ -0,0 +1,121 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_FUSED_ELEMENTWISE_SEP_12_2020_0915AM)
+#define PHYLANX_PRIMITIVES_FUSED_ELEMENTWISE_SEP_12_2020_0915AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // One instruction of a fused element-wise program. The program is
+        // stored in reverse polish notation, a 'load' pushes the operand with
+        // the given index onto the evaluation stack, all other instructions
+        // combine the two topmost stack entries.
+        struct fused_instruction
+        {
+            enum opcode
+            {
+                load = 0,
+                add = 1,
+                sub = 2,
+                mul = 3,
+                div = 4
+            };
+
+            opcode op_;
+            std::size_t operand_;
+        };
+
+        using fused_program = std::vector<fused_instruction>;
+
+        // Parse the textual representation of a fused program as generated by
+        // the compiler (e.g. "0 1 * 2 +" for 'a * b + c').
+        PHYLANX_EXPORT fused_program parse_fused_program(
+            std::string const& program, std::size_t num_operands,
+            std::string const& name, std::string const& codename);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The fused element-wise primitive is generated by the compiler for
+    // expression trees built exclusively from the binary operations __add,
+    // __sub, __mul, and __div. It evaluates the whole expression in a single
+    // pass over the data, using small cache-resident blocks for the
+    // intermediate values instead of materializing full temporaries.
+    class fused_elementwise
+      : public primitive_component_base
+      , public std::enable_shared_from_this<fused_elementwise>
+    {
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static match_pattern_type const match_data;
+
+        fused_elementwise() = default;
+
+        fused_elementwise(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        bool supports_fused_evaluation(
+            primitive_arguments_type const& ops) const;
+
+        template <typename T>
+        primitive_argument_type fused0d(primitive_arguments_type&& ops) const;
+        template <typename T>
+        primitive_argument_type fused1d(primitive_arguments_type&& ops,
+            std::size_t size) const;
+        template <typename T>
+        primitive_argument_type fused2d(primitive_arguments_type&& ops,
+            std::size_t rows, std::size_t columns) const;
+        template <typename T>
+        primitive_argument_type fused3d(primitive_arguments_type&& ops,
+            std::size_t pages, std::size_t rows, std::size_t columns) const;
+
+        template <typename T>
+        primitive_argument_type fused_helper(
+            primitive_arguments_type&& ops) const;
+
+        primitive_argument_type fused(primitive_arguments_type&& ops) const;
+
+        // evaluate the program one operation at a time by delegating to the
+        // original (non-fused) primitives, used for operands the fused kernel
+        // can't handle (lists, booleans, broadcasting, annotated or sparse
+        // data, etc.)
+        primitive_argument_type unfused(primitive_arguments_type&& ops) const;
+
+        detail::fused_program program_;
+        std::size_t stack_depth_;
+    };
+
+    inline primitive create_fused_elementwise(hpx::id_type const& locality,
+        primitive_arguments_type&& operands, std::string const& name = "",
+        std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "__fused", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
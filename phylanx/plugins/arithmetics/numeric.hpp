@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -75,6 +76,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             arg_type<T>&& lhs, arg_type<T>&& rhs) const;
         template <typename T>
         primitive_argument_type numeric2d2d(args_type<T> && args) const;
+        template <typename T>
+        primitive_argument_type numeric2d2d_sparse(
+            arg_type<T>&& lhs, arg_type<T>&& rhs, std::true_type) const;
+        template <typename T>
+        primitive_argument_type numeric2d2d_sparse(
+            arg_type<T>&& lhs, arg_type<T>&& rhs, std::false_type) const;
 
         template <typename T>
         primitive_argument_type numeric3d3d(
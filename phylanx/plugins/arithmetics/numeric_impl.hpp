@@ -14,6 +14,8 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
 #include <phylanx/plugins/arithmetics/numeric.hpp>
+#include <phylanx/util/blaze_traits.hpp>
+#include <phylanx/util/buffer_pool.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/util.hpp>
@@ -24,6 +26,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -33,6 +36,48 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives
 {
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename T, typename Expr>
+        typename std::enable_if<blaze::IsSparseMatrix<Expr>::value,
+            ir::node_data<T>>::type
+        make_matrix_node_data(Expr const& expr)
+        {
+            return ir::node_data<T>{
+                typename ir::node_data<T>::sparse_storage2d_type{expr}};
+        }
+
+        template <typename T, typename Expr>
+        typename std::enable_if<!blaze::IsSparseMatrix<Expr>::value,
+            ir::node_data<T>>::type
+        make_matrix_node_data(Expr const& expr)
+        {
+            auto m = util::pooled_matrix<T>(expr.rows(), expr.columns());
+            m = expr;
+            return ir::node_data<T>{std::move(m)};
+        }
+
+        // evaluate the given expressions into (possibly recycled) memory
+        // taken from the buffer pool
+        template <typename T, typename Expr>
+        ir::node_data<T> make_vector_node_data(Expr const& expr)
+        {
+            auto v = util::pooled_vector<T>(expr.size());
+            v = expr;
+            return ir::node_data<T>{std::move(v)};
+        }
+
+        template <typename T, typename Expr>
+        ir::node_data<T> make_tensor_node_data(Expr const& expr)
+        {
+            auto t = util::pooled_tensor<T>(
+                expr.pages(), expr.rows(), expr.columns());
+            t = expr;
+            return ir::node_data<T>{std::move(t)};
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Op, typename Derived>
     numeric<Op, Derived>::numeric(primitive_arguments_type&& operands,
@@ -106,7 +151,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             // Cannot reuse the memory if an operand is a reference
             if (rhs.is_ref())
             {
-                rhs = Op{}(lhs.vector(), rhs.vector());
+                rhs = detail::make_vector_node_data<T>(
+                    Op{}(lhs.vector(), rhs.vector()));
             }
             else
             {
@@ -133,7 +179,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             {
                 if (result.is_ref())
                 {
-                    result = Op{}(result.vector(), curr.vector());
+                    result = detail::make_vector_node_data<T>(
+                        Op{}(result.vector(), curr.vector()));
                     return std::move(result);
                 }
                 else
@@ -146,18 +193,61 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename Op, typename Derived>
+    template <typename T>
+    primitive_argument_type numeric<Op, Derived>::numeric2d2d_sparse(
+        arg_type<T>&& lhs, arg_type<T>&& rhs, std::true_type) const
+    {
+        if (lhs.is_sparse() && rhs.is_sparse())
+        {
+            return primitive_argument_type{detail::make_matrix_node_data<T>(
+                Op{}(lhs.sparse_matrix(), rhs.sparse_matrix()))};
+        }
+        if (lhs.is_sparse())
+        {
+            return primitive_argument_type{detail::make_matrix_node_data<T>(
+                Op{}(lhs.sparse_matrix(), rhs.matrix()))};
+        }
+        return primitive_argument_type{detail::make_matrix_node_data<T>(
+            Op{}(lhs.matrix(), rhs.sparse_matrix()))};
+    }
+
+    template <typename Op, typename Derived>
+    template <typename T>
+    primitive_argument_type numeric<Op, Derived>::numeric2d2d_sparse(
+        arg_type<T>&& lhs, arg_type<T>&& rhs, std::false_type) const
+    {
+        // the operation does not preserve sparsity, fall back to dense data
+        if (lhs.is_sparse())
+        {
+            lhs = arg_type<T>{lhs.matrix_copy()};
+        }
+        if (rhs.is_sparse())
+        {
+            rhs = arg_type<T>{rhs.matrix_copy()};
+        }
+        return numeric2d2d<T>(std::move(lhs), std::move(rhs));
+    }
+
     template <typename Op, typename Derived>
     template <typename T>
     primitive_argument_type numeric<Op, Derived>::numeric2d2d(
         arg_type<T>&& lhs, arg_type<T>&& rhs) const
     {
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return numeric2d2d_sparse<T>(std::move(lhs), std::move(rhs),
+                traits::supports_sparse_operands<Op>{});
+        }
+
         // Avoid overwriting references, avoid memory reallocation when possible
         if (lhs.is_ref())
         {
             // Cannot reuse the memory if an operand is a reference
             if (rhs.is_ref())
             {
-                rhs = Op{}(lhs.matrix(), rhs.matrix());
+                rhs = detail::make_matrix_node_data<T>(
+                    Op{}(lhs.matrix(), rhs.matrix()));
             }
             else
             {
@@ -180,11 +270,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         return primitive_argument_type{std::accumulate(
             args.begin() + 1, args.end(), std::move(args[0]),
-            [](arg_type<T>& result, arg_type<T> const& curr) -> arg_type<T>
+            [this](arg_type<T>& result, arg_type<T>& curr) -> arg_type<T>
             {
+                if (result.is_sparse() || curr.is_sparse())
+                {
+                    return extract_node_data<T>(
+                        numeric2d2d<T>(std::move(result), std::move(curr)),
+                        name_, codename_);
+                }
+
                 if (result.is_ref())
                 {
-                    result = Op{}(result.matrix(), curr.matrix());
+                    result = detail::make_matrix_node_data<T>(
+                        Op{}(result.matrix(), curr.matrix()));
                 }
                 else
                 {
@@ -207,7 +305,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             // Cannot reuse the memory if an operand is a reference
             if (rhs.is_ref())
             {
-                rhs = Op{}(lhs.tensor(), rhs.tensor());
+                rhs = detail::make_tensor_node_data<T>(
+                    Op{}(lhs.tensor(), rhs.tensor()));
             }
             else
             {
@@ -235,7 +334,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             {
                 if (result.is_ref())
                 {
-                    result = Op{}(result.tensor(), curr.tensor());
+                    result = detail::make_tensor_node_data<T>(
+                        Op{}(result.tensor(), curr.tensor()));
                 }
                 else
                 {
@@ -357,6 +457,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 .template handle_numeric_operands_helper<std::int64_t>(
                     std::move(op1), std::move(op2));
 
+        case node_data_type_float32:
+            return derived().template handle_numeric_operands_helper<float>(
+                std::move(op1), std::move(op2));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return derived().template handle_numeric_operands_helper<double>(
@@ -469,6 +573,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 .template handle_numeric_operands_helper<std::int64_t>(
                     std::move(ops));
 
+        case node_data_type_float32:
+            return derived().template handle_numeric_operands_helper<float>(
+                std::move(ops));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return derived().template handle_numeric_operands_helper<double>(
@@ -84,6 +84,7 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, name, codename);
 
+        case execution_tree::node_data_type_float32:
         case execution_tree::node_data_type_double:
             return detail::argminmax0d<Operation>(numargs,
                 execution_tree::extract_numeric_value_strict(
@@ -186,6 +187,7 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, value, name, codename);
 
+        case execution_tree::node_data_type_float32:
         case execution_tree::node_data_type_double:
             return detail::argminmax1d<Operation>(numargs,
                 execution_tree::extract_numeric_value_strict(
@@ -425,6 +427,7 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, value, name, codename);
 
+        case execution_tree::node_data_type_float32:
         case execution_tree::node_data_type_double:
             return detail::argminmax2d<Operation>(numargs,
                 execution_tree::extract_numeric_value_strict(
@@ -657,6 +660,7 @@ namespace phylanx { namespace common {
                     std::move(args[0]), name, codename),
                 axis, name, codename);
 
+        case execution_tree::node_data_type_float32:
         case execution_tree::node_data_type_double:
             return detail::argminmax3d<Operation>(numargs,
                 execution_tree::extract_numeric_value_strict(
@@ -166,6 +166,13 @@ namespace phylanx { namespace common
                     "the operands have incompatible number of dimensions",
                     name, codename));
         }
+        if (rhs.is_sparse())
+        {
+            lhs = blaze::trans(
+                blaze::trans(lhs.vector()) * rhs.sparse_matrix());
+            return execution_tree::primitive_argument_type{std::move(lhs)};
+        }
+
         // lhs = blaze::trans(rhs.matrix()) * lhs.vector();
         lhs = blaze::trans(blaze::trans(lhs.vector()) * rhs.matrix());
         return execution_tree::primitive_argument_type{std::move(lhs)};
@@ -233,7 +240,13 @@ namespace phylanx { namespace common
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type dot2d0d(
         ir::node_data<T>&& lhs, ir::node_data<T>&& rhs)
     {
-        if (lhs.is_ref())
+        if (lhs.is_sparse())
+        {
+            // scaling keeps the sparsity pattern (shared compressed data is
+            // copied first)
+            lhs.sparse_matrix_non_ref() *= rhs.scalar();
+        }
+        else if (lhs.is_ref())
         {
             lhs = lhs.matrix() * rhs.scalar();
         }
@@ -258,6 +271,12 @@ namespace phylanx { namespace common
                     name, codename));
         }
 
+        if (lhs.is_sparse())
+        {
+            rhs = lhs.sparse_matrix() * rhs.vector();
+            return execution_tree::primitive_argument_type{std::move(rhs)};
+        }
+
         rhs = lhs.matrix() * rhs.vector();
         return execution_tree::primitive_argument_type{std::move(rhs)};
     }
@@ -280,11 +299,48 @@ namespace phylanx { namespace common
         return execution_tree::primitive_argument_type{std::move(result)};
     }
 
+    // At least one of the operands holds compressed (sparse) data. The
+    // product of two sparse matrices stays sparse, all other combinations
+    // produce a dense result.
+    template <typename T>
+    PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type
+    dot2d2d_sparse(ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
+        std::string const& name, std::string const& codename)
+    {
+        if (lhs.dimension(1) != rhs.dimension(0))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dot2d2d",
+                util::generate_error_message(
+                    "the operands have incompatible number of dimensions",
+                    name, codename));
+        }
+
+        if (lhs.is_sparse() && rhs.is_sparse())
+        {
+            typename ir::node_data<T>::sparse_storage2d_type result =
+                lhs.sparse_matrix() * rhs.sparse_matrix();
+            return execution_tree::primitive_argument_type{
+                ir::node_data<T>{std::move(result)}};
+        }
+
+        if (lhs.is_sparse())
+        {
+            return dot2d2d(lhs.sparse_matrix(), rhs.matrix(), name, codename);
+        }
+        return dot2d2d(lhs.matrix(), rhs.sparse_matrix(), name, codename);
+    }
+
     template <typename T>
     PHYLANX_COMMON_EXPORT execution_tree::primitive_argument_type dot2d2d(
         ir::node_data<T>&& lhs, ir::node_data<T>&& rhs, std::string const& name,
         std::string const& codename)
     {
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return dot2d2d_sparse(
+                std::move(lhs), std::move(rhs), name, codename);
+        }
         return dot2d2d(lhs.matrix(), rhs.matrix(), name, codename);
     }
 
@@ -351,7 +407,7 @@ namespace phylanx { namespace common
 
         case 2:
             // If is_matrix(lhs) && is_matrix(rhs)
-            return dot2d2d(lhs.matrix(), rhs.matrix(), name, codename);
+            return dot2d2d(std::move(lhs), std::move(rhs), name, codename);
 
         case 3:
             // If is_matrix(lhs) && is_tensor(rhs)
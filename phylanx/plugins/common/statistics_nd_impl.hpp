@@ -11,6 +11,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/statistics_nd.hpp>
+#include <phylanx/util/blaze_traits.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
 
 #include <hpx/assert.hpp>
@@ -113,6 +114,36 @@ namespace phylanx { namespace common {
             return f1();
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke the given function with the matrix held by the argument.
+        // Compressed data is passed on as is if the operation supports it
+        // and is densified otherwise.
+        template <typename Op, typename T, typename F>
+        execution_tree::primitive_argument_type invoke_sparse(
+            ir::node_data<T>& arg, F& f, std::true_type)
+        {
+            return f(arg.sparse_matrix());
+        }
+
+        template <typename Op, typename T, typename F>
+        execution_tree::primitive_argument_type invoke_sparse(
+            ir::node_data<T>& arg, F& f, std::false_type)
+        {
+            return f(arg.matrix_copy());
+        }
+
+        template <typename Op, typename T, typename F>
+        execution_tree::primitive_argument_type invoke_with_matrix(
+            ir::node_data<T>& arg, F&& f)
+        {
+            if (arg.is_sparse())
+            {
+                return invoke_sparse<Op>(
+                    arg, f, traits::supports_sparse_operands<Op>{});
+            }
+            return f(arg.matrix());
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <template <class T> class Op, typename T, typename Init>
         execution_tree::primitive_argument_type statistics1d(
@@ -212,44 +243,55 @@ namespace phylanx { namespace common {
             hpx::util::optional<Init> const& initial, std::string const& name,
             std::string const& codename, execution_tree::eval_context ctx)
         {
-            auto m = arg.matrix();
+            return invoke_with_matrix<Op<T>>(arg, [&](auto const& m)
+            {
+                Op<T> op{name, codename};
+                std::size_t size = 0;
 
-            Op<T> op{name, codename};
-            std::size_t size = 0;
+                Init result = Op<T>::initial();
+                if (initial)
+                {
+                    result = *initial;
+                }
 
-            Init result = Op<T>::initial();
-            if (initial)
-            {
-                result = *initial;
-            }
+                for (std::size_t i = 0; i != m.rows(); ++i)
+                {
+                    auto row = blaze::row(m, i);
+                    result = op(row, result);
+                    size += row.size();
+                }
 
-            for (std::size_t i = 0; i != m.rows(); ++i)
-            {
-                auto row = blaze::row(m, i);
-                result = op(row, result);
-                size += row.size();
-            }
+                if (keepdims)
+                {
+                    using result_type = typename Op<T>::result_type;
 
-            if (keepdims)
-            {
-                using result_type = typename Op<T>::result_type;
+                    return execution_tree::primitive_argument_type{
+                        blaze::DynamicMatrix<result_type>(
+                            1, 1, op.finalize(result, size))};
+                }
 
                 return execution_tree::primitive_argument_type{
-                    blaze::DynamicMatrix<result_type>(
-                        1, 1, op.finalize(result, size))};
-            }
-
-            return execution_tree::primitive_argument_type{
-                op.finalize(result, size)};
+                    op.finalize(result, size)};
+            });
         }
 
         template <template <class T> class Op, typename T, typename Init>
         execution_tree::primitive_argument_type statistics2d_axis0(
             ir::node_data<T>&& arg, bool keepdims,
             hpx::util::optional<Init> const& initial, std::string const& name,
-            std::string const& codename, execution_tree::eval_context ctx)
+            std::string const& codename, execution_tree::eval_context ctx);
+
+        // The columns of compressed row storage can't be accessed
+        // efficiently, the rows are accumulated instead. This relies on the
+        // operations supporting compressed data being additive.
+        template <template <class T> class Op, typename T, typename Init>
+        execution_tree::primitive_argument_type statistics2d_axis0_sparse(
+            ir::node_data<T>&& arg, bool keepdims,
+            hpx::util::optional<Init> const& initial, std::string const& name,
+            std::string const& codename, execution_tree::eval_context ctx,
+            std::true_type)
         {
-            auto m = arg.matrix();
+            auto const& m = arg.sparse_matrix();
 
             Init initial_value = Op<T>::initial();
             if (initial)
@@ -257,17 +299,22 @@ namespace phylanx { namespace common {
                 initial_value = *initial;
             }
 
+            blaze::DynamicVector<T, blaze::rowVector> sums(m.columns(), T(0));
+            for (std::size_t i = 0; i != m.rows(); ++i)
+            {
+                sums += blaze::row(m, i);
+            }
+
             using result_type = typename Op<T>::result_type;
 
+            Op<T> op{name, codename};
             if (keepdims)
             {
                 blaze::DynamicMatrix<result_type> result(1, m.columns());
                 for (std::size_t i = 0; i != m.columns(); ++i)
                 {
-                    Op<T> op{name, codename};
-                    auto col = blaze::column(m, i);
                     result(0, i) =
-                        op.finalize(op(col, initial_value), col.size());
+                        op.finalize(op(sums[i], initial_value), m.rows());
                 }
 
                 return execution_tree::primitive_argument_type{
@@ -277,54 +324,119 @@ namespace phylanx { namespace common {
             blaze::DynamicVector<result_type> result(m.columns());
             for (std::size_t i = 0; i != m.columns(); ++i)
             {
-                Op<T> op{name, codename};
-                auto col = blaze::column(m, i);
-                result[i] = op.finalize(op(col, initial_value), col.size());
+                result[i] = op.finalize(op(sums[i], initial_value), m.rows());
             }
 
             return execution_tree::primitive_argument_type{std::move(result)};
         }
 
         template <template <class T> class Op, typename T, typename Init>
-        execution_tree::primitive_argument_type statistics2d_axis1(
+        execution_tree::primitive_argument_type statistics2d_axis0_sparse(
             ir::node_data<T>&& arg, bool keepdims,
             hpx::util::optional<Init> const& initial, std::string const& name,
-            std::string const& codename, execution_tree::eval_context ctx)
+            std::string const& codename, execution_tree::eval_context ctx,
+            std::false_type)
         {
-            auto m = arg.matrix();
+            return statistics2d_axis0<Op, T>(
+                ir::node_data<T>{arg.matrix_copy()}, keepdims, initial, name,
+                codename, std::move(ctx));
+        }
 
-            Init initial_value = Op<T>::initial();
-            if (initial)
+        template <template <class T> class Op, typename T, typename Init>
+        execution_tree::primitive_argument_type statistics2d_axis0(
+            ir::node_data<T>&& arg, bool keepdims,
+            hpx::util::optional<Init> const& initial, std::string const& name,
+            std::string const& codename, execution_tree::eval_context ctx)
+        {
+            if (arg.is_sparse())
             {
-                initial_value = *initial;
+                return statistics2d_axis0_sparse<Op, T>(std::move(arg),
+                    keepdims, initial, name, codename, std::move(ctx),
+                    traits::supports_sparse_operands<Op<T>>{});
             }
 
-            using result_type = typename Op<T>::result_type;
+            return invoke_with_matrix<Op<T>>(arg, [&](auto const& m)
+            {
+                Init initial_value = Op<T>::initial();
+                if (initial)
+                {
+                    initial_value = *initial;
+                }
 
-            if (keepdims)
+                using result_type = typename Op<T>::result_type;
+
+                if (keepdims)
+                {
+                    blaze::DynamicMatrix<result_type> result(1, m.columns());
+                    for (std::size_t i = 0; i != m.columns(); ++i)
+                    {
+                        Op<T> op{name, codename};
+                        auto col = blaze::column(m, i);
+                        result(0, i) =
+                            op.finalize(op(col, initial_value), col.size());
+                    }
+
+                    return execution_tree::primitive_argument_type{
+                        std::move(result)};
+                }
+
+                blaze::DynamicVector<result_type> result(m.columns());
+                for (std::size_t i = 0; i != m.columns(); ++i)
+                {
+                    Op<T> op{name, codename};
+                    auto col = blaze::column(m, i);
+                    result[i] =
+                        op.finalize(op(col, initial_value), col.size());
+                }
+
+                return execution_tree::primitive_argument_type{
+                    std::move(result)};
+            });
+        }
+
+        template <template <class T> class Op, typename T, typename Init>
+        execution_tree::primitive_argument_type statistics2d_axis1(
+            ir::node_data<T>&& arg, bool keepdims,
+            hpx::util::optional<Init> const& initial, std::string const& name,
+            std::string const& codename, execution_tree::eval_context ctx)
+        {
+            return invoke_with_matrix<Op<T>>(arg, [&](auto const& m)
             {
-                blaze::DynamicMatrix<result_type> result(m.rows(), 1);
+                Init initial_value = Op<T>::initial();
+                if (initial)
+                {
+                    initial_value = *initial;
+                }
+
+                using result_type = typename Op<T>::result_type;
+
+                if (keepdims)
+                {
+                    blaze::DynamicMatrix<result_type> result(m.rows(), 1);
+                    for (std::size_t i = 0; i != m.rows(); ++i)
+                    {
+                        Op<T> op{name, codename};
+                        auto row = blaze::row(m, i);
+                        result(i, 0) =
+                            op.finalize(op(row, initial_value), row.size());
+                    }
+
+                    return execution_tree::primitive_argument_type{
+                        std::move(result)};
+                }
+
+                blaze::DynamicVector<result_type> result(m.rows());
                 for (std::size_t i = 0; i != m.rows(); ++i)
                 {
                     Op<T> op{name, codename};
                     auto row = blaze::row(m, i);
-                    result(i, 0) =
+                    result[i] =
                         op.finalize(op(row, initial_value), row.size());
                 }
 
                 return execution_tree::primitive_argument_type{
                     std::move(result)};
-            }
-
-            blaze::DynamicVector<result_type> result(m.rows());
-            for (std::size_t i = 0; i != m.rows(); ++i)
-            {
-                Op<T> op{name, codename};
-                auto row = blaze::row(m, i);
-                result[i] = op.finalize(op(row, initial_value), row.size());
-            }
-
-            return execution_tree::primitive_argument_type{std::move(result)};
+            });
         }
 
         template <template <class T> class Op, typename T, typename Init>
@@ -341,6 +453,11 @@ namespace phylanx { namespace common {
                 initial_value = *initial;
             }
 
+            if (arg.is_sparse())
+            {
+                arg = ir::node_data<T>{arg.matrix_copy()};
+            }
+
             auto m = arg.matrix();
             std::size_t rows = m.rows();
             std::size_t columns = m.columns();
@@ -914,6 +1031,12 @@ namespace phylanx { namespace common {
                     axis0, axis1, keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return statistics3d_slice<Op>(
+                    extract_float32_value(std::move(arg), name, codename),
+                    axis0, axis1, keepdims, std::move(initial), name, codename,
+                    std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -1342,6 +1465,12 @@ namespace phylanx { namespace common {
                     axis0, axis1, keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return statistics4d_slice<Op>(
+                    extract_float32_value(std::move(arg), name, codename),
+                    axis0, axis1, keepdims, std::move(initial), name, codename,
+                    std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -1612,6 +1741,13 @@ namespace phylanx { namespace common {
                     axis0, axis1, axis2, keepdims, std::move(initial), name,
                     codename, std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return statistics4d_tensor<Op>(
+                    execution_tree::extract_float32_value(
+                        std::move(arg), name, codename),
+                    axis0, axis1, axis2, keepdims, std::move(initial), name,
+                    codename, std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -2125,6 +2261,11 @@ namespace phylanx { namespace common {
                 axis, keepdims, std::move(initial), name, codename,
                 std::move(ctx));
 
+        case execution_tree::node_data_type_float32:
+            return detail::statisticsnd<Op>(
+                extract_float32_value(std::move(arg), name, codename), axis,
+                keepdims, std::move(initial), name, codename, std::move(ctx));
+
         case execution_tree::node_data_type_unknown:
             HPX_FALLTHROUGH;
         case execution_tree::node_data_type_double:
@@ -2221,6 +2362,12 @@ namespace phylanx { namespace common {
                         std::move(arg), name, codename),
                     std::move(initial), name, codename, std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return detail::statisticsnd<Op>(
+                    execution_tree::extract_float32_value(
+                        std::move(arg), name, codename),
+                    std::move(initial), name, codename, std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
@@ -2319,6 +2466,13 @@ namespace phylanx { namespace common {
                     keepdims, std::move(initial), name, codename,
                     std::move(ctx));
 
+            case execution_tree::node_data_type_float32:
+                return statisticsnd_flat<Op>(
+                    execution_tree::extract_float32_value(
+                        std::move(arg), name, codename),
+                    keepdims, std::move(initial), name, codename,
+                    std::move(ctx));
+
             case execution_tree::node_data_type_unknown:
                 HPX_FALLTHROUGH;
             case execution_tree::node_data_type_double:
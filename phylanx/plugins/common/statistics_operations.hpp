@@ -180,6 +180,7 @@ namespace phylanx { namespace common {
     struct statistics_sum_op
     {
         using result_type = T;
+        using supports_sparse = std::true_type;
 
         statistics_sum_op(std::string const& name, std::string const& codename)
         {
@@ -286,6 +287,7 @@ namespace phylanx { namespace common {
     struct statistics_mean_op
     {
         using result_type = double;
+        using supports_sparse = std::true_type;
 
         statistics_mean_op(std::string const& name, std::string const& codename)
           : name_(name)
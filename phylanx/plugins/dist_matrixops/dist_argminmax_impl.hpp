@@ -97,6 +97,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 return primitive_argument_type(
                     Op::template initial<std::int64_t>());
 
+            case node_data_type_float32:
             case node_data_type_double: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return primitive_argument_type(Op::template initial<double>());
@@ -131,6 +132,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                     blaze::DynamicVector<std::int64_t>(
                         size, Op::template initial<std::int64_t>()));
 
+            case node_data_type_float32:
             case node_data_type_double: HPX_FALLTHROUGH;
             case node_data_type_unknown:
                 return primitive_argument_type(blaze::DynamicVector<double>(
@@ -203,6 +205,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                         std::move(local_value), name, codename),
                     index, locs);
 
+            case node_data_type_float32:
             case node_data_type_double:
                 return detail::argminmax0d_reduce<Op>(
                     extract_scalar_numeric_value_strict(
@@ -306,6 +309,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                         std::move(local_value), name, codename),
                     indices, locs);
 
+            case node_data_type_float32:
             case node_data_type_double:
                 return detail::argminmax1d_reduce<Op>(
                     extract_numeric_value_strict(
@@ -19,6 +19,7 @@
 #include <phylanx/plugins/dist_matrixops/dist_dot_operation.hpp>
 #include <phylanx/util/distributed_matrix.hpp>
 #include <phylanx/util/distributed_vector.hpp>
+#include <phylanx/util/overlapped_fetch.hpp>
 
 #include <hpx/assert.hpp>
 #include <hpx/collectives/all_reduce.hpp>
@@ -55,6 +56,20 @@ REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_uint8_t);
 
 ////////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace dist_matrixops { namespace primitives {
+    ////////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // intersection of the local tile of lhs with a tile of rhs
+        struct dot_tile_part
+        {
+            std::uint32_t loc_;
+            execution_tree::tiling_span lhs_intersection_;
+            execution_tree::tiling_span rhs_intersection_;
+            std::size_t rhs_column_start_;
+            std::size_t rhs_column_size_;
+        };
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     template <typename T>
     execution_tree::primitive_argument_type dist_dot_operation::dot0d(
@@ -115,6 +130,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         util::distributed_vector<T> rhs_data(rhs_localities.annotation_.name_,
             rhs.vector(), rhs_localities.locality_.num_localities_,
             rhs_localities.locality_.locality_id_);
+        rhs_data.set_cache_version(rhs_localities.version_);
 
         // use the local tile of lhs and calculate the dot product with all
         // corresponding tiles of rhs
@@ -129,7 +145,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             lhs_localities.get_span(lhs_span_index);
 
         // go over all tiles of rhs vector
-        T dot_result = T{0};
+        std::vector<detail::dot_tile_part> local_parts, remote_parts;
 
         std::uint32_t loc = 0;
         for (auto const& rhs_tile : rhs_localities.tiles_)
@@ -152,37 +168,58 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             }
 
             // project global coordinates onto local ones
-            execution_tree::tiling_span lhs_intersection =
+            detail::dot_tile_part part{loc,
                 lhs_localities.project_coords(
                     lhs_localities.locality_.locality_id_, lhs_span_index,
-                    intersection);
-            execution_tree::tiling_span rhs_intersection =
+                    intersection),
                 rhs_localities.project_coords(
-                    loc, rhs_span_index, intersection);
+                    loc, rhs_span_index, intersection),
+                0, 0};
 
             if (rhs_localities.locality_.locality_id_ == loc)
             {
-                // calculate the dot product with local tile
-                dot_result += T{blaze::dot(
-                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
-                        lhs_intersection.size()),
-                    blaze::subvector(*rhs_data, rhs_intersection.start_,
-                        rhs_intersection.size()))};
+                local_parts.push_back(part);
             }
             else
             {
-                // calculate the dot product with remote tile
-                dot_result += T{blaze::dot(
-                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
-                        lhs_intersection.size()),
-                    rhs_data
-                        .fetch(loc, rhs_intersection.start_,
-                            rhs_intersection.stop_)
-                        .get())};
+                remote_parts.push_back(part);
             }
             ++loc;
         }
 
+        // request the remote tiles up front and calculate the dot product
+        // with the local tile while they are in flight
+        T dot_result = T{0};
+
+        util::overlapped_fetch(remote_parts.size(),
+            [&](std::size_t i) {
+                auto const& part = remote_parts[i];
+                return rhs_data.fetch(part.loc_, part.rhs_intersection_.start_,
+                    part.rhs_intersection_.stop_);
+            },
+            [&]() {
+                // calculate the dot product with local tile
+                for (auto const& part : local_parts)
+                {
+                    dot_result += T{blaze::dot(
+                        blaze::subvector(lhs.vector(),
+                            part.lhs_intersection_.start_,
+                            part.lhs_intersection_.size()),
+                        blaze::subvector(*rhs_data,
+                            part.rhs_intersection_.start_,
+                            part.rhs_intersection_.size()))};
+                }
+            },
+            [&](std::size_t i, blaze::DynamicVector<T>&& rhs_tile) {
+                // calculate the dot product with remote tile
+                auto const& part = remote_parts[i];
+                dot_result += T{blaze::dot(
+                    blaze::subvector(lhs.vector(),
+                        part.lhs_intersection_.start_,
+                        part.lhs_intersection_.size()),
+                    rhs_tile)};
+            });
+
         // collect overall result if left hand side vector is distributed
         if (lhs_localities.locality_.num_localities_ > 1)
         {
@@ -230,6 +267,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         util::distributed_matrix<T> rhs_data(rhs_localities.annotation_.name_,
             rhs.matrix(), rhs_localities.locality_.num_localities_,
             rhs_localities.locality_.locality_id_);
+        rhs_data.set_cache_version(rhs_localities.version_);
 
         // use the local tile of lhs and calculate the dot product with all
         // corresponding tiles of rhs
@@ -247,6 +285,8 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         blaze::DynamicVector<T> dot_result(
             rhs_localities.columns(name_, codename_), T{0});
 
+        std::vector<detail::dot_tile_part> local_parts, remote_parts;
+
         std::uint32_t loc = 0;
         std::size_t rhs_span_index = 0;
         for (auto const& rhs_tile : rhs_localities.tiles_)
@@ -257,8 +297,6 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 rhs_tile.spans_[rhs_span_index];
 
             HPX_ASSERT(rhs_tile.spans_[1].is_valid());
-            std::size_t rhs_column_start = rhs_tile.spans_[1].start_;
-            std::size_t rhs_column_size = rhs_tile.spans_[1].size();
 
             execution_tree::tiling_span intersection;
             if (!intersect(lhs_span, rhs_span, intersection))
@@ -268,41 +306,59 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             }
 
             // project global coordinates onto local ones
-            execution_tree::tiling_span lhs_intersection =
+            detail::dot_tile_part part{loc,
                 lhs_localities.project_coords(
                     lhs_localities.locality_.locality_id_, lhs_span_index,
-                    intersection);
-            execution_tree::tiling_span rhs_intersection =
+                    intersection),
                 rhs_localities.project_coords(
-                    loc, rhs_span_index, intersection);
+                    loc, rhs_span_index, intersection),
+                std::size_t(rhs_tile.spans_[1].start_),
+                std::size_t(rhs_tile.spans_[1].size())};
 
             if (rhs_localities.locality_.locality_id_ == loc)
             {
-                // calculate the dot product with local tile
-                blaze::subvector(
-                    dot_result, rhs_column_start, rhs_column_size) +=
-                    blaze::trans(
-                        blaze::submatrix(rhs.matrix(), rhs_intersection.start_,
-                            0, rhs_intersection.size(), rhs.dimension(1))) *
-                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
-                        lhs_intersection.size());
+                local_parts.push_back(part);
             }
             else
             {
-                // calculate the dot product with remote tile
-                blaze::subvector(
-                    dot_result, rhs_column_start, rhs_column_size) +=
-                    blaze::trans(
-                        rhs_data
-                            .fetch(loc, rhs_intersection.start_, 0,
-                                rhs_intersection.stop_, rhs_column_size)
-                            .get()) *
-                    blaze::subvector(lhs.vector(), lhs_intersection.start_,
-                        lhs_intersection.size());
+                remote_parts.push_back(part);
             }
             ++loc;
         }
 
+        // request the remote tiles up front and calculate the dot product
+        // with the local tile while they are in flight
+        util::overlapped_fetch(remote_parts.size(),
+            [&](std::size_t i) {
+                auto const& part = remote_parts[i];
+                return rhs_data.fetch(part.loc_, part.rhs_intersection_.start_,
+                    0, part.rhs_intersection_.stop_, part.rhs_column_size_);
+            },
+            [&]() {
+                // calculate the dot product with local tile
+                for (auto const& part : local_parts)
+                {
+                    blaze::subvector(dot_result, part.rhs_column_start_,
+                        part.rhs_column_size_) +=
+                        blaze::trans(blaze::submatrix(rhs.matrix(),
+                            part.rhs_intersection_.start_, 0,
+                            part.rhs_intersection_.size(),
+                            rhs.dimension(1))) *
+                        blaze::subvector(lhs.vector(),
+                            part.lhs_intersection_.start_,
+                            part.lhs_intersection_.size());
+                }
+            },
+            [&](std::size_t i, blaze::DynamicMatrix<T>&& rhs_tile) {
+                // calculate the dot product with remote tile
+                auto const& part = remote_parts[i];
+                blaze::subvector(dot_result, part.rhs_column_start_,
+                    part.rhs_column_size_) += blaze::trans(rhs_tile) *
+                    blaze::subvector(lhs.vector(),
+                        part.lhs_intersection_.start_,
+                        part.lhs_intersection_.size());
+            });
+
         // collect overall result if left hand side vector is distributed
         execution_tree::primitive_argument_type result;
         if (lhs_localities.locality_.num_localities_ > 1)
@@ -428,6 +484,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         util::distributed_vector<T> rhs_data(rhs_localities.annotation_.name_,
             rhs.vector(), rhs_localities.locality_.num_localities_,
             rhs_localities.locality_.locality_id_);
+        rhs_data.set_cache_version(rhs_localities.version_);
 
         // we need to get the lhs column span
         std::size_t lhs_span_index = 1;
@@ -450,6 +507,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             rhs_span_index = 1;
         }
 
+        std::vector<detail::dot_tile_part> local_parts, remote_parts;
         for (auto const& rhs_tile : rhs_localities.tiles_)
         {
             execution_tree::tiling_span const& rhs_span =
@@ -463,37 +521,56 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             }
 
             // project global coordinates onto local ones
-            execution_tree::tiling_span lhs_intersection =
+            detail::dot_tile_part part{loc,
                 lhs_localities.project_coords(
                     lhs_localities.locality_.locality_id_, lhs_span_index,
-                    intersection);
-            execution_tree::tiling_span rhs_intersection =
+                    intersection),
                 rhs_localities.project_coords(
-                    loc, rhs_span_index, intersection);
+                    loc, rhs_span_index, intersection),
+                0, 0};
 
             if (rhs_localities.locality_.locality_id_ == loc)
             {
-                // calculate the dot product with local tile
-                dot_result +=
-                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
-                        lhs.dimension(0), lhs_intersection.size()) *
-                    blaze::subvector(*rhs_data, rhs_intersection.start_,
-                        rhs_intersection.size());
+                local_parts.push_back(part);
             }
             else
             {
-                // calculate the dot product with remote tile
-                dot_result +=
-                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
-                        lhs.dimension(0), lhs_intersection.size()) *
-                    rhs_data
-                        .fetch(loc, rhs_intersection.start_,
-                            rhs_intersection.stop_)
-                        .get();
+                remote_parts.push_back(part);
             }
             ++loc;
         }
 
+        // request the remote tiles up front and calculate the dot product
+        // with the local tile while they are in flight
+        util::overlapped_fetch(remote_parts.size(),
+            [&](std::size_t i) {
+                auto const& part = remote_parts[i];
+                return rhs_data.fetch(part.loc_, part.rhs_intersection_.start_,
+                    part.rhs_intersection_.stop_);
+            },
+            [&]() {
+                // calculate the dot product with local tile
+                for (auto const& part : local_parts)
+                {
+                    dot_result += blaze::submatrix(lhs.matrix(), 0,
+                                      part.lhs_intersection_.start_,
+                                      lhs.dimension(0),
+                                      part.lhs_intersection_.size()) *
+                        blaze::subvector(*rhs_data,
+                            part.rhs_intersection_.start_,
+                            part.rhs_intersection_.size());
+                }
+            },
+            [&](std::size_t i, blaze::DynamicVector<T>&& rhs_tile) {
+                // calculate the dot product with remote tile
+                auto const& part = remote_parts[i];
+                dot_result += blaze::submatrix(lhs.matrix(), 0,
+                                  part.lhs_intersection_.start_,
+                                  lhs.dimension(0),
+                                  part.lhs_intersection_.size()) *
+                    rhs_tile;
+            });
+
         // collect overall result if left hand side vector is distributed
         execution_tree::primitive_argument_type result;
         if (lhs_localities.locality_.num_localities_ > 1)
@@ -597,6 +674,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
         util::distributed_matrix<T> rhs_data(rhs_localities.annotation_.name_,
             rhs.matrix(), rhs_localities.locality_.num_localities_,
             rhs_localities.locality_.locality_id_);
+        rhs_data.set_cache_version(rhs_localities.version_);
 
         // use the local tile of lhs and calculate the dot product with all
         // corresponding tiles of rhs, lhs column span
@@ -620,6 +698,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
 
         // 2d2d doesn't use every tile of the RHS, only those that contain
         // the rows with the same index as the columns the LHS has
+        std::vector<detail::dot_tile_part> local_parts, remote_parts;
         for (auto const& rhs_tile : rhs_localities.tiles_)
         {
             // rhs row span
@@ -627,8 +706,6 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 rhs_tile.spans_[rhs_span_index];
 
             HPX_ASSERT(rhs_tile.spans_[1].is_valid());
-            std::size_t rhs_column_start = rhs_tile.spans_[1].start_;
-            std::size_t rhs_column_size = rhs_tile.spans_[1].size();
 
             execution_tree::tiling_span intersection;
             if (!intersect(lhs_span, rhs_span, intersection))
@@ -639,42 +716,59 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
             }
 
             // project global coordinates onto local ones
-            execution_tree::tiling_span lhs_intersection =
+            detail::dot_tile_part part{loc,
                 lhs_localities.project_coords(
                     lhs_localities.locality_.locality_id_, lhs_span_index,
-                    intersection);
-
-            // What does this end up looking like? Does it start at 0?
-            execution_tree::tiling_span rhs_intersection =
+                    intersection),
                 rhs_localities.project_coords(
-                    loc, rhs_span_index, intersection);
+                    loc, rhs_span_index, intersection),
+                std::size_t(rhs_tile.spans_[1].start_),
+                std::size_t(rhs_tile.spans_[1].size())};
 
             if (rhs_localities.locality_.locality_id_ == loc)
             {
-                // calculate the dot product with local tile
-                // TODO ensure that this is generating a sub-matrix
-                blaze::submatrix(result_matrix, 0, rhs_column_start,
-                    lhs.dimension(0), rhs_column_size) +=
-                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
-                        lhs.dimension(0), lhs_intersection.size()) *
-                    blaze::submatrix(rhs.matrix(), rhs_intersection.start_, 0,
-                        rhs_intersection.size(), rhs.dimension(1));
+                local_parts.push_back(part);
             }
             else
             {
-                // calculate the dot product with remote tile
-                blaze::submatrix(result_matrix, 0, rhs_column_start,
-                    lhs.dimension(0), rhs_column_size) +=
-                    blaze::submatrix(lhs.matrix(), 0, lhs_intersection.start_,
-                        lhs.dimension(0), lhs_intersection.size()) *
-                    rhs_data
-                        .fetch(loc, rhs_intersection.start_, 0,
-                            rhs_intersection.stop_, rhs_column_size)
-                        .get();
+                remote_parts.push_back(part);
             }
             ++loc;
         }
 
+        // request the remote tiles up front and calculate the dot product
+        // with the local tile while they are in flight
+        util::overlapped_fetch(remote_parts.size(),
+            [&](std::size_t i) {
+                auto const& part = remote_parts[i];
+                return rhs_data.fetch(part.loc_, part.rhs_intersection_.start_,
+                    0, part.rhs_intersection_.stop_, part.rhs_column_size_);
+            },
+            [&]() {
+                // calculate the dot product with local tile
+                for (auto const& part : local_parts)
+                {
+                    blaze::submatrix(result_matrix, 0, part.rhs_column_start_,
+                        lhs.dimension(0), part.rhs_column_size_) +=
+                        blaze::submatrix(lhs.matrix(), 0,
+                            part.lhs_intersection_.start_, lhs.dimension(0),
+                            part.lhs_intersection_.size()) *
+                        blaze::submatrix(rhs.matrix(),
+                            part.rhs_intersection_.start_, 0,
+                            part.rhs_intersection_.size(), rhs.dimension(1));
+                }
+            },
+            [&](std::size_t i, blaze::DynamicMatrix<T>&& rhs_tile) {
+                // calculate the dot product with remote tile
+                auto const& part = remote_parts[i];
+                blaze::submatrix(result_matrix, 0, part.rhs_column_start_,
+                    lhs.dimension(0), part.rhs_column_size_) +=
+                    blaze::submatrix(lhs.matrix(), 0,
+                        part.lhs_intersection_.start_, lhs.dimension(0),
+                        part.lhs_intersection_.size()) *
+                    rhs_tile;
+            });
+
         // collect overall result if left hand side vector is distributed
         execution_tree::primitive_argument_type result;
         if (lhs_localities.locality_.num_localities_ > 1)
@@ -0,0 +1,97 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_DIST_ELEMENTWISE_OPERATION_OCT_14_2020_1140AM)
+#define PHYLANX_PRIMITIVES_DIST_ELEMENTWISE_OPERATION_OCT_14_2020_1140AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    /// Element-wise arithmetic and comparison operations on (possibly
+    /// differently) tiled arrays. If the tilings of the operands don't
+    /// match, the operand requiring the least amount of data to be moved is
+    /// realigned to the tiling of the other one before the operation is
+    /// performed on the local tiles.
+    class dist_elementwise_operation
+      : public execution_tree::primitives::primitive_component_base
+      , public std::enable_shared_from_this<dist_elementwise_operation>
+    {
+    public:
+        enum elementwise_op
+        {
+            add, sub, mul, div, gt, ge, lt, le, eq, ne
+        };
+
+    protected:
+        hpx::future<execution_tree::primitive_argument_type> eval(
+            execution_tree::primitive_arguments_type const& operands,
+            execution_tree::primitive_arguments_type const& args,
+            execution_tree::eval_context ctx) const override;
+
+    public:
+        static std::vector<execution_tree::match_pattern_type> const
+            match_data;
+
+        dist_elementwise_operation() = default;
+
+        dist_elementwise_operation(
+            execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        execution_tree::primitive_argument_type elementwise(
+            execution_tree::primitive_argument_type&& lhs,
+            execution_tree::primitive_argument_type&& rhs) const;
+
+        template <typename T>
+        execution_tree::primitive_argument_type elementwise(
+            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
+            execution_tree::localities_information&& lhs_localities,
+            execution_tree::localities_information&& rhs_localities,
+            bool lhs_annotated, bool rhs_annotated) const;
+
+        template <typename T>
+        ir::node_data<T> realign(ir::node_data<T>&& arg,
+            execution_tree::localities_information const& arg_localities,
+            execution_tree::localities_information const& anchor_localities,
+            bool needs_fetch) const;
+
+        template <typename T>
+        execution_tree::primitive_argument_type compute(
+            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
+
+        bool is_comparison() const
+        {
+            return op_ >= gt;
+        }
+
+        elementwise_op op_;
+    };
+
+    inline execution_tree::primitive create_dist_elementwise_operation(
+        hpx::id_type const& locality,
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return execution_tree::create_primitive_component(locality,
+            "__elementwise_d", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -0,0 +1,72 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_DIST_SORT_OCT_17_2020_1005AM)
+#define PHYLANX_PRIMITIVES_DIST_SORT_OCT_17_2020_1005AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    /// Sorting of tiled vectors using a parallel sort by regular sampling
+    /// (PSRS, Shi and Schaeffer, 1992). Each locality sorts its tile, the
+    /// splitters are selected from a regular sample of all sorted tiles, and
+    /// each locality collects the values falling in between two adjacent
+    /// splitters from all other localities. The result is tiled according
+    /// to the new partitioning, which holds at most twice the average number
+    /// of elements on each locality.
+    class dist_sort
+      : public execution_tree::primitives::primitive_component_base
+      , public std::enable_shared_from_this<dist_sort>
+    {
+    protected:
+        hpx::future<execution_tree::primitive_argument_type> eval(
+            execution_tree::primitive_arguments_type const& operands,
+            execution_tree::primitive_arguments_type const& args,
+            execution_tree::eval_context ctx) const override;
+
+    public:
+        static std::vector<execution_tree::match_pattern_type> const
+            match_data;
+
+        dist_sort() = default;
+
+        dist_sort(execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        execution_tree::primitive_argument_type sort1d(
+            execution_tree::primitive_argument_type&& arg) const;
+
+        template <typename T>
+        execution_tree::primitive_argument_type sort1d(ir::node_data<T>&& arg,
+            execution_tree::localities_information&& localities) const;
+
+        bool argsort_;
+    };
+
+    inline execution_tree::primitive create_dist_sort(
+        hpx::id_type const& locality,
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return execution_tree::create_primitive_component(
+            locality, "__sort_d", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -0,0 +1,84 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_DIST_SUMMA_PRODUCT_OCT_16_2020_0915AM)
+#define PHYLANX_PRIMITIVES_DIST_SUMMA_PRODUCT_OCT_16_2020_0915AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace dist_matrixops { namespace primitives {
+
+    /// Distributed matrix product using the SUMMA algorithm (van de Geijn
+    /// and Watts, 1997). Unlike cannon_product_d, the tiles of the operands
+    /// may form arbitrary (rectangular) grids. Each locality calculates the
+    /// part of the result made up by the rows of its tile of the left hand
+    /// side operand and the columns of its tile of the right hand side
+    /// operand. The inner dimension is split into panels at the tile
+    /// boundaries of both operands, the panels are fetched from their
+    /// owners while the previous ones are multiplied.
+    class dist_summa_product
+      : public execution_tree::primitives::primitive_component_base
+      , public std::enable_shared_from_this<dist_summa_product>
+    {
+    protected:
+        hpx::future<execution_tree::primitive_argument_type> eval(
+            execution_tree::primitive_arguments_type const& operands,
+            execution_tree::primitive_arguments_type const& args,
+            execution_tree::eval_context ctx) const override;
+
+    public:
+        static execution_tree::match_pattern_type const match_data;
+
+        dist_summa_product() = default;
+
+        dist_summa_product(execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        template <typename T>
+        execution_tree::primitive_argument_type product(ir::node_data<T>&& lhs,
+            ir::node_data<T>&& rhs,
+            execution_tree::localities_information&& lhs_localities,
+            execution_tree::localities_information const& rhs_localities) const;
+
+        template <typename T>
+        execution_tree::primitive_argument_type dot2d2d(ir::node_data<T>&& lhs,
+            ir::node_data<T>&& rhs,
+            execution_tree::localities_information&& lhs_localities,
+            execution_tree::localities_information const& rhs_localities) const;
+
+        execution_tree::primitive_argument_type dot2d(
+            execution_tree::primitive_argument_type&&,
+            execution_tree::primitive_argument_type&&) const;
+
+        execution_tree::primitive_argument_type dot_nd(
+            execution_tree::primitive_argument_type&& lhs,
+            execution_tree::primitive_argument_type&& rhs) const;
+    };
+
+    inline execution_tree::primitive create_dist_summa_product(
+        hpx::id_type const& locality,
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return execution_tree::create_primitive_component(
+            locality, "summa_product_d", std::move(operands), name, codename);
+    }
+}}}
+#endif
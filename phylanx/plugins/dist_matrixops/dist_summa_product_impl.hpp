@@ -0,0 +1,458 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_DIST_SUMMA_PRODUCT_IMPL_OCT_16_2020_0920AM)
+#define PHYLANX_DIST_SUMMA_PRODUCT_IMPL_OCT_16_2020_0920AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/locality_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_summa_product.hpp>
+#include <phylanx/util/distributed_matrix.hpp>
+#include <phylanx/util/overlapped_fetch.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+using std_int64_t = std::int64_t;
+using std_uint8_t = std::uint8_t;
+
+////////////////////////////////////////////////////////////////////////////////
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_int64_t);
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_uint8_t);
+
+////////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace dist_matrixops { namespace primitives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // a block of a panel of one of the operands owned by a locality
+        // (in global coordinates)
+        struct summa_part
+        {
+            std::uint32_t loc_;
+            bool lhs_;
+            std::size_t panel_;
+            execution_tree::tiling_span rows_;
+            execution_tree::tiling_span columns_;
+        };
+
+        // Find the tiles covering the given block of a distributed matrix.
+        // The block is walked along dimension 'dim', while the other
+        // dimension has to be contained in each of the tiles. Tiles owned by
+        // the preferred locality are used whenever possible.
+        inline bool summa_cover(
+            execution_tree::localities_information const& localities,
+            execution_tree::tiling_span const& rows,
+            execution_tree::tiling_span const& columns, std::size_t dim,
+            std::uint32_t preferred, bool lhs, std::size_t panel,
+            std::vector<summa_part>& parts)
+        {
+            execution_tree::tiling_span const& walked =
+                dim == 0 ? rows : columns;
+            execution_tree::tiling_span const& fixed =
+                dim == 0 ? columns : rows;
+
+            std::int64_t current = walked.start_;
+            while (current < walked.stop_)
+            {
+                std::uint32_t best = localities.locality_.num_localities_;
+                std::int64_t best_stop = current;
+
+                std::uint32_t loc = 0;
+                for (auto const& tile : localities.tiles_)
+                {
+                    auto const& wspan = tile.spans_[dim];
+                    auto const& fspan = tile.spans_[1 - dim];
+                    if (wspan.start_ <= current && wspan.stop_ > current &&
+                        fspan.start_ <= fixed.start_ &&
+                        fspan.stop_ >= fixed.stop_)
+                    {
+                        std::int64_t stop =
+                            (std::min)(wspan.stop_, walked.stop_);
+                        if (loc == preferred ||
+                            (best != preferred && stop > best_stop))
+                        {
+                            best = loc;
+                            best_stop = stop;
+                        }
+                    }
+                    ++loc;
+                }
+
+                if (best == localities.locality_.num_localities_)
+                {
+                    return false;
+                }
+
+                execution_tree::tiling_span part_span(current, best_stop);
+                parts.push_back(summa_part{best, lhs, panel,
+                    dim == 0 ? part_span : fixed,
+                    dim == 0 ? fixed : part_span});
+
+                current = best_stop;
+            }
+            return true;
+        }
+
+        // Each locality calculates the block of the result given by the rows
+        // of its left hand side tile and the columns of its right hand side
+        // tile. Verify that these blocks together cover the whole result.
+        inline bool summa_result_covered(
+            execution_tree::localities_information const& lhs_localities,
+            execution_tree::localities_information const& rhs_localities,
+            std::int64_t rows, std::int64_t columns)
+        {
+            std::size_t const num_tiles = lhs_localities.tiles_.size();
+
+            // the result is split into cells at every block boundary, each
+            // cell has to be fully contained in at least one block
+            std::set<std::int64_t> row_bounds{0, rows};
+            std::set<std::int64_t> column_bounds{0, columns};
+            for (std::size_t i = 0; i != num_tiles; ++i)
+            {
+                auto const& block_rows = lhs_localities.tiles_[i].spans_[0];
+                auto const& block_columns =
+                    rhs_localities.tiles_[i].spans_[1];
+                if (block_rows.is_valid() && block_columns.is_valid())
+                {
+                    row_bounds.insert(block_rows.start_);
+                    row_bounds.insert(block_rows.stop_);
+                    column_bounds.insert(block_columns.start_);
+                    column_bounds.insert(block_columns.stop_);
+                }
+            }
+
+            for (auto r = row_bounds.begin(), rnext = std::next(r);
+                 rnext != row_bounds.end(); ++r, ++rnext)
+            {
+                if (*r < 0 || *rnext > rows)
+                {
+                    continue;
+                }
+
+                for (auto c = column_bounds.begin(), cnext = std::next(c);
+                     cnext != column_bounds.end(); ++c, ++cnext)
+                {
+                    if (*c < 0 || *cnext > columns)
+                    {
+                        continue;
+                    }
+
+                    bool covered = false;
+                    for (std::size_t i = 0; i != num_tiles && !covered; ++i)
+                    {
+                        auto const& block_rows =
+                            lhs_localities.tiles_[i].spans_[0];
+                        auto const& block_columns =
+                            rhs_localities.tiles_[i].spans_[1];
+                        covered = block_rows.is_valid() &&
+                            block_columns.is_valid() &&
+                            block_rows.start_ <= *r &&
+                            block_rows.stop_ >= *rnext &&
+                            block_columns.start_ <= *c &&
+                            block_columns.stop_ >= *cnext;
+                    }
+
+                    if (!covered)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    execution_tree::primitive_argument_type dist_summa_product::product(
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
+        execution_tree::localities_information&& lhs_localities,
+        execution_tree::localities_information const& rhs_localities) const
+    {
+        using execution_tree::tiling_span;
+
+        std::uint32_t const num_localities =
+            lhs_localities.locality_.num_localities_;
+        std::uint32_t const locality_id = lhs_localities.locality_.locality_id_;
+
+        if (rhs_localities.locality_.num_localities_ != num_localities)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_summa_product::product",
+                generate_error_message(
+                    "the operands have to be distributed over the same "
+                    "number of localities"));
+        }
+
+        std::int64_t const inner = lhs_localities.columns(name_, codename_);
+
+        // all localities see the same tiling information, so either all of
+        // them or none of them report the error (before any communication)
+        if (!detail::summa_result_covered(lhs_localities, rhs_localities,
+                std::int64_t(lhs_localities.rows(name_, codename_)),
+                std::int64_t(rhs_localities.columns(name_, codename_))))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_summa_product::product",
+                generate_error_message(
+                    "the result blocks calculated by the localities (the rows "
+                    "of the left hand side tiles times the columns of the "
+                    "right hand side tiles) do not cover the whole result, "
+                    "use retile_d to make the tiling of the operands "
+                    "compatible"));
+        }
+
+        auto const& lhs_tile = lhs_localities.tiles_[locality_id];
+        auto const& rhs_tile = rhs_localities.tiles_[locality_id];
+
+        // this locality calculates the rows of its left hand side tile and
+        // the columns of its right hand side tile
+        tiling_span const& rows = lhs_tile.spans_[0];
+        tiling_span const& columns = rhs_tile.spans_[1];
+
+        // the panels of the inner dimension are delimited by all tile
+        // boundaries of both operands
+        std::vector<tiling_span> panels;
+        if (rows.is_valid() && columns.is_valid())
+        {
+            std::set<std::int64_t> bounds{0, inner};
+            for (auto const& tile : lhs_localities.tiles_)
+            {
+                if (tile.spans_[1].is_valid())
+                {
+                    bounds.insert(tile.spans_[1].start_);
+                    bounds.insert(tile.spans_[1].stop_);
+                }
+            }
+            for (auto const& tile : rhs_localities.tiles_)
+            {
+                if (tile.spans_[0].is_valid())
+                {
+                    bounds.insert(tile.spans_[0].start_);
+                    bounds.insert(tile.spans_[0].stop_);
+                }
+            }
+
+            for (auto it = bounds.begin(), next = std::next(it);
+                 next != bounds.end() && *next <= inner; ++it, ++next)
+            {
+                if (*it >= 0)
+                {
+                    panels.emplace_back(*it, *next);
+                }
+            }
+
+            // start with the panel owned by this locality, which makes the
+            // localities sharing rows (columns) of the result request the
+            // panels from different owners at the same time
+            auto first = std::find_if(panels.begin(), panels.end(),
+                [&](tiling_span const& panel) {
+                    return panel.start_ >= lhs_tile.spans_[1].start_;
+                });
+            std::rotate(panels.begin(), first, panels.end());
+        }
+
+        // determine which blocks of the operands are needed for each panel
+        std::vector<detail::summa_part> parts;
+        std::vector<std::size_t> local_panels;
+        std::vector<std::size_t> remote_counts(panels.size(), 0);
+
+        for (std::size_t p = 0; p != panels.size(); ++p)
+        {
+            std::size_t const first = parts.size();
+            if (!detail::summa_cover(lhs_localities, rows, panels[p], 0,
+                    locality_id, true, p, parts) ||
+                !detail::summa_cover(rhs_localities, panels[p], columns, 1,
+                    locality_id, false, p, parts))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_summa_product::product",
+                    generate_error_message(
+                        "the tiles of the operands do not cover the "
+                        "matrices"));
+            }
+
+            bool const is_local = std::all_of(parts.begin() + first,
+                parts.end(), [&](detail::summa_part const& part) {
+                    return part.loc_ == locality_id;
+                });
+
+            if (is_local)
+            {
+                local_panels.push_back(p);
+                parts.erase(parts.begin() + first, parts.end());
+            }
+            else
+            {
+                remote_counts[p] = parts.size() - first;
+            }
+        }
+
+        util::distributed_matrix<T> lhs_data(
+            "summa_lhs_" + lhs_localities.annotation_.name_, lhs.matrix(),
+            num_localities, locality_id);
+        util::distributed_matrix<T> rhs_data(
+            "summa_rhs_" + rhs_localities.annotation_.name_, rhs.matrix(),
+            num_localities, locality_id);
+
+        blaze::DynamicMatrix<T> result_matrix(
+            rows.size(), columns.size(), T{0});
+
+        // the panels are assembled from the received blocks and multiplied
+        // as soon as they are complete
+        std::map<std::size_t,
+            std::pair<blaze::DynamicMatrix<T>, blaze::DynamicMatrix<T>>>
+            pending;
+
+        util::overlapped_fetch(parts.size(),
+            [&](std::size_t i) {
+                auto const& part = parts[i];
+                auto const& localities =
+                    part.lhs_ ? lhs_localities : rhs_localities;
+                tiling_span local_rows =
+                    localities.project_coords(part.loc_, 0, part.rows_);
+                tiling_span local_columns =
+                    localities.project_coords(part.loc_, 1, part.columns_);
+                return (part.lhs_ ? lhs_data : rhs_data)
+                    .fetch(part.loc_, local_rows.start_, local_columns.start_,
+                        local_rows.stop_, local_columns.stop_);
+            },
+            [&]() {
+                // multiply the panels available locally
+                for (std::size_t p : local_panels)
+                {
+                    tiling_span lhs_columns = lhs_localities.project_coords(
+                        locality_id, 1, panels[p]);
+                    tiling_span rhs_rows = rhs_localities.project_coords(
+                        locality_id, 0, panels[p]);
+
+                    result_matrix +=
+                        blaze::submatrix(lhs.matrix(), 0, lhs_columns.start_,
+                            rows.size(), lhs_columns.size()) *
+                        blaze::submatrix(rhs.matrix(), rhs_rows.start_, 0,
+                            rhs_rows.size(), columns.size());
+                }
+            },
+            [&](std::size_t i, blaze::DynamicMatrix<T>&& block) {
+                auto const& part = parts[i];
+                tiling_span const& panel = panels[part.panel_];
+
+                auto it = pending.find(part.panel_);
+                if (it == pending.end())
+                {
+                    it = pending
+                             .emplace(part.panel_,
+                                 std::make_pair(
+                                     blaze::DynamicMatrix<T>(
+                                         rows.size(), panel.size()),
+                                     blaze::DynamicMatrix<T>(
+                                         panel.size(), columns.size())))
+                             .first;
+                }
+
+                if (part.lhs_)
+                {
+                    blaze::submatrix(it->second.first,
+                        part.rows_.start_ - rows.start_, 0,
+                        part.rows_.size(), panel.size()) = block;
+                }
+                else
+                {
+                    blaze::submatrix(it->second.second, 0,
+                        part.columns_.start_ - columns.start_, panel.size(),
+                        part.columns_.size()) = block;
+                }
+
+                if (--remote_counts[part.panel_] == 0)
+                {
+                    result_matrix += it->second.first * it->second.second;
+                    pending.erase(it);
+                }
+            });
+
+        // make sure no other locality still accesses the local tiles
+        if (num_localities > 1)
+        {
+            hpx::lcos::barrier b(
+                "barrier_summa_" + lhs_localities.annotation_.name_,
+                num_localities, locality_id);
+            b.wait();
+        }
+
+        // the result is tiled by the rows of the left hand side tiles and the
+        // columns of the right hand side tiles
+        execution_tree::primitive_argument_type result =
+            execution_tree::primitive_argument_type{std::move(result_matrix)};
+
+        execution_tree::annotation ann{ir::range("tile",
+            ir::range("columns", columns.start_, columns.stop_),
+            ir::range("rows", rows.start_, rows.stop_))};
+        execution_tree::tiling_information_2d tile_info(ann, name_, codename_);
+
+        ++lhs_localities.annotation_.generation_;
+
+        auto locality_ann = lhs_localities.locality_.as_annotation();
+        result.set_annotation(
+            execution_tree::localities_annotation(locality_ann,
+                tile_info.as_annotation(name_, codename_),
+                lhs_localities.annotation_, name_, codename_),
+            name_, codename_);
+
+        return result;
+    }
+
+    template <typename T>
+    execution_tree::primitive_argument_type dist_summa_product::dot2d2d(
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
+        execution_tree::localities_information&& lhs_localities,
+        execution_tree::localities_information const& rhs_localities) const
+    {
+        if (lhs_localities.num_dimensions() != 2 ||
+            rhs_localities.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_summa_product::dot2d2d",
+                generate_error_message(
+                    "the operands have incompatible dimensionalities"));
+        }
+
+        if (lhs_localities.columns(name_, codename_) !=
+            rhs_localities.rows(name_, codename_))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_summa_product::dot2d2d",
+                generate_error_message(
+                    "the operands have incompatible number of dimensions"));
+        }
+
+        return product(std::move(lhs), std::move(rhs),
+            std::move(lhs_localities), rhs_localities);
+    }
+}}}    // namespace phylanx::dist_matrixops::primitives
+
+#endif
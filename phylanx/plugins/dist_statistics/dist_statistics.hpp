@@ -6,6 +6,17 @@
 #if !defined(PHYLANX_PLUGINS_DIST_STATISTICS_PRIMITIVES_2020_JUN_19_1223PM)
 #define PHYLANX_PLUGINS_DIST_STATISTICS_PRIMITIVES_2020_JUN_19_1223PM
 
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/dist_statistics/all_d_operation.hpp>
+#include <phylanx/plugins/dist_statistics/any_d_operation.hpp>
+#include <phylanx/plugins/dist_statistics/max_d_operation.hpp>
+#include <phylanx/plugins/dist_statistics/mean_d_operation.hpp>
+#include <phylanx/plugins/dist_statistics/min_d_operation.hpp>
+#include <phylanx/plugins/dist_statistics/prod_d_operation.hpp>
+#include <phylanx/plugins/dist_statistics/std_d_operation.hpp>
+#include <phylanx/plugins/dist_statistics/sum_d_operation.hpp>
+#include <phylanx/plugins/dist_statistics/var_d_operation.hpp>
+
 #endif
 
 
@@ -9,6 +9,7 @@
 #define PHYLANX_PRIMITIVES_DIST_STATISTICS_2020_JUN_19_1228PM
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
@@ -97,6 +98,23 @@ namespace phylanx { namespace execution_tree { namespace primitives {
             hpx::util::optional<std::int64_t> const& axis, bool keepdims,
             primitive_argument_type&& initial, node_data_type dtype,
             eval_context ctx) const;
+
+        // reduce the tiles of a distributed array and combine the partial
+        // results of all localities
+        primitive_argument_type statistics_tiled(primitive_argument_type&& arg,
+            ir::range&& axes, bool keepdims, primitive_argument_type&& initial,
+            node_data_type dtype, eval_context ctx) const;
+
+        primitive_argument_type statistics_tiled(primitive_argument_type&& arg,
+            hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+            primitive_argument_type&& initial, node_data_type dtype,
+            eval_context ctx) const;
+
+        template <typename T>
+        primitive_argument_type statistics_tiled(ir::node_data<T>&& arg,
+            localities_information&& localities,
+            hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+            primitive_argument_type&& initial, eval_context ctx) const;
     };
 }}}    // namespace phylanx::execution_tree::primitives
 
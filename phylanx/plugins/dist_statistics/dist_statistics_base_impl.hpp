@@ -9,17 +9,23 @@
 #define PHYLANX_PRIMITIVE_DIST_STATISTICS_IMPL_2020_JUN_19_1229PM
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/common/statistics_nd.hpp>
 #include <phylanx/plugins/dist_statistics/dist_statistics_base.hpp>
+#include <phylanx/plugins/dist_statistics/dist_statistics_operations.hpp>
 
 #include <hpx/assert.hpp>
+#include <hpx/collectives/all_reduce.hpp>
 #include <hpx/datastructures/optional.hpp>
 #include <hpx/errors/throw_exception.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -34,6 +40,275 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives {
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // the spans of the given tile, padded to three dimensions (pages,
+        // rows, columns)
+        inline std::array<tiling_span, 3> dist_statistics_spans(
+            tiling_information const& tile, std::size_t ndim,
+            std::string const& name, std::string const& codename)
+        {
+            std::array<tiling_span, 3> spans{
+                tiling_span(0, 1), tiling_span(0, 1), tiling_span(0, 1)};
+
+            switch (ndim)
+            {
+            case 1:
+                spans[2] = tiling_information_1d(tile, name, codename).span_;
+                break;
+
+            case 2:
+                {
+                    tiling_information_2d tile_info(tile, name, codename);
+                    spans[1] = tile_info.spans_[0];
+                    spans[2] = tile_info.spans_[1];
+                }
+                break;
+
+            case 3:
+                {
+                    tiling_information_3d tile_info(tile, name, codename);
+                    spans[0] = tile_info.spans_[0];
+                    spans[1] = tile_info.spans_[1];
+                    spans[2] = tile_info.spans_[2];
+                }
+                break;
+
+            default:
+                break;
+            }
+            return spans;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // reduce the local tile into partial results which are combined with
+        // the partial results of all other localities
+        template <template <class T> class Op, typename T,
+            bool UsesMoments = dist_statistics_traits<Op>::uses_moments>
+        struct dist_reduction
+        {
+            using result_type = typename Op<T>::result_type;
+
+            dist_reduction(std::size_t n, std::string const& name,
+                std::string const& codename)
+              : op_(name, codename)
+              , partial_(n, Op<T>::initial())
+            {
+            }
+
+            template <typename Row>
+            void reduce_row(std::size_t i, Row& row)
+            {
+                if (row.size() != 0)
+                {
+                    partial_[i] = op_(row, partial_[i]);
+                }
+            }
+
+            void reduce_value(std::size_t i, T value)
+            {
+                partial_[i] = op_(value, partial_[i]);
+            }
+
+            void all_reduce(std::string const& basename,
+                std::uint32_t num_localities, std::uint32_t locality_id)
+            {
+                Op<T> op = op_;
+                partial_ = hpx::all_reduce(basename.c_str(),
+                    std::move(partial_),
+                    [op](blaze::DynamicVector<result_type> const& lhs,
+                        blaze::DynamicVector<result_type> const& rhs)
+                    {
+                        blaze::DynamicVector<result_type> result(lhs.size());
+                        for (std::size_t i = 0; i != lhs.size(); ++i)
+                        {
+                            result[i] = op(lhs[i], rhs[i]);
+                        }
+                        return result;
+                    },
+                    num_localities, std::size_t(-1), locality_id).get();
+            }
+
+            blaze::DynamicVector<result_type> finalize(std::int64_t count,
+                primitive_argument_type&& initial, std::string const& name,
+                std::string const& codename)
+            {
+                if (valid(initial))
+                {
+                    result_type initial_value =
+                        extract_scalar_data<result_type>(
+                            std::move(initial), name, codename);
+                    for (auto& value : partial_)
+                    {
+                        value = op_(initial_value, value);
+                    }
+                }
+
+                for (auto& value : partial_)
+                {
+                    value = op_.finalize(value, count);
+                }
+                return std::move(partial_);
+            }
+
+            Op<T> op_;
+            blaze::DynamicVector<result_type> partial_;
+        };
+
+        template <template <class T> class Op, typename T>
+        struct dist_reduction<Op, T, true>
+        {
+            using result_type = double;
+
+            dist_reduction(std::size_t n, std::string const& name,
+                std::string const& codename)
+              : moments_(n)
+              , partial_(moments_.init())
+            {
+            }
+
+            // the moments of a row are calculated using two passes over the
+            // data to avoid cancellation errors
+            template <typename Row>
+            void reduce_row(std::size_t i, Row& row)
+            {
+                if (row.size() == 0)
+                {
+                    return;
+                }
+
+                double sum = 0.0;
+                for (auto const& value : row)
+                {
+                    sum += value;
+                }
+
+                double const count = double(row.size());
+                double const mean = sum / count;
+
+                double m2 = 0.0;
+                for (auto const& value : row)
+                {
+                    double const delta = value - mean;
+                    m2 += delta * delta;
+                }
+
+                moments_.merge(partial_, i, count, mean, m2);
+            }
+
+            void reduce_value(std::size_t i, T value)
+            {
+                moments_.merge(partial_, i, 1.0, double(value), 0.0);
+            }
+
+            void all_reduce(std::string const& basename,
+                std::uint32_t num_localities, std::uint32_t locality_id)
+            {
+                partial_ = hpx::all_reduce(basename.c_str(),
+                    std::move(partial_), moments_, num_localities,
+                    std::size_t(-1), locality_id).get();
+            }
+
+            blaze::DynamicVector<result_type> finalize(std::int64_t count,
+                primitive_argument_type&& initial, std::string const& name,
+                std::string const& codename)
+            {
+                if (valid(initial))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "dist_reduction::finalize",
+                        util::generate_error_message(
+                            "an initial value is not supported for this "
+                            "distributed operation",
+                            name, codename));
+                }
+
+                std::size_t const n = moments_.n_;
+                blaze::DynamicVector<result_type> result(n);
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    if (partial_[i] == 0)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "dist_reduction::finalize",
+                            util::generate_error_message(
+                                "empty sequences are not supported", name,
+                                codename));
+                    }
+
+                    result[i] = dist_statistics_traits<Op>::finalize(
+                        partial_[i], partial_[n + i], partial_[2 * n + i]);
+                }
+                return result;
+            }
+
+            dist_moments moments_;
+            blaze::DynamicVector<double> partial_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // create the result from the flattened reduced values (stored in
+        // row-major order)
+        template <typename R>
+        primitive_argument_type dist_statistics_result(
+            blaze::DynamicVector<R>&& values,
+            std::array<std::int64_t, 3> const& extents, std::size_t ndim,
+            std::int64_t reduced, bool keepdims)
+        {
+            std::vector<std::size_t> shape;
+            for (std::size_t d = 3 - ndim; d != 3; ++d)
+            {
+                if (reduced == -1 || std::int64_t(d) == reduced)
+                {
+                    if (keepdims)
+                    {
+                        shape.push_back(1);
+                    }
+                    continue;
+                }
+                shape.push_back(extents[d]);
+            }
+
+            switch (shape.size())
+            {
+            case 0:
+                return primitive_argument_type{ir::node_data<R>{values[0]}};
+
+            case 1:
+                return primitive_argument_type{
+                    ir::node_data<R>{std::move(values)}};
+
+            case 2:
+                {
+                    blaze::DynamicMatrix<R> m(shape[0], shape[1]);
+                    for (std::size_t i = 0; i != shape[0]; ++i)
+                    {
+                        blaze::row(m, i) = blaze::trans(blaze::subvector(
+                            values, i * shape[1], shape[1]));
+                    }
+                    return primitive_argument_type{
+                        ir::node_data<R>{std::move(m)}};
+                }
+
+            default:
+                break;
+            }
+
+            blaze::DynamicTensor<R> t(shape[0], shape[1], shape[2]);
+            for (std::size_t k = 0; k != shape[0]; ++k)
+            {
+                for (std::size_t i = 0; i != shape[1]; ++i)
+                {
+                    auto slice = blaze::pageslice(t, k);
+                    blaze::row(slice, i) = blaze::trans(blaze::subvector(values,
+                        (k * shape[1] + i) * shape[2], shape[2]));
+                }
+            }
+            return primitive_argument_type{ir::node_data<R>{std::move(t)}};
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <template <class T> class Op, typename Derived>
     dist_statistics_base<Op, Derived>::dist_statistics_base(
@@ -61,9 +336,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), std::move(axes),
-            keepdims, std::move(initial), dtype, name_, codename_,
-            std::move(ctx));
+        return statistics_tiled(std::move(arg), std::move(axes), keepdims,
+            std::move(initial), dtype, std::move(ctx));
     }
 
     template <template <class T> class Op, typename Derived>
@@ -72,9 +346,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), std::move(axes),
-            keepdims, std::move(initial), dtype, name_, codename_,
-            std::move(ctx));
+        return statistics_tiled(std::move(arg), std::move(axes), keepdims,
+            std::move(initial), dtype, std::move(ctx));
     }
 
     template <template <class T> class Op, typename Derived>
@@ -83,9 +356,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), std::move(axes),
-            keepdims, std::move(initial), dtype, name_, codename_,
-            std::move(ctx));
+        return statistics_tiled(std::move(arg), std::move(axes), keepdims,
+            std::move(initial), dtype, std::move(ctx));
     }
 
     template <template <class T> class Op, typename Derived>
@@ -149,8 +421,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), axis, keepdims,
-            std::move(initial), dtype, name_, codename_, std::move(ctx));
+        return statistics_tiled(std::move(arg), axis, keepdims,
+            std::move(initial), dtype, std::move(ctx));
     }
 
     template <template <class T> class Op, typename Derived>
@@ -160,8 +432,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), axis, keepdims,
-            std::move(initial), dtype, name_, codename_, std::move(ctx));
+        return statistics_tiled(std::move(arg), axis, keepdims,
+            std::move(initial), dtype, std::move(ctx));
     }
 
     template <template <class T> class Op, typename Derived>
@@ -171,8 +443,8 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         primitive_argument_type&& initial, node_data_type dtype,
         eval_context ctx) const
     {
-        return common::statisticsnd<Op>(std::move(arg), axis, keepdims,
-            std::move(initial), dtype, name_, codename_, std::move(ctx));
+        return statistics_tiled(std::move(arg), axis, keepdims,
+            std::move(initial), dtype, std::move(ctx));
     }
 
     template <template <class T> class Op, typename Derived>
@@ -217,6 +489,274 @@ namespace phylanx { namespace execution_tree { namespace primitives {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <template <class T> class Op, typename Derived>
+    template <typename T>
+    primitive_argument_type dist_statistics_base<Op, Derived>::statistics_tiled(
+        ir::node_data<T>&& arg, localities_information&& localities,
+        hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+        primitive_argument_type&& initial, eval_context ctx) const
+    {
+        std::size_t const ndim = arg.num_dimensions();
+        std::uint32_t const loc_id = localities.locality_.locality_id_;
+        std::uint32_t const num_localities =
+            localities.locality_.num_localities_;
+
+        // all dimensions are padded to three (pages, rows, columns)
+        auto const dims = localities.dimensions(name_, codename_);
+        std::array<std::int64_t, 3> extents{1, 1, 1};
+        for (std::size_t d = 0; d != ndim; ++d)
+        {
+            extents[3 - ndim + d] = dims[d];
+        }
+
+        // the reduced dimension, -1 if all dimensions are reduced
+        std::int64_t reduced = -1;
+        if (axis)
+        {
+            std::int64_t a = *axis;
+            if (a < 0)
+            {
+                a += ndim;
+            }
+            if (a < 0 || a >= std::int64_t(ndim))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_statistics_base<Op, Derived>::statistics_tiled",
+                    generate_error_message(
+                        "the given axis is out of range", std::move(ctx)));
+            }
+            reduced = a + std::int64_t(3 - ndim);
+        }
+
+        // the reduced values are stored in row-major order of the remaining
+        // dimensions
+        std::array<std::int64_t, 3> strides{0, 0, 0};
+        std::int64_t n = 1;
+        std::int64_t count = 1;     // number of values per reduced value
+        for (std::size_t d = 3; d != 0; --d)
+        {
+            if (reduced == -1 || std::int64_t(d - 1) == reduced)
+            {
+                count *= extents[d - 1];
+            }
+            else
+            {
+                strides[d - 1] = n;
+                n *= extents[d - 1];
+            }
+        }
+
+        // values in overlapping tiles would be accounted for more than once
+        if (!dist_statistics_traits<Op>::idempotent)
+        {
+            std::int64_t total = 0;
+            for (auto const& tile : localities.tiles_)
+            {
+                auto spans = detail::dist_statistics_spans(
+                    tile, ndim, name_, codename_);
+                total += (std::max)(spans[0].size(), std::int64_t(0)) *
+                    (std::max)(spans[1].size(), std::int64_t(0)) *
+                    (std::max)(spans[2].size(), std::int64_t(0));
+            }
+
+            if (total != extents[0] * extents[1] * extents[2])
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_statistics_base<Op, Derived>::statistics_tiled",
+                    generate_error_message(
+                        "this operation does not support distributed arrays "
+                        "with overlapping tiles",
+                        std::move(ctx)));
+            }
+        }
+
+        // reduce the local tile, row by row
+        auto const local = detail::dist_statistics_spans(
+            localities.tiles_[loc_id], ndim, name_, codename_);
+        bool const reduce_rows = reduced == -1 || reduced == 2;
+
+        detail::dist_reduction<Op, T> reduction(n, name_, codename_);
+        auto reduce = [&](std::int64_t page, std::int64_t row_index,
+                          auto& row) {
+            std::int64_t const base =
+                (local[0].start_ + page) * strides[0] +
+                (local[1].start_ + row_index) * strides[1];
+
+            if (reduce_rows)
+            {
+                reduction.reduce_row(base, row);
+                return;
+            }
+
+            for (std::size_t c = 0; c != row.size(); ++c)
+            {
+                reduction.reduce_value(
+                    base + (local[2].start_ + c) * strides[2], row[c]);
+            }
+        };
+
+        switch (ndim)
+        {
+        case 1:
+            {
+                auto v = arg.vector();
+                reduce(0, 0, v);
+            }
+            break;
+
+        case 2:
+            {
+                auto m = arg.matrix();
+                for (std::size_t i = 0; i != m.rows(); ++i)
+                {
+                    auto row = blaze::row(m, i);
+                    reduce(0, i, row);
+                }
+            }
+            break;
+
+        case 3:
+            {
+                auto t = arg.tensor();
+                for (std::size_t k = 0; k != t.pages(); ++k)
+                {
+                    auto slice = blaze::pageslice(t, k);
+                    for (std::size_t i = 0; i != slice.rows(); ++i)
+                    {
+                        auto row = blaze::row(slice, i);
+                        reduce(k, i, row);
+                    }
+                }
+            }
+            break;
+
+        default:
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_statistics_base<Op, Derived>::statistics_tiled",
+                generate_error_message(
+                    "operand a has an invalid number of dimensions",
+                    std::move(ctx)));
+        }
+
+        // combine the partial results of all localities
+        if (num_localities > 1)
+        {
+            reduction.all_reduce(
+                hpx::util::format("all_reduce_{}_{}",
+                    Derived::match_data.primitive_type_,
+                    localities.annotation_.name_),
+                num_localities, loc_id);
+        }
+
+        return detail::dist_statistics_result(
+            reduction.finalize(count, std::move(initial), name_, codename_),
+            extents, ndim, reduced, keepdims);
+    }
+
+    template <template <class T> class Op, typename Derived>
+    primitive_argument_type dist_statistics_base<Op, Derived>::statistics_tiled(
+        primitive_argument_type&& arg,
+        hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+        primitive_argument_type&& initial, node_data_type dtype,
+        eval_context ctx) const
+    {
+        localities_information localities =
+            extract_localities_information(arg, name_, codename_);
+
+        if (dtype == node_data_type_unknown)
+        {
+            dtype = extract_common_type(arg);
+        }
+
+        switch (dtype)
+        {
+        case node_data_type_bool:
+            return statistics_tiled(
+                extract_boolean_value_strict(std::move(arg), name_, codename_),
+                std::move(localities), axis, keepdims, std::move(initial),
+                std::move(ctx));
+
+        case node_data_type_int64:
+            return statistics_tiled(
+                extract_integer_value_strict(std::move(arg), name_, codename_),
+                std::move(localities), axis, keepdims, std::move(initial),
+                std::move(ctx));
+
+        case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
+        case node_data_type_double:
+            return statistics_tiled(
+                extract_numeric_value(std::move(arg), name_, codename_),
+                std::move(localities), axis, keepdims, std::move(initial),
+                std::move(ctx));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_statistics_base<Op, Derived>::statistics_tiled",
+            generate_error_message(
+                "the statistics primitive requires for all arguments "
+                "to be numeric data types",
+                std::move(ctx)));
+    }
+
+    template <template <class T> class Op, typename Derived>
+    primitive_argument_type dist_statistics_base<Op, Derived>::statistics_tiled(
+        primitive_argument_type&& arg, ir::range&& axes, bool keepdims,
+        primitive_argument_type&& initial, node_data_type dtype,
+        eval_context ctx) const
+    {
+        std::size_t const dims =
+            extract_numeric_value_dimension(arg, name_, codename_);
+
+        if (axes.size() == 0)
+        {
+            // element-wise operation, the tiling is preserved
+            auto ann = arg.annotation();
+            primitive_argument_type result = common::statisticsnd<Op>(
+                std::move(arg), std::move(axes), keepdims, std::move(initial),
+                dtype, name_, codename_, std::move(ctx));
+            result.set_annotation(std::move(ann));
+            return result;
+        }
+
+        if (axes.size() == 1)
+        {
+            return statistics_tiled(std::move(arg),
+                hpx::util::optional<std::int64_t>(
+                    extract_scalar_integer_value_strict(
+                        *axes.begin(), name_, codename_)),
+                keepdims, std::move(initial), dtype, std::move(ctx));
+        }
+
+        // reducing over all axes is equivalent to reducing the flattened
+        // array
+        std::set<std::int64_t> unique_axes;
+        for (auto const& val : axes)
+        {
+            std::int64_t a =
+                extract_scalar_integer_value_strict(val, name_, codename_);
+            unique_axes.insert(a < 0 ? a + std::int64_t(dims) : a);
+        }
+
+        if (unique_axes.size() != dims || axes.size() != dims)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_statistics_base<Op, Derived>::statistics_tiled",
+                generate_error_message(
+                    "distributed reductions support either a single axis or "
+                    "all axes",
+                    std::move(ctx)));
+        }
+
+        return statistics_tiled(std::move(arg),
+            hpx::util::optional<std::int64_t>(), keepdims, std::move(initial),
+            dtype, std::move(ctx));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <template <class T> class Op, typename Derived>
     hpx::future<primitive_argument_type>
@@ -244,7 +784,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 hpx::util::optional<std::int64_t> axis;
                 bool keepdims = false;
                 primitive_argument_type initial;
-                node_data_type dtype = node_data_type_double;
+                node_data_type dtype = node_data_type_unknown;
 
                 if (args.size() > 1)
                 {
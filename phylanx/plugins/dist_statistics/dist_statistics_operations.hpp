@@ -0,0 +1,165 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_DIST_STATISTICS_OPERATIONS_2020_OCT_15_0912AM)
+#define PHYLANX_DIST_STATISTICS_OPERATIONS_2020_OCT_15_0912AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/common/statistics_operations.hpp>
+
+#include <cmath>
+#include <cstddef>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace execution_tree { namespace primitives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Describes how the partial results of a reduction calculated on the
+    /// tiles of a distributed array are combined. By default, the partial
+    /// results are combined using the reduction operation itself.
+    template <template <class T> class Op>
+    struct dist_statistics_traits
+    {
+        // the partial results are the first and second order moments
+        static constexpr bool uses_moments = false;
+
+        // values seen more than once (overlapping tiles) don't change the
+        // result
+        static constexpr bool idempotent = false;
+    };
+
+    template <>
+    struct dist_statistics_traits<common::statistics_max_op>
+    {
+        static constexpr bool uses_moments = false;
+        static constexpr bool idempotent = true;
+    };
+
+    template <>
+    struct dist_statistics_traits<common::statistics_min_op>
+    {
+        static constexpr bool uses_moments = false;
+        static constexpr bool idempotent = true;
+    };
+
+    template <>
+    struct dist_statistics_traits<common::statistics_any_op>
+    {
+        static constexpr bool uses_moments = false;
+        static constexpr bool idempotent = true;
+    };
+
+    template <>
+    struct dist_statistics_traits<common::statistics_all_op>
+    {
+        static constexpr bool uses_moments = false;
+        static constexpr bool idempotent = true;
+    };
+
+    template <>
+    struct dist_statistics_traits<common::statistics_mean_op>
+    {
+        static constexpr bool uses_moments = true;
+        static constexpr bool idempotent = false;
+
+        static double finalize(double count, double mean, double m2)
+        {
+            return mean;
+        }
+    };
+
+    template <>
+    struct dist_statistics_traits<common::statistics_var_op>
+    {
+        static constexpr bool uses_moments = true;
+        static constexpr bool idempotent = false;
+
+        static double finalize(double count, double mean, double m2)
+        {
+            return m2 / count;
+        }
+    };
+
+    template <>
+    struct dist_statistics_traits<common::statistics_stddev_op>
+    {
+        static constexpr bool uses_moments = true;
+        static constexpr bool idempotent = false;
+
+        static double finalize(double count, double mean, double m2)
+        {
+            return std::sqrt(m2 / count);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        /// The moments of n groups of values are stored in a single vector
+        /// (all counts, followed by all means, followed by all sums of
+        /// squared differences from the mean), which allows to combine them
+        /// using a single all_reduce operation.
+        struct dist_moments
+        {
+            explicit dist_moments(std::size_t n)
+              : n_(n)
+            {
+            }
+
+            blaze::DynamicVector<double> init() const
+            {
+                return blaze::DynamicVector<double>(3 * n_, 0.0);
+            }
+
+            // merge the moments of a group of values into the moments stored
+            // at index i, see Chan et al., "Updating Formulae and a Pairwise
+            // Algorithm for Computing Sample Variances" (1979)
+            void merge(blaze::DynamicVector<double>& moments, std::size_t i,
+                double count, double mean, double m2) const
+            {
+                if (count == 0)
+                {
+                    return;
+                }
+
+                double& total_count = moments[i];
+                double& total_mean = moments[n_ + i];
+                double& total_m2 = moments[2 * n_ + i];
+
+                if (total_count == 0)
+                {
+                    total_count = count;
+                    total_mean = mean;
+                    total_m2 = m2;
+                    return;
+                }
+
+                double const n = total_count + count;
+                double const delta = mean - total_mean;
+
+                total_mean += delta * count / n;
+                total_m2 += m2 + delta * delta * total_count * count / n;
+                total_count = n;
+            }
+
+            blaze::DynamicVector<double> operator()(
+                blaze::DynamicVector<double> const& lhs,
+                blaze::DynamicVector<double> const& rhs) const
+            {
+                blaze::DynamicVector<double> result = lhs;
+                for (std::size_t i = 0; i != n_; ++i)
+                {
+                    merge(result, i, rhs[i], rhs[n_ + i], rhs[2 * n_ + i]);
+                }
+                return result;
+            }
+
+            std::size_t n_;
+        };
+    }
+}}}    // namespace phylanx::execution_tree::primitives
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_STATISTICS_PROD_D_OPERATION)
+#define PHYLANX_STATISTICS_PROD_D_OPERATION
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/plugins/common/statistics_operations.hpp>
+#include <phylanx/plugins/dist_statistics/dist_statistics_base.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calculates the product of the elements of a distributed array or
+    /// the product along an axis.
+    /// \param a         The distributed array to perform prod over
+    /// \param axis      Optional. If provided, the product is calculated along
+    ///                  the provided axis.
+    /// \param keep_dims Optional. If true the result has to have the same
+    ///                  number of dimensions as a.
+    class prod_d_operation
+      : public dist_statistics_base<common::statistics_prod_op,
+            prod_d_operation>
+    {
+        using base_type =
+            dist_statistics_base<common::statistics_prod_op, prod_d_operation>;
+
+    public:
+        static match_pattern_type const match_data;
+
+        prod_d_operation() = default;
+
+        prod_d_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+    };
+
+    inline primitive create_prod_d_operation(hpx::id_type const& locality,
+        primitive_arguments_type&& operands, std::string const& name = "",
+        std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "prod_d", std::move(operands), name, codename);
+    }
+}}}    // namespace phylanx::execution_tree::primitives
+
+#endif
@@ -27,6 +27,8 @@
 #include <cstdint>
 #include <fstream>
 #include <iomanip>
+#include <istream>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -37,18 +39,35 @@
 namespace phylanx { namespace execution_tree { namespace primitives
 {
 
-    // read data from given file and return content
+    // Read the data of all lines starting in the byte range [start, stop) of
+    // the given file and return their content. A line starting before
+    // 'start' belongs to the previous range and is skipped. Only the range
+    // at the beginning of the file may contain a header line.
     inline std::tuple<std::vector<double>, std::size_t, std::size_t>
-    read_helper(std::ifstream&& infile, std::string const& filename)
+    read_range_helper(std::istream& infile, std::string const& filename,
+        std::int64_t start, std::int64_t stop)
     {
         std::string line;
-        bool header_parsed = false;
+        bool header_parsed = start != 0;
         std::vector<double> matrix_array, current_line;
         std::size_t n_rows = 0, n_cols = 0;
         std::size_t before_readln, after_readln;
 
-        while (std::getline(infile, line))
+        std::int64_t pos = start;
+        if (start != 0)
+        {
+            // resynchronize on the beginning of the next line
+            infile.seekg(start - 1);
+            if (!std::getline(infile, line))
+            {
+                return std::make_tuple(matrix_array, n_rows, n_cols);
+            }
+            pos = start - 1 + static_cast<std::int64_t>(line.size()) + 1;
+        }
+
+        while (pos < stop && std::getline(infile, line))
         {
+            pos += static_cast<std::int64_t>(line.size()) + 1;
             before_readln = matrix_array.size();
 
             auto begin_local = line.begin();
@@ -86,7 +105,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
             }
         }
 
-        return std::move(std::make_tuple(matrix_array, n_rows, n_cols));
+        return std::make_tuple(std::move(matrix_array), n_rows, n_cols);
+    }
+
+    // read data from given file and return content
+    inline std::tuple<std::vector<double>, std::size_t, std::size_t>
+    read_helper(std::ifstream&& infile, std::string const& filename)
+    {
+        return read_range_helper(infile, filename, 0,
+            (std::numeric_limits<std::int64_t>::max)());
     }
 }}}
 
@@ -0,0 +1,76 @@
+//   Copyright (c) 2020 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_SPARSE_CONVERSION_2020_OCT_02_1012AM)
+#define PHYLANX_PRIMITIVES_SPARSE_CONVERSION_2020_OCT_02_1012AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/futures/future.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    // Convert matrices between the dense and the compressed (sparse, CSR)
+    // representation.
+    class sparse_conversion
+      : public primitive_component_base
+      , public std::enable_shared_from_this<sparse_conversion>
+    {
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        enum conversion_mode
+        {
+            to_sparse_mode,
+            to_dense_mode
+        };
+
+        static std::vector<match_pattern_type> const match_data;
+
+        sparse_conversion() = default;
+
+        sparse_conversion(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        template <typename T>
+        primitive_argument_type convert(ir::node_data<T>&& arg) const;
+        primitive_argument_type convert_nd(primitive_argument_type&& arg) const;
+
+        conversion_mode mode_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline primitive create_tosparse(hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "tosparse", std::move(operands), name, codename);
+    }
+
+    inline primitive create_todense(hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "todense", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -0,0 +1,83 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_ADAPTIVE_EXECUTION_2020_OCT_09_1107AM)
+#define PHYLANX_UTIL_ADAPTIVE_EXECUTION_2020_OCT_09_1107AM
+
+#include <phylanx/config.hpp>
+
+#include <cstdint>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Online tuner deciding whether a primitive should be evaluated directly
+    /// (on the calling thread) or asynchronously (on a new HPX thread).
+    ///
+    /// The tuner maintains an exponential moving average of the evaluation
+    /// time of a primitive and compares it with the measured overhead of
+    /// spawning an HPX thread. Evaluations that are cheap relative to the
+    /// overhead are run directly, expensive ones are run asynchronously. The
+    /// task overhead is recalibrated periodically in the background.
+    ///
+    /// The tuner is enabled with the configuration setting
+    /// phylanx.adaptive_execution=1, the following settings control it:
+    ///
+    ///     phylanx.adaptive_lower_factor: evaluations faster than this
+    ///         multiple of the task overhead are run directly (default: 70)
+    ///     phylanx.adaptive_upper_factor: evaluations slower than this
+    ///         multiple of the task overhead are run asynchronously
+    ///         (default: 100)
+    ///     phylanx.adaptive_smoothing: weight of new measurements in the
+    ///         moving average (default: 0.25)
+    ///     phylanx.adaptive_sampling_interval: once decided, time every n-th
+    ///         evaluation only (default: 16)
+    ///     phylanx.adaptive_recalibration_interval: time in milliseconds
+    ///         after which the task overhead is measured again (default: 1000)
+    ///
+    class PHYLANX_EXPORT adaptive_execution
+    {
+    public:
+        /// Primitives that are always evaluated directly do not need tuning
+        explicit adaptive_execution(bool active = true)
+          : active_(active)
+        {
+        }
+
+        /// Return whether the tuner is enabled
+        static bool enabled();
+
+        /// Return the current estimate of the overhead of spawning an HPX
+        /// thread (in nanoseconds), this triggers a recalibration if needed
+        static std::int64_t task_overhead();
+
+        /// Return whether the next evaluation should be timed even if the
+        /// execution mode was already decided
+        bool sample();
+
+        /// Update the moving average from the accumulated evaluation count
+        /// and duration and return the new execution mode (1: directly,
+        /// 0: asynchronously, -1: undecided)
+        std::int64_t update(std::int64_t eval_count,
+            std::int64_t eval_duration, std::int64_t min_samples,
+            std::int64_t execute_directly);
+
+        /// Return the moving average of the evaluation time (in nanoseconds)
+        double average_duration() const
+        {
+            return average_;
+        }
+
+    private:
+        bool active_;
+        std::int64_t calls_ = 0;
+        std::int64_t samples_ = 0;
+        std::int64_t last_count_ = 0;
+        std::int64_t last_duration_ = 0;
+        double average_ = 0.0;
+    };
+}}
+
+#endif
@@ -97,6 +97,11 @@ namespace phylanx { namespace traits
     {
     };
 
+    template <typename T, bool SO>
+    struct is_matrix<blaze::CompressedMatrix<T, SO>> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     struct is_tensor<blaze::DynamicTensor<T>> : std::true_type
@@ -108,6 +113,23 @@ namespace phylanx { namespace traits
     struct is_matrix<blaze::CustomTensor<T, AF, PF, RT>> : std::true_type
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Operations that can be applied to compressed (sparse) matrices directly
+    // expose a nested type 'supports_sparse'. All other operations are
+    // applied to a dense copy of the data.
+    template <typename Op, typename Enable = void>
+    struct supports_sparse_operands : std::false_type
+    {
+    };
+
+    template <typename Op>
+    struct supports_sparse_operands<Op,
+            typename std::conditional<true, void,
+                typename Op::supports_sparse>::type>
+      : std::true_type
+    {
+    };
 }}
 
 #endif
@@ -0,0 +1,130 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_BUFFER_POOL_2020_OCT_05_0914AM)
+#define PHYLANX_UTIL_BUFFER_POOL_2020_OCT_05_0914AM
+
+#include <phylanx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Statistics collected by a buffer_pool on the calling thread
+    struct buffer_pool_statistics
+    {
+        std::int64_t hits_;         // number of recycled containers handed out
+        std::int64_t misses_;       // number of failed attempts
+        std::int64_t pooled_;       // number of containers currently pooled
+        std::int64_t bytes_;        // number of bytes currently pooled
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Maximum number of bytes kept alive by the pools of each thread (for all
+    /// container types combined). The initial value is taken from the
+    /// configuration setting 'phylanx.buffer_pool_size' (default: 64MB).
+    /// Lowering the limit does not release memory that is already pooled,
+    /// use trim_buffer_pools for this.
+    PHYLANX_EXPORT std::size_t buffer_pool_max_bytes();
+    PHYLANX_EXPORT void set_buffer_pool_max_bytes(std::size_t bytes);
+
+    /// Release pooled memory of the calling thread until the pools of all
+    /// container types hold at most the given number of bytes. Returns the
+    /// number of bytes that are still pooled.
+    PHYLANX_EXPORT std::size_t trim_buffer_pools(std::size_t bytes = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A cache of dynamic (Blaze) containers whose memory can be reused for
+    /// new results. Each (OS-)thread maintains its own pool, no locking is
+    /// required. Containers are kept in size classes (powers of two of their
+    /// capacity). Small containers are not pooled, and the number of bytes
+    /// kept alive by the pools of each thread is limited (see
+    /// buffer_pool_max_bytes).
+    ///
+    /// Note: the functions of this class never suspend the calling HPX
+    ///       thread, which guarantees that the thread local pool is not
+    ///       accessed concurrently.
+    template <typename Container>
+    class PHYLANX_EXPORT buffer_pool
+    {
+    public:
+        /// Containers with a capacity below this number of elements are not
+        /// worth pooling
+        static constexpr std::size_t min_capacity = 256;
+
+        /// Maximum number of containers kept in each size class
+        static constexpr std::size_t max_per_size_class = 4;
+
+        /// Hand the memory held by the given container to the pool of the
+        /// calling thread. The container is left empty if the memory was
+        /// accepted.
+        static void recycle(Container& c);
+
+        /// Return a container with room for at least the given number of
+        /// elements. The container is default constructed if no suitable
+        /// memory was pooled, its contents are unspecified otherwise.
+        static Container acquire(std::size_t capacity);
+
+        /// Release the largest containers pooled by the calling thread until
+        /// the pools of all container types hold at most the given number of
+        /// bytes. Returns the number of bytes that are still pooled.
+        static std::size_t trim(std::size_t bytes);
+
+        /// Retrieve (and optionally reset) the statistics of the pool
+        /// associated with the calling thread.
+        static buffer_pool_statistics statistics(bool reset);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // number of elements Blaze allocates for a row of the given length
+        template <typename T>
+        inline std::size_t padded_columns(std::size_t columns)
+        {
+            return (blaze::usePadding && blaze::IsVectorizable<T>::value) ?
+                blaze::nextMultiple(columns, blaze::SIMDTrait<T>::size) :
+                columns;
+        }
+    }
+
+    /// Create vectors, matrices, and tensors of the given dimensions using
+    /// pooled memory, if possible. The elements are not initialized.
+    template <typename T>
+    blaze::DynamicVector<T> pooled_vector(std::size_t size)
+    {
+        auto v = buffer_pool<blaze::DynamicVector<T>>::acquire(
+            detail::padded_columns<T>(size));
+        v.resize(size, false);
+        return v;
+    }
+
+    template <typename T>
+    blaze::DynamicMatrix<T> pooled_matrix(
+        std::size_t rows, std::size_t columns)
+    {
+        auto m = buffer_pool<blaze::DynamicMatrix<T>>::acquire(
+            rows * detail::padded_columns<T>(columns));
+        m.resize(rows, columns, false);
+        return m;
+    }
+
+    template <typename T>
+    blaze::DynamicTensor<T> pooled_tensor(
+        std::size_t pages, std::size_t rows, std::size_t columns)
+    {
+        auto t = buffer_pool<blaze::DynamicTensor<T>>::acquire(
+            pages * rows * detail::padded_columns<T>(columns));
+        t.resize(pages, rows, columns, false);
+        return t;
+    }
+}}
+
+#endif
@@ -9,6 +9,8 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/util/serialization/blaze.hpp>
+#include <phylanx/util/tile_cache.hpp>
+#include <phylanx/util/transfer_codec.hpp>
 
 #include <hpx/assert.hpp>
 #include <hpx/errors/throw_exception.hpp>
@@ -26,10 +28,12 @@
 #include <hpx/thread_support/unlock_guard.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <blaze/Math.h>
 
@@ -95,6 +99,26 @@ namespace phylanx { namespace util { namespace server
 
         HPX_DEFINE_COMPONENT_ACTION(distributed_matrix_part, fetch_part);
 
+        transfer_block fetch_part_encoded(std::size_t start_row,
+            std::size_t start_column, std::size_t stop_row,
+            std::size_t stop_column, transfer_codec codec) const
+        {
+            std::size_t const rows = stop_row - start_row;
+            std::size_t const columns = stop_column - start_column;
+
+            // the rows of the data are padded, encode a contiguous copy
+            std::vector<T> part(rows * columns);
+            blaze::CustomMatrix<T, blaze::unaligned, blaze::unpadded> view(
+                part.data(), rows, columns);
+            view = blaze::submatrix(
+                data_, start_row, start_column, rows, columns);
+
+            return encode_block(part.data(), part.size(), codec);
+        }
+
+        HPX_DEFINE_COMPONENT_ACTION(
+            distributed_matrix_part, fetch_part_encoded);
+
     private:
         reference_type data_;
     };
@@ -108,7 +132,12 @@ namespace phylanx { namespace util { namespace server
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         phylanx::util::server::distributed_matrix_part<                        \
             type>::fetch_part_action,                                          \
-        HPX_PP_CAT(__distributed_matrix_part_fetch_part_action_, type))        \
+        HPX_PP_CAT(__distributed_matrix_part_fetch_part_action_, type));       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        phylanx::util::server::distributed_matrix_part<                        \
+            type>::fetch_part_encoded_action,                                  \
+        HPX_PP_CAT(__distributed_matrix_part_fetch_part_encoded_action_,       \
+            type))                                                             \
     /**/
 
 #define REGISTER_DISTRIBUTED_MATRIX(type)                                      \
@@ -118,6 +147,10 @@ namespace phylanx { namespace util { namespace server
     HPX_REGISTER_ACTION(phylanx::util::server::distributed_matrix_part<type>:: \
             fetch_part_action,                                                 \
         HPX_PP_CAT(__distributed_matrix_part_fetch_part_action_, type));       \
+    HPX_REGISTER_ACTION(phylanx::util::server::distributed_matrix_part<type>:: \
+            fetch_part_encoded_action,                                         \
+        HPX_PP_CAT(__distributed_matrix_part_fetch_part_encoded_action_,       \
+            type));                                                            \
     typedef ::hpx::components::component<                                      \
         phylanx::util::server::distributed_matrix_part<type>>                  \
         HPX_PP_CAT(__distributed_matrix_part_, type);                          \
@@ -160,16 +193,22 @@ namespace phylanx { namespace util
         /// \param sub_localities The sub_localities accepts a list of locality
         ///             index. By default, it is initialized to a list of all
         ///             provided locality index.
+        /// \param codec The encoding applied to the data fetched from the
+        ///             other parts of this distributed_matrix, by default the
+        ///             one configured by 'phylanx.transfer_codec'.
         ///
         distributed_matrix(std::string basename, reference_type const& data,
                 std::size_t num_sites = std::size_t(-1),
-                std::size_t this_site = std::size_t(-1))
+                std::size_t this_site = std::size_t(-1),
+                transfer_codec codec = default_transfer_codec())
           : num_sites_(num_sites == std::size_t(-1) ?
                     hpx::get_num_localities(hpx::launch::sync) :
                     num_sites)
           , this_site_(this_site == std::size_t(-1) ? hpx::get_locality_id() :
                                                       this_site)
-          , basename_("dist_matrix_" + std::move(basename))
+          , name_(std::move(basename))
+          , basename_("dist_matrix_" + name_)
+          , codec_(codec)
         {
             if (this_site_ >= num_sites_)
             {
@@ -199,16 +238,22 @@ namespace phylanx { namespace util
         /// \param sub_localities The sub_localities accepts a list of locality
         ///             index. By default, it is initialized to a list of all
         ///             provided locality index.
+        /// \param codec The encoding applied to the data fetched from the
+        ///             other parts of this distributed_matrix, by default the
+        ///             one configured by 'phylanx.transfer_codec'.
         ///
         distributed_matrix(std::string basename, reference_type&& data,
                 std::size_t num_sites = std::size_t(-1),
-                std::size_t this_site = std::size_t(-1))
+                std::size_t this_site = std::size_t(-1),
+                transfer_codec codec = default_transfer_codec())
           : num_sites_(num_sites == std::size_t(-1) ?
                     hpx::get_num_localities(hpx::launch::sync) :
                     num_sites)
           , this_site_(this_site == std::size_t(-1) ? hpx::get_locality_id() :
                                                       this_site)
-          , basename_("dist_matrix_" + std::move(basename))
+          , name_(std::move(basename))
+          , basename_("dist_matrix_" + name_)
+          , codec_(codec)
         {
             if (this_site_ >= num_sites_)
             {
@@ -255,6 +300,31 @@ namespace phylanx { namespace util
             return &**ptr_;
         }
 
+        /// Select the encoding applied to the data fetched by (subsequent)
+        /// invocations of fetch() for parts of this distributed_matrix
+        void set_transfer_codec(transfer_codec codec)
+        {
+            codec_ = codec;
+        }
+
+        transfer_codec get_transfer_codec() const
+        {
+            return codec_;
+        }
+
+        /// Allow (subsequent) invocations of fetch() for remote parts of this
+        /// distributed_matrix to be served from the locality's tile cache
+        /// (see util::enable_tile_cache). The version has to identify the
+        /// data of all parts, e.g. the version of the annotation of the
+        /// local part of the distributed array (localities_information::
+        /// version_). The generation of the annotation is not sufficient as
+        /// different data may be annotated with the same name and generation.
+        /// A negative version disables caching.
+        void set_cache_version(std::int64_t version)
+        {
+            cache_version_ = version;
+        }
+
         /// fetch() function is an asynchronous function. This returns a future
         /// of a copy of the instance of this distributed_matrix associated with
         /// the given locality index. The provided locality index must be valid
@@ -287,16 +357,60 @@ namespace phylanx { namespace util
         {
             /// \cond NOINTERNAL
             HPX_ASSERT(!!ptr_);
-            using action_type =
-                typename server::distributed_matrix_part<T>::fetch_part_action;
 
-            return hpx::async<action_type>(get_part_id(idx), start_row,
-                start_column, stop_row, stop_column);
+            // local data is never cached
+            if (idx == this_site_)
+            {
+                return fetch_part(idx, start_row, start_column, stop_row,
+                    stop_column);
+            }
+
+            return cached_fetch<data_type>(name_, cache_version_,
+                std::uint32_t(idx),
+                {start_row, stop_row, start_column, stop_column, 0, 1},
+                [&]() {
+                    return fetch_part(idx, start_row, start_column, stop_row,
+                        stop_column);
+                });
             /// \endcond
         }
 
     private:
         /// \cond NOINTERNAL
+        hpx::future<data_type> fetch_part(std::size_t idx,
+            std::size_t start_row, std::size_t start_column,
+            std::size_t stop_row, std::size_t stop_column) const
+        {
+            // local data is never encoded
+            if (codec_ == transfer_codec::none || idx == this_site_)
+            {
+                using action_type = typename server::distributed_matrix_part<
+                    T>::fetch_part_action;
+
+                return hpx::async<action_type>(get_part_id(idx), start_row,
+                    start_column, stop_row, stop_column);
+            }
+
+            using action_type = typename server::distributed_matrix_part<
+                T>::fetch_part_encoded_action;
+
+            std::size_t const rows = stop_row - start_row;
+            std::size_t const columns = stop_column - start_column;
+
+            return hpx::async<action_type>(get_part_id(idx), start_row,
+                start_column, stop_row, stop_column, codec_)
+                .then(hpx::launch::sync,
+                    [rows, columns](hpx::future<transfer_block>&& f)
+                    {
+                        std::vector<T> part(rows * columns);
+                        decode_block(f.get(), part.data(), part.size());
+
+                        return data_type{blaze::CustomMatrix<T,
+                            blaze::unaligned, blaze::unpadded>(
+                            part.data(), rows, columns)};
+                    });
+        }
+
         template <typename Arg>
         hpx::id_type create_and_register_server(Arg&& value)
         {
@@ -356,7 +470,10 @@ namespace phylanx { namespace util
     private:
         std::size_t const num_sites_;
         std::size_t const this_site_;
+        std::string const name_;
         std::string const basename_;
+        transfer_codec codec_;
+        std::int64_t cache_version_ = -1;
         std::shared_ptr<server::distributed_matrix_part<T>> ptr_;
 
         mutable hpx::lcos::local::spinlock part_ids_mtx_;
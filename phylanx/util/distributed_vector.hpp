@@ -9,6 +9,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/util/serialization/blaze.hpp>
+#include <phylanx/util/tile_cache.hpp>
 
 #include <hpx/assert.hpp>
 #include <hpx/errors/throw_exception.hpp>
@@ -26,6 +27,7 @@
 #include <hpx/thread_support/unlock_guard.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -166,7 +168,8 @@ namespace phylanx { namespace util
                     num_sites)
           , this_site_(this_site == std::size_t(-1) ? hpx::get_locality_id() :
                                                       this_site)
-          , basename_("dist_vector_" + std::move(basename))
+          , name_(std::move(basename))
+          , basename_("dist_vector_" + name_)
         {
             if (this_site_ >= num_sites_)
             {
@@ -205,7 +208,8 @@ namespace phylanx { namespace util
                     num_sites)
           , this_site_(this_site == std::size_t(-1) ? hpx::get_locality_id() :
                                                       this_site)
-          , basename_("dist_vector_" + std::move(basename))
+          , name_(std::move(basename))
+          , basename_("dist_vector_" + name_)
         {
             if (this_site_ >= num_sites_)
             {
@@ -286,10 +290,33 @@ namespace phylanx { namespace util
             using action_type =
                 typename server::distributed_vector_part<T>::fetch_part_action;
 
-            return hpx::async<action_type>(get_part_id(idx), start, stop);
+            // local data is never cached
+            if (idx == this_site_)
+            {
+                return hpx::async<action_type>(get_part_id(idx), start, stop);
+            }
+
+            return cached_fetch<data_type>(name_, cache_version_,
+                std::uint32_t(idx), {start, stop, 0, 1, 0, 1}, [&]() {
+                    return hpx::async<action_type>(
+                        get_part_id(idx), start, stop);
+                });
             /// \endcond
         }
 
+        /// Allow (subsequent) invocations of fetch() for remote parts of this
+        /// distributed_vector to be served from the locality's tile cache
+        /// (see util::enable_tile_cache). The version has to identify the
+        /// data of all parts, e.g. the version of the annotation of the
+        /// local part of the distributed array (localities_information::
+        /// version_). The generation of the annotation is not sufficient as
+        /// different data may be annotated with the same name and generation.
+        /// A negative version disables caching.
+        void set_cache_version(std::int64_t version)
+        {
+            cache_version_ = version;
+        }
+
     private:
         /// \cond NOINTERNAL
         template <typename Arg>
@@ -351,7 +378,9 @@ namespace phylanx { namespace util
     private:
         std::size_t const num_sites_;
         std::size_t const this_site_;
+        std::string const name_;
         std::string const basename_;
+        std::int64_t cache_version_ = -1;
         std::shared_ptr<server::distributed_vector_part<T>> ptr_;
 
         mutable hpx::lcos::local::spinlock part_ids_mtx_;
@@ -0,0 +1,70 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_EXECUTION_TRACE_2020_OCT_17_0710PM)
+#define PHYLANX_UTIL_EXECUTION_TRACE_2020_OCT_17_0710PM
+
+#include <phylanx/config.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A single evaluation of a primitive as recorded by the execution trace
+    struct execution_trace_event
+    {
+        std::uint64_t begin_;               // [ns]
+        std::uint64_t end_;                 // [ns]
+        std::uint32_t name_;                // see execution_trace_name
+        std::uint32_t worker_;              // worker thread that started it
+                                            // (see execution_trace_worker)
+        std::int32_t ndim_;                 // -1 if the result is not an array
+                                            // (shape_ holds its dimensions)
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> shape_;
+    };
+
+    /// Enable or disable recording the execution trace. The trace is
+    /// initially enabled if the configuration setting
+    /// 'phylanx.execution_trace' is set to '1' (default: '0'). Each thread
+    /// keeps the most recent 'phylanx.execution_trace_size' events (default:
+    /// 65536).
+    PHYLANX_EXPORT void enable_execution_trace(bool enable);
+    PHYLANX_EXPORT bool execution_trace_enabled();
+
+    /// Return the identifier used to refer to the given primitive from the
+    /// recorded events, 'name' is shown as the name of the events.
+    PHYLANX_EXPORT std::uint32_t execution_trace_name(std::string const& name,
+        std::string const& primitive, std::string const& codename);
+
+    /// The worker thread number recorded for events started on threads not
+    /// managed by HPX
+    constexpr std::uint32_t execution_trace_no_worker = std::uint32_t(-1);
+
+    /// Return the number of the worker thread executing the caller, or
+    /// execution_trace_no_worker if it is not executed by an HPX thread
+    PHYLANX_EXPORT std::uint32_t execution_trace_worker();
+
+    /// Add an event to the trace buffer of the calling thread
+    PHYLANX_EXPORT void record_execution_trace_event(
+        execution_trace_event const& event);
+
+    /// Discard all events recorded so far
+    PHYLANX_EXPORT void clear_execution_trace();
+
+    /// Return the events recorded on this locality in the Chrome trace event
+    /// format (as understood by chrome://tracing and Perfetto). Events that
+    /// are recorded while the trace is being collected may be missing.
+    PHYLANX_EXPORT std::string execution_trace_json();
+
+    /// Write the events recorded on this locality to the given file in the
+    /// Chrome trace event format.
+    PHYLANX_EXPORT void dump_execution_trace(std::string const& filename);
+}}
+
+#endif
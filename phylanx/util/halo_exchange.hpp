@@ -0,0 +1,169 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_HALO_EXCHANGE_2020_OCT_16_1105AM)
+#define PHYLANX_UTIL_HALO_EXCHANGE_2020_OCT_16_1105AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/util/distributed_matrix.hpp>
+#include <phylanx/util/distributed_tensor.hpp>
+#include <phylanx/util/distributed_vector.hpp>
+
+#include <hpx/include/lcos.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A part of the halo of the local tile of a distributed array, i.e. the
+    /// elements of a neighbouring tile that are needed to calculate the
+    /// values at the boundary of the local tile (stencils, convolutions).
+    struct halo_part
+    {
+        std::uint32_t loc_;                     // owning locality
+        execution_tree::tiling_span span_;      // global coordinates
+        execution_tree::tiling_span local_;     // coordinates in owning tile
+    };
+
+    /// Return the parts of the other tiles making up the given halo of the
+    /// local tile along dimension 'dim' (an index into the tiling spans).
+    /// The parts of the halo outside of [0, size) are skipped, those are
+    /// left to the caller (usually they are zero padded). The tiles are
+    /// required to be split along 'dim' only.
+    PHYLANX_EXPORT std::vector<halo_part> halo_parts(
+        execution_tree::localities_information const& localities,
+        std::size_t dim, std::int64_t size,
+        execution_tree::tiling_span const& halo, std::string const& name,
+        std::string const& codename);
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename Data, typename Fetch, typename Assign>
+        hpx::future<Data> fetch_halo(std::vector<halo_part>&& parts,
+            Data&& result, Fetch&& fetch, Assign&& assign)
+        {
+            if (parts.empty())
+            {
+                return hpx::make_ready_future(std::move(result));
+            }
+
+            std::vector<hpx::future<Data>> data;
+            data.reserve(parts.size());
+            for (auto const& part : parts)
+            {
+                data.push_back(fetch(part));
+            }
+
+            return hpx::dataflow(hpx::launch::sync,
+                [parts = std::move(parts), result = std::move(result),
+                    assign = std::forward<Assign>(assign)](
+                    std::vector<hpx::future<Data>>&& data) mutable -> Data {
+                    for (std::size_t i = 0; i != parts.size(); ++i)
+                    {
+                        assign(result, parts[i], data[i].get());
+                    }
+                    return std::move(result);
+                },
+                std::move(data));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Asynchronously fetch the given halo (in global coordinates) of the
+    /// local tile of a distributed vector. Elements outside of the vector
+    /// are set to zero.
+    template <typename T>
+    hpx::future<blaze::DynamicVector<T>> fetch_halo(
+        distributed_vector<T> const& data,
+        execution_tree::localities_information const& localities,
+        execution_tree::tiling_span const& halo, std::string const& name,
+        std::string const& codename)
+    {
+        // row vectors are tiled along their second dimension
+        std::size_t const dim = localities.has_span(0) ? 0 : 1;
+        auto parts = halo_parts(localities, dim,
+            localities.size(name, codename), halo, name, codename);
+
+        return detail::fetch_halo(std::move(parts),
+            blaze::DynamicVector<T>(halo.size(), T(0)),
+            [&](halo_part const& part) {
+                return data.fetch(
+                    part.loc_, part.local_.start_, part.local_.stop_);
+            },
+            [halo](blaze::DynamicVector<T>& result, halo_part const& part,
+                blaze::DynamicVector<T>&& value) {
+                blaze::subvector(result, part.span_.start_ - halo.start_,
+                    part.span_.size()) = value;
+            });
+    }
+
+    /// Asynchronously fetch the given halo rows (in global coordinates) of
+    /// the local tile of a row-tiled distributed matrix. Rows outside of the
+    /// matrix are set to zero.
+    template <typename T>
+    hpx::future<blaze::DynamicMatrix<T>> fetch_halo(
+        distributed_matrix<T> const& data,
+        execution_tree::localities_information const& localities,
+        execution_tree::tiling_span const& halo, std::string const& name,
+        std::string const& codename)
+    {
+        auto parts = halo_parts(localities, 0,
+            localities.rows(name, codename), halo, name, codename);
+
+        std::size_t const columns = (*data).columns();
+        return detail::fetch_halo(std::move(parts),
+            blaze::DynamicMatrix<T>(halo.size(), columns, T(0)),
+            [&](halo_part const& part) {
+                return data.fetch(part.loc_, part.local_.start_, 0,
+                    part.local_.stop_, columns);
+            },
+            [halo, columns](blaze::DynamicMatrix<T>& result,
+                halo_part const& part, blaze::DynamicMatrix<T>&& value) {
+                blaze::submatrix(result, part.span_.start_ - halo.start_, 0,
+                    part.span_.size(), columns) = value;
+            });
+    }
+
+    /// Asynchronously fetch the given halo rows (in global coordinates) of
+    /// the local tile of a row-tiled distributed tensor. Rows outside of the
+    /// tensor are set to zero.
+    template <typename T>
+    hpx::future<blaze::DynamicTensor<T>> fetch_halo(
+        distributed_tensor<T> const& data,
+        execution_tree::localities_information const& localities,
+        execution_tree::tiling_span const& halo, std::string const& name,
+        std::string const& codename)
+    {
+        auto parts = halo_parts(localities, 1,
+            localities.rows(name, codename), halo, name, codename);
+
+        std::size_t const pages = (*data).pages();
+        std::size_t const columns = (*data).columns();
+        return detail::fetch_halo(std::move(parts),
+            blaze::DynamicTensor<T>(pages, halo.size(), columns, T(0)),
+            [&](halo_part const& part) {
+                return data.fetch(part.loc_, 0, part.local_.start_, 0, pages,
+                    part.local_.stop_, columns);
+            },
+            [halo, pages, columns](blaze::DynamicTensor<T>& result,
+                halo_part const& part, blaze::DynamicTensor<T>&& value) {
+                blaze::subtensor(result, 0, part.span_.start_ - halo.start_,
+                    0, pages, part.span_.size(), columns) = value;
+            });
+    }
+}}
+
+#endif
@@ -0,0 +1,124 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_MEMORY_COUNTERS_2020_OCT_07_0245PM)
+#define PHYLANX_UTIL_MEMORY_COUNTERS_2020_OCT_07_0245PM
+
+#include <phylanx/config.hpp>
+
+#include <hpx/futures/future.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/memory/intrusive_ptr.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Memory statistics of the node_data instances created while a primitive
+    /// is being evaluated. The counters are reference counted, node_data
+    /// instances keep the counters they were accounted to alive until they
+    /// release their memory.
+    struct memory_counters
+    {
+        std::atomic<std::int64_t> allocated_bytes_{0};  // owned by new node_data
+        std::atomic<std::int64_t> copied_bytes_{0};     // copied into node_data
+        std::atomic<std::int64_t> live_bytes_{0};   // still owned by node_data
+        std::atomic<std::int64_t> peak_bytes_{0};   // high-water of live_bytes_
+
+        std::atomic<std::int64_t> count_{0};
+    };
+
+    inline void intrusive_ptr_add_ref(memory_counters* p)
+    {
+        ++p->count_;
+    }
+
+    inline void intrusive_ptr_release(memory_counters* p)
+    {
+        if (0 == --p->count_)
+        {
+            delete p;
+        }
+    }
+
+    /// Return the counters the node_data memory operations performed by the
+    /// calling HPX thread are attributed to (if any).
+    PHYLANX_EXPORT memory_counters* current_memory_counters();
+
+    /// Attribute the node_data memory operations performed by the calling
+    /// HPX thread to the given counters for the lifetime of this object.
+    class PHYLANX_EXPORT scoped_memory_counters
+    {
+    public:
+        scoped_memory_counters(memory_counters& counters, bool enabled = true);
+        ~scoped_memory_counters();
+
+        scoped_memory_counters(scoped_memory_counters const&) = delete;
+        scoped_memory_counters& operator=(
+            scoped_memory_counters const&) = delete;
+
+    private:
+        hpx::threads::thread_id_type id_;
+        std::size_t previous_;
+    };
+
+    /// Return a future that becomes ready with the given one. Continuations
+    /// attached to the returned future that are executed synchronously are
+    /// attributed to the counters of the calling thread, even if the given
+    /// future is made ready by a different thread.
+    template <typename T>
+    hpx::future<T> attribute_continuations(hpx::future<T>&& f)
+    {
+        memory_counters* counters = current_memory_counters();
+        if (counters == nullptr || f.is_ready())
+        {
+            return std::move(f);
+        }
+
+        hpx::lcos::local::promise<T> p;
+        hpx::future<T> result = p.get_future();
+
+        f.then(hpx::launch::sync,
+            [p = std::move(p), counters = hpx::intrusive_ptr<memory_counters>(
+                                   counters)](hpx::future<T>&& f) mutable
+            {
+                scoped_memory_counters scope(*counters);
+                try
+                {
+                    p.set_value(f.get());
+                }
+                catch (...)
+                {
+                    p.set_exception(std::current_exception());
+                }
+            });
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Account for memory owned by a node_data instance. This is invoked by
+    /// node_data if counting is enabled (see node_data<T>::enable_counts).
+    /// The allocation is attributed to the counters of the calling thread,
+    /// these are returned (with their reference count incremented) and have
+    /// to be passed to track_deallocation once the memory is released.
+    PHYLANX_EXPORT memory_counters* track_allocation(
+        std::int64_t bytes, bool copied);
+    PHYLANX_EXPORT void track_deallocation(
+        std::int64_t bytes, memory_counters* counters);
+
+    /// Retrieve the accumulated memory statistics of all node_data instances
+    PHYLANX_EXPORT std::int64_t allocated_bytes(bool reset);
+    PHYLANX_EXPORT std::int64_t copied_bytes(bool reset);
+    PHYLANX_EXPORT std::int64_t live_bytes(bool reset);
+}}
+
+#endif
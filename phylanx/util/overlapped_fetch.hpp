@@ -0,0 +1,90 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_OVERLAPPED_FETCH_2020_OCT_13_1012AM)
+#define PHYLANX_UTIL_OVERLAPPED_FETCH_2020_OCT_13_1012AM
+
+#include <phylanx/config.hpp>
+
+#include <hpx/include/lcos.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Return the maximum number of remote fetches kept in flight by
+    /// overlapped_fetch, as configured by 'phylanx.fetch_window' (default:
+    /// 16, zero means no limit).
+    PHYLANX_EXPORT std::size_t fetch_window();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Process a number of remote parts of a distributed object while
+    /// overlapping the communication with the computation:
+    ///
+    /// - fetch(i) issues the (asynchronous) request for the i-th part and
+    ///   returns the future representing the data,
+    /// - local() is invoked once the first requests have been issued and
+    ///   performs the work that does not depend on remote data,
+    /// - consume(i, data) processes the data of the i-th part.
+    ///
+    /// The parts are consumed in the order their data arrives, each request
+    /// being replaced by the next one as soon as it has been consumed. At
+    /// most fetch_window() requests are in flight at any point in time.
+    template <typename Fetch, typename Local, typename Consume>
+    void overlapped_fetch(
+        std::size_t count, Fetch&& fetch, Local&& local, Consume&& consume)
+    {
+        using future_type = decltype(fetch(std::size_t(0)));
+
+        std::size_t window = fetch_window();
+        if (window == 0 || window > count)
+        {
+            window = count;
+        }
+
+        // parts[k] is the index of the part requested by futures[k]
+        std::vector<future_type> futures;
+        std::vector<std::size_t> parts;
+        futures.reserve(window);
+        parts.reserve(window);
+
+        std::size_t next = 0;
+        for (/**/; next != window; ++next)
+        {
+            futures.push_back(fetch(next));
+            parts.push_back(next);
+        }
+
+        local();
+
+        while (!futures.empty())
+        {
+            auto ready = hpx::when_any(futures).get();
+            futures = std::move(ready.futures);
+
+            std::size_t const k = ready.index;
+            std::size_t const part = parts[k];
+            auto data = futures[k].get();
+
+            if (next != count)
+            {
+                futures[k] = fetch(next);
+                parts[k] = next++;
+            }
+            else
+            {
+                futures.erase(futures.begin() + k);
+                parts.erase(parts.begin() + k);
+            }
+
+            consume(part, std::move(data));
+        }
+    }
+}}
+
+#endif
@@ -18,6 +18,7 @@
 
 #include <array>
 #include <cstddef>
+#include <utility>
 
 namespace hpx { namespace serialization
 {
@@ -67,6 +68,40 @@ namespace hpx { namespace serialization
             hpx::serialization::make_array(target.data(), rows * spacing);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, bool SO>
+    void load(input_archive& archive, blaze::CompressedMatrix<T, SO>& target,
+        unsigned)
+    {
+        // De-serialize compressed matrix
+        std::size_t rows = 0UL;
+        std::size_t columns = 0UL;
+        std::size_t nonzeros = 0UL;
+        archive >> rows >> columns >> nonzeros;
+
+        blaze::CompressedMatrix<T, SO> m(rows, columns, nonzeros);
+
+        std::size_t const count = SO ? columns : rows;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            std::size_t elements = 0UL;
+            archive >> elements;
+            for (std::size_t k = 0; k != elements; ++k)
+            {
+                std::size_t index = 0UL;
+                T value = T();
+                archive >> index >> value;
+                if (SO)
+                    m.append(index, i, value);
+                else
+                    m.append(i, index, value);
+            }
+            m.finalize(i);
+        }
+
+        target = std::move(m);
+    }
+
     template <typename T>
     void load(input_archive& archive, blaze::DynamicTensor<T>& target, unsigned)
     {
@@ -173,6 +208,33 @@ namespace hpx { namespace serialization
             target.data(), rows * spacing);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, bool SO>
+    void save(output_archive& archive,
+        blaze::CompressedMatrix<T, SO> const& target, unsigned)
+    {
+        // Serialize compressed matrix, each row (column for column-major
+        // matrices) is stored as the number of its non-zero elements followed
+        // by the (index, value) pairs
+        std::size_t rows = target.rows();
+        std::size_t columns = target.columns();
+        std::size_t nonzeros = target.nonZeros();
+        archive << rows << columns << nonzeros;
+
+        std::size_t const count = SO ? columns : rows;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            std::size_t elements = target.nonZeros(i);
+            archive << elements;
+            for (auto it = target.cbegin(i); it != target.cend(i); ++it)
+            {
+                std::size_t index = it->index();
+                T value = it->value();
+                archive << index << value;
+            }
+        }
+    }
+
     template <typename T>
     void save(output_archive& archive, blaze::DynamicTensor<T> const& target,
         unsigned)
@@ -298,6 +360,9 @@ namespace hpx { namespace serialization
             bool SO, typename RT>),
         (blaze::CustomMatrix<T, AF, PF, SO, RT>) );
 
+    HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
+        (template <typename T, bool SO>), (blaze::CompressedMatrix<T, SO>));
+
     HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
         (template <typename T>), (blaze::DynamicTensor<T>));
 
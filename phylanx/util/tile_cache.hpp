@@ -0,0 +1,124 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_TILE_CACHE_2020_OCT_17_0520PM)
+#define PHYLANX_UTIL_TILE_CACHE_2020_OCT_17_0520PM
+
+#include <phylanx/config.hpp>
+
+#include <hpx/futures/future.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <utility>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Statistics collected by the cache of fetched remote tiles
+    struct tile_cache_statistics
+    {
+        std::int64_t hits_;         // number of remote fetches avoided
+        std::int64_t misses_;       // number of remote fetches performed
+        std::int64_t entries_;      // number of tiles currently cached
+        std::int64_t bytes_;        // number of bytes currently cached
+    };
+
+    /// Enable or disable the cache of tiles fetched from remote parts of
+    /// distributed objects. Only objects that were given a version (see
+    /// distributed_matrix::set_cache_version) use the cache. The cache is
+    /// initially enabled if the configuration setting 'phylanx.tile_cache'
+    /// is set to '1' (default: '0'). At most 'phylanx.tile_cache_size' bytes
+    /// are cached (default: 268435456).
+    PHYLANX_EXPORT void enable_tile_cache(bool enable);
+    PHYLANX_EXPORT bool tile_cache_enabled();
+
+    /// Remove all entries from the cache of fetched tiles
+    PHYLANX_EXPORT void clear_tile_cache();
+
+    /// Remove all tiles of the distributed objects with the given name from
+    /// the cache, this is invoked whenever the object is stored to.
+    PHYLANX_EXPORT void invalidate_cached_tiles(std::string const& name);
+
+    /// Retrieve (and optionally reset) the statistics of the cache
+    PHYLANX_EXPORT tile_cache_statistics get_tile_cache_statistics(
+        bool reset = false);
+
+    /// Retrieve the number of cache hits and misses (for the performance
+    /// counters)
+    PHYLANX_EXPORT std::int64_t tile_cache_hits(bool reset);
+    PHYLANX_EXPORT std::int64_t tile_cache_misses(bool reset);
+
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        struct tile_cache_key
+        {
+            std::string name_;              // name of the distributed object
+            std::string type_;              // type of the fetched data
+            std::int64_t version_;
+            std::uint32_t locality_;        // owner of the tile
+            std::array<std::size_t, 6> box_;
+        };
+
+        /// Look up the tile cached earlier for the given key, returns an
+        /// empty pointer if none was found or if the key refers to an
+        /// outdated version.
+        PHYLANX_EXPORT std::shared_ptr<void const> find_tile(
+            tile_cache_key const& key);
+
+        /// Add the given tile to the cache, all tiles of older versions of
+        /// the same object are evicted.
+        PHYLANX_EXPORT void add_tile(tile_cache_key&& key,
+            std::shared_ptr<void const> tile, std::size_t bytes);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Serve the tile with the given box (pairs of start and stop indices,
+    /// {0, 1} for unused dimensions) owned by the given locality from the
+    /// cache, or invoke fetch() and add the retrieved tile to the cache.
+    /// Negative versions disable caching.
+    template <typename Data, typename F>
+    hpx::future<Data> cached_fetch(std::string const& name,
+        std::int64_t version, std::uint32_t locality,
+        std::array<std::size_t, 6> const& box, F&& fetch)
+    {
+        if (version < 0 || !tile_cache_enabled())
+        {
+            return fetch();
+        }
+
+        detail::tile_cache_key key{
+            name, typeid(Data).name(), version, locality, box};
+
+        std::shared_ptr<void const> tile = detail::find_tile(key);
+        if (tile)
+        {
+            return hpx::make_ready_future(
+                *std::static_pointer_cast<Data const>(tile));
+        }
+
+        std::size_t bytes = sizeof(typename Data::ElementType);
+        for (std::size_t i = 0; i != box.size(); i += 2)
+        {
+            bytes *= box[i + 1] - box[i];
+        }
+
+        return fetch().then(hpx::launch::sync,
+            [key = std::move(key), bytes](hpx::future<Data>&& f) mutable
+            {
+                auto data = std::make_shared<Data const>(f.get());
+                detail::add_tile(std::move(key), data, bytes);
+                return *data;
+            });
+    }
+}}
+
+#endif
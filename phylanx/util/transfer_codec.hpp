@@ -0,0 +1,158 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_TRANSFER_CODEC_2020_OCT_17_0345PM)
+#define PHYLANX_UTIL_TRANSFER_CODEC_2020_OCT_17_0345PM
+
+#include <phylanx/config.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Encodings applied to the data fetched from a remote part of a
+    /// distributed object:
+    ///
+    /// - none: the data is sent as is,
+    /// - shuffle: the bytes of all elements are regrouped by significance
+    ///   and run-length encoded (lossless),
+    /// - float32: double precision data is narrowed to single precision
+    ///   before being shuffled (lossy, other types are shuffled only).
+    enum class transfer_codec : std::uint8_t
+    {
+        none = 0,
+        shuffle = 1,
+        float32 = 2
+    };
+
+    /// Return the codec used by distributed objects if none is specified
+    /// explicitly, as configured by 'phylanx.transfer_codec' (one of 'none',
+    /// 'shuffle', or 'float32', default: 'none').
+    PHYLANX_EXPORT transfer_codec default_transfer_codec();
+
+    PHYLANX_EXPORT transfer_codec transfer_codec_from_string(
+        std::string const& codec);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The encoded data of a block of elements as sent over the wire.
+    struct transfer_block
+    {
+        transfer_codec codec_ = transfer_codec::none;   // codec actually used
+        std::vector<char> data_;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & codec_ & data_;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Byte-shuffle and run-length encode count elements of size
+    /// element_size, and the inverse operation.
+    PHYLANX_EXPORT std::vector<char> shuffle_encode(
+        char const* data, std::size_t count, std::size_t element_size);
+
+    PHYLANX_EXPORT void shuffle_decode(std::vector<char> const& encoded,
+        char* data, std::size_t count, std::size_t element_size);
+
+    /// Account for the bytes of a block before and after encoding it.
+    PHYLANX_EXPORT void track_transfer(
+        std::int64_t raw_bytes, std::int64_t encoded_bytes);
+
+    /// Retrieve the accumulated number of bytes of all encoded blocks
+    PHYLANX_EXPORT std::int64_t transfer_raw_bytes(bool reset);
+    PHYLANX_EXPORT std::int64_t transfer_encoded_bytes(bool reset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        inline transfer_block raw_block(char const* data, std::size_t bytes)
+        {
+            transfer_block block;
+            block.data_.assign(data, data + bytes);
+            return block;
+        }
+    }
+
+    template <typename T>
+    transfer_block encode_block(
+        T const* data, std::size_t count, transfer_codec codec)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "only trivially copyable element types can be encoded");
+
+        std::size_t const raw_bytes = count * sizeof(T);
+
+        transfer_block block;
+        if (codec == transfer_codec::float32 &&
+            std::is_same<T, double>::value)
+        {
+            std::vector<float> narrowed(data, data + count);
+            block.codec_ = transfer_codec::float32;
+            block.data_ = shuffle_encode(
+                reinterpret_cast<char const*>(narrowed.data()), count,
+                sizeof(float));
+        }
+        else if (codec != transfer_codec::none)
+        {
+            block.codec_ = transfer_codec::shuffle;
+            block.data_ = shuffle_encode(
+                reinterpret_cast<char const*>(data), count, sizeof(T));
+        }
+
+        // send incompressible data as is
+        if (block.codec_ == transfer_codec::none ||
+            (block.codec_ == transfer_codec::shuffle &&
+                block.data_.size() >= raw_bytes))
+        {
+            block = detail::raw_block(
+                reinterpret_cast<char const*>(data), raw_bytes);
+        }
+
+        track_transfer(raw_bytes, block.data_.size());
+        return block;
+    }
+
+    template <typename T>
+    void decode_block(transfer_block const& block, T* data, std::size_t count)
+    {
+        switch (block.codec_)
+        {
+        case transfer_codec::float32:
+            {
+                std::vector<float> narrowed(count);
+                shuffle_decode(block.data_,
+                    reinterpret_cast<char*>(narrowed.data()), count,
+                    sizeof(float));
+                std::copy(narrowed.begin(), narrowed.end(), data);
+            }
+            break;
+
+        case transfer_codec::shuffle:
+            shuffle_decode(
+                block.data_, reinterpret_cast<char*>(data), count, sizeof(T));
+            break;
+
+        default:
+            HPX_ASSERT(block.data_.size() == count * sizeof(T));
+            std::memcpy(data, block.data_.data(), block.data_.size());
+            break;
+        }
+    }
+}}
+
+#endif
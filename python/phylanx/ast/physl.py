@@ -473,6 +473,7 @@ class PhySL:
         self.wrapped_function = func
         self.kwargs = kwargs
         self.is_compiled = False
+        self.prepared = None
         self.file_name = None
         self.__src__ = None
         self.__ast__ = None
@@ -594,9 +595,17 @@ class PhySL:
                 phylanx.execution_tree.enable_measurements(
                     PhySL.compiler_state, True)
 
-        result = phylanx.execution_tree.eval(
-            PhySL.compiler_state, self.file_name,
-            self.wrapped_function.__name__, *args, **kwargs)
+        if self.performance:
+            result = phylanx.execution_tree.eval(
+                PhySL.compiler_state, self.file_name,
+                self.wrapped_function.__name__, *args, **kwargs)
+        else:
+            # compile the invocation only once, subsequent calls reuse it
+            if self.prepared is None:
+                self.prepared = phylanx.execution_tree.prepare(
+                    PhySL.compiler_state, self.file_name,
+                    self.wrapped_function.__name__)
+            result = self.prepared(*args, **kwargs)
 
         if self.performance:
             treedata = self.tree()
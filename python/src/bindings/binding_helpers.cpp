@@ -133,8 +133,13 @@ namespace phylanx { namespace bindings
 
                 std::map<std::string, primitive_argument_type> fkwargs;
 
+                // keeps the borrowed arguments alive until the result has
+                // been converted
+                borrow_numpy_arrays borrow;
+
                 {
                     pybind11::gil_scoped_acquire acquire;
+
                     for (auto const& item : args)
                     {
                         fargs.emplace_back(item.cast<primitive_argument_type>());
@@ -145,6 +150,8 @@ namespace phylanx { namespace bindings
                         fkwargs = kwargs.cast<
                             std::map<std::string, primitive_argument_type>>();
                     }
+
+                    borrow.disable();
                 }
 
                 // potentially handle keyword arguments
@@ -173,6 +180,103 @@ namespace phylanx { namespace bindings
             });
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    prepared_function::prepared_function(compiler_state& state,
+            std::string const& file_name, std::string const& func_name)
+      : state_(state)
+      , func_name_(func_name)
+    {
+        pybind11::gil_scoped_release release;       // release GIL
+
+        func_ = hpx::threads::run_as_hpx_thread(
+            [&]() -> phylanx::execution_tree::compiler::function
+            {
+                auto const& code = phylanx::execution_tree::compile(file_name,
+                    func_name, func_name, state.eval_snippets, state.eval_env);
+
+                if (state.enable_measurements)
+                {
+                    auto const& funcs = code.functions();
+                    if (!funcs.empty())
+                    {
+                        state.primitive_instances.push_back(
+                            phylanx::util::enable_measurements(
+                                funcs.front().name_));
+                    }
+                }
+
+                return code.run(state.eval_ctx);
+            });
+
+        for (std::size_t i = 0; i != func_.num_named_args_; ++i)
+        {
+            named_args_.emplace(func_.named_args_[i], i);
+        }
+    }
+
+    pybind11::object prepared_function::operator()(
+        pybind11::args args, pybind11::kwargs kwargs) const
+    {
+        using phylanx::execution_tree::primitive_argument_type;
+
+        // convert the arguments while holding the GIL, the named arguments
+        // are placed at their positions right away
+        phylanx::execution_tree::primitive_arguments_type fargs;
+        fargs.reserve(args.size() + kwargs.size());
+
+        // keeps the borrowed arguments alive until the result has been
+        // converted
+        borrow_numpy_arrays borrow;
+
+        for (auto const& item : args)
+        {
+            fargs.emplace_back(item.cast<primitive_argument_type>());
+        }
+
+        for (auto const& item : kwargs)
+        {
+            std::string name = item.first.cast<std::string>();
+
+            auto it = named_args_.find(name);
+            if (it == named_args_.end())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::bindings::prepared_function::operator()",
+                    hpx::util::format("cannot locate requested named "
+                        "argument '{}' of function '{}'",
+                        name, func_name_));
+            }
+
+            if (it->second >= fargs.size())
+            {
+                fargs.resize(it->second + 1);
+            }
+            fargs[it->second] = item.second.cast<primitive_argument_type>();
+        }
+
+        borrow.disable();
+
+        pybind11::gil_scoped_release release;       // release GIL
+
+        return hpx::threads::run_as_hpx_thread(
+            [&]() -> pybind11::object
+            {
+                // Make sure None is printed as "None"
+                phylanx::util::none_wrapper wrap_cout(hpx::cout);
+                phylanx::util::none_wrapper wrap_debug(hpx::consolestream);
+
+                primitive_argument_type&& result =
+                    func_(std::move(fargs), state_.eval_ctx);
+
+                pybind11::gil_scoped_acquire acquire;
+                return pybind11::reinterpret_steal<pybind11::object>(
+                    pybind11::detail::make_caster<
+                        primitive_argument_type>::cast(std::move(result),
+                        pybind11::return_value_policy::move,
+                        pybind11::handle()));
+            });
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     phylanx::execution_tree::primitive code_for(
         phylanx::bindings::compiler_state& state, std::string const& file_name,
@@ -660,6 +764,9 @@ namespace phylanx { namespace bindings
                 case primitive_argument_type::dictionary_index:
                     return pybind11::dtype("O");
 
+                case primitive_argument_type::float32_index:
+                    return pybind11::dtype("float32");
+
                 default:
                     break;
                 }
@@ -14,10 +14,14 @@
 #include <pybind11/pybind11.h>
 
 #include <hpx/include/run_as.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <list>
+#include <map>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -52,6 +56,18 @@ namespace phylanx { namespace bindings
         bool enable_measurements;
         std::vector<std::string> primitive_instances;
 
+        // operations on variables are recorded instead of being executed
+        // right away, the functions compiled for the recorded expressions
+        // are cached (key: expression, value: function name), the most
+        // recently used function comes first
+        bool lazy_variables;
+        std::size_t lazy_operations_max;
+        std::size_t lazy_functions_max;
+        std::list<std::pair<std::string, std::string>> lazy_functions;
+        std::map<std::string,
+            std::list<std::pair<std::string, std::string>>::iterator>
+            lazy_function_index;
+
         static pybind11::object import_phylanx()
         {
 #if defined(_DEBUG)
@@ -82,6 +98,13 @@ namespace phylanx { namespace bindings
           , name_(std::move(name))
           , codename_(std::move(codename))
           , enable_measurements(false)
+          , lazy_variables(
+                hpx::get_config_entry("phylanx.lazy_variables", "0") == "1")
+          , lazy_operations_max(std::stoull(hpx::get_config_entry(
+                "phylanx.lazy_variables_max_operations", "32")))
+          , lazy_functions_max((std::max)(std::size_t(1),
+                std::size_t(std::stoull(hpx::get_config_entry(
+                    "phylanx.lazy_variables_cache_size", "64")))))
         {
         }
     };
@@ -215,6 +238,32 @@ namespace phylanx { namespace bindings
         std::string const& xexpr_str, pybind11::args args,
         pybind11::kwargs kwargs);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // function that is compiled once and can be invoked many times without
+    // recompiling the invocation or resolving the named arguments again
+    class prepared_function
+    {
+    public:
+        prepared_function(compiler_state& state, std::string const& file_name,
+            std::string const& func_name);
+
+        pybind11::object operator()(
+            pybind11::args args, pybind11::kwargs kwargs) const;
+
+        std::string const& name() const
+        {
+            return func_name_;
+        }
+
+    private:
+        compiler_state& state_;
+        std::string func_name_;
+        phylanx::execution_tree::compiler::function func_;
+
+        // positions of the named arguments of the function
+        std::map<std::string, std::size_t> named_args_;
+    };
+
     // extract pre-compiled code for given function name
     phylanx::execution_tree::primitive code_for(
         phylanx::bindings::compiler_state& state,
@@ -6,6 +6,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/phylanx.hpp>
+#include <phylanx/util/execution_trace.hpp>
 
 #include <bindings/binding_helpers.hpp>
 #include <bindings/type_casters.hpp>
@@ -31,7 +32,11 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
     // Compiler State
     pybind11::class_<phylanx::bindings::compiler_state>(
             execution_tree, "compiler_state")
-        .def(pybind11::init<std::string, std::string>());
+        .def(pybind11::init<std::string, std::string>())
+        .def_readwrite("lazy_variables",
+            &phylanx::bindings::compiler_state::lazy_variables,
+            "record the arithmetic operations on variables and compile them "
+            "into a single function once their value is needed");
 
     ///////////////////////////////////////////////////////////////////////////
     execution_tree.def("compile", phylanx::bindings::expression_compiler,
@@ -54,6 +59,30 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
         },
         "compile and evaluate a numerical expression in PhySL");
 
+    // functions compiled once for repeated invocation
+    pybind11::class_<phylanx::bindings::prepared_function>(execution_tree,
+        "prepared_function",
+        "compiled function that can be invoked repeatedly without being "
+        "recompiled")
+        .def(pybind11::init<phylanx::bindings::compiler_state&,
+                 std::string const&, std::string const&>(),
+            pybind11::keep_alive<1, 2>())
+        .def("__call__", &phylanx::bindings::prepared_function::operator(),
+            "invoke the compiled function with the given arguments")
+        .def_property_readonly("name",
+            &phylanx::bindings::prepared_function::name,
+            "the name of the compiled function");
+
+    execution_tree.def("prepare",
+        [](phylanx::bindings::compiler_state& state,
+            std::string const& file_name, std::string const& func_name)
+        {
+            return phylanx::bindings::prepared_function(
+                state, file_name, func_name);
+        },
+        pybind11::keep_alive<0, 1>(),
+        "compile the given function once for repeated invocation");
+
     // expose functionalities needed for accessing performance data
     execution_tree.def("enable_measurements",
         phylanx::bindings::enable_measurements,
@@ -63,6 +92,34 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
         phylanx::bindings::retrieve_counter_data,
         "retrieve performance data from all active performance counters");
 
+    // expose the execution trace
+    execution_tree.def("enable_execution_trace",
+        &phylanx::util::enable_execution_trace,
+        "enable or disable recording the execution trace");
+
+    execution_tree.def("clear_execution_trace",
+        &phylanx::util::clear_execution_trace,
+        "discard all events recorded in the execution trace");
+
+    execution_tree.def("execution_trace",
+        []() -> std::string
+        {
+            pybind11::gil_scoped_release release;       // release GIL
+            return hpx::threads::run_as_hpx_thread(
+                &phylanx::util::execution_trace_json);
+        },
+        "retrieve the recorded execution trace in the Chrome trace format");
+
+    execution_tree.def("dump_execution_trace",
+        [](std::string const& filename)
+        {
+            pybind11::gil_scoped_release release;       // release GIL
+            hpx::threads::run_as_hpx_thread(
+                &phylanx::util::dump_execution_trace, filename);
+        },
+        "write the recorded execution trace to the given file in the Chrome "
+        "trace format");
+
     execution_tree.def("retrieve_dot_tree_topology",
         phylanx::bindings::retrieve_dot_tree_topology,
         "retrieve the DOT tree topology for the given execution tree");
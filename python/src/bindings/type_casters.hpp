@@ -41,6 +41,71 @@
 #define PHYLANX_PYBIND_DESCR_GETNAME() name
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace bindings
+{
+    // While an instance of this type is active, the node_data instances
+    // created from numpy arrays refer to the numpy data (custom storage)
+    // instead of copying it, provided the element type matches exactly and
+    // the data is C-contiguous, aligned, and padded as required by Blaze.
+    // The borrowed arrays are kept alive for as long as the instance exists,
+    // which must therefore outlive the invocation the converted arguments are
+    // passed to. Instances may be created and destroyed without holding the
+    // GIL, all conversions happen while holding it, which protects the
+    // static state.
+    class borrow_numpy_arrays
+    {
+    public:
+        borrow_numpy_arrays()
+        {
+            pybind11::gil_scoped_acquire acquire;
+            previous_ = current();
+            current() = this;
+        }
+
+        ~borrow_numpy_arrays()
+        {
+            pybind11::gil_scoped_acquire acquire;
+            disable();
+            owners_.clear();
+        }
+
+        borrow_numpy_arrays(borrow_numpy_arrays const&) = delete;
+        borrow_numpy_arrays& operator=(borrow_numpy_arrays const&) = delete;
+
+        // stop borrowing arrays, the arrays borrowed so far are kept alive
+        // (must be called while holding the GIL)
+        void disable()
+        {
+            if (current() == this)
+            {
+                current() = previous_;
+            }
+        }
+
+        static bool enabled()
+        {
+            return current() != nullptr;
+        }
+
+        static void keep_alive(pybind11::handle array)
+        {
+            current()->owners_.push_back(
+                pybind11::reinterpret_borrow<pybind11::object>(array));
+        }
+
+    private:
+        static borrow_numpy_arrays*& current()
+        {
+            static borrow_numpy_arrays* current_ = nullptr;
+            return current_;
+        }
+
+        borrow_numpy_arrays* previous_;
+        std::vector<pybind11::object> owners_;
+    };
+}}
+
 // older versions of pybind11 don't support variant-like types
 namespace pybind11 { namespace detail
 {
@@ -439,16 +504,6 @@ namespace pybind11 { namespace detail
         }
     };
 
-    template <>
-    struct is_array_instance<double>
-    {
-        static bool call(handle src)
-        {
-            return isinstance<array_t<double>>(src) ||
-                   isinstance<array_t<float>>(src);
-        }
-    };
-
     template <>
     struct is_array_instance<std::int64_t>
     {
@@ -510,8 +565,83 @@ namespace pybind11 { namespace detail
             return false;
         }
 
+        // Refer to the data of the given numpy array instead of copying it,
+        // if possible (see phylanx::bindings::borrow_numpy_arrays)
+        bool load_borrowed(handle src, std::size_t expected_dims)
+        {
+            if (!phylanx::bindings::borrow_numpy_arrays::enabled() ||
+                !isinstance<array_t<result_type>>(src))
+            {
+                return false;
+            }
+
+            auto buf = reinterpret_borrow<array>(src);
+            if (std::size_t(buf.ndim()) != expected_dims || buf.size() == 0)
+            {
+                return false;
+            }
+
+            // borrowed data is never modified in place (it is a reference),
+            // read-only arrays can be borrowed as well
+            int const required = detail::npy_api::NPY_ARRAY_C_CONTIGUOUS_ |
+                detail::npy_api::NPY_ARRAY_ALIGNED_;
+            if ((array_proxy(buf.ptr())->flags & required) != required)
+            {
+                return false;
+            }
+
+            // the rows of the numpy data have to satisfy the alignment and
+            // padding requirements of the Blaze custom types
+            T* data = const_cast<T*>(static_cast<T const*>(buf.data()));
+            std::size_t const columns = buf.shape(expected_dims - 1);
+            if (blaze::IsVectorizable<T>::value &&
+                (reinterpret_cast<std::uintptr_t>(data) %
+                        blaze::AlignmentOf<T>::value !=
+                    0 ||
+                    columns % blaze::SIMDTrait<T>::size != 0))
+            {
+                return false;
+            }
+
+            using storage = phylanx::ir::node_data<T>;
+            switch (expected_dims)
+            {
+            case 1:
+                value = typename storage::custom_storage1d_type(
+                    data, columns, columns);
+                break;
+
+            case 2:
+                value = typename storage::custom_storage2d_type(
+                    data, buf.shape(0), columns, columns);
+                break;
+
+            case 3:
+                value = typename storage::custom_storage3d_type(
+                    data, buf.shape(0), buf.shape(1), columns, columns);
+                break;
+
+            case 4:
+                value = typename storage::custom_storage4d_type(data,
+                    buf.shape(0), buf.shape(1), buf.shape(2), columns,
+                    columns);
+                break;
+
+            default:
+                return false;
+            }
+
+            phylanx::bindings::borrow_numpy_arrays::keep_alive(src);
+            return true;
+        }
+
         bool load1d(handle src, bool convert)
         {
+            if (load_borrowed(src, 1))
+            {
+                return true;
+            }
+
             if (!convert && !is_array_instance<result_type>::call(src))
             {
                 return false;
@@ -556,6 +686,11 @@ namespace pybind11 { namespace detail
 
         bool load2d(handle src, bool convert)
         {
+            if (load_borrowed(src, 2))
+            {
+                return true;
+            }
+
             if (!convert && !is_array_instance<result_type>::call(src))
             {
                 return false;
@@ -600,6 +735,11 @@ namespace pybind11 { namespace detail
 
         bool load3d(handle src, bool convert)
         {
+            if (load_borrowed(src, 3))
+            {
+                return true;
+            }
+
             if (!convert && !is_array_instance<result_type>::call(src))
             {
                 return false;
@@ -644,6 +784,11 @@ namespace pybind11 { namespace detail
 
         bool load4d(handle src, bool convert)
         {
+            if (load_borrowed(src, 4))
+            {
+                return true;
+            }
+
             if (!convert && !is_array_instance<result_type>::call(src))
             {
                 return false;
@@ -943,6 +1088,14 @@ namespace pybind11 { namespace detail
                 return result.release();
             }
 
+            if (src->is_sparse())
+            {
+                // sparse matrices are handed to Python as dense arrays
+                using T_ = typename casted_type<T>::type;
+                return blaze_encapsulate(
+                    new blaze::DynamicMatrix<T_>(src->matrix_copy()));
+            }
+
             switch (policy)
             {
             case return_value_policy::take_ownership:   HPX_FALLTHROUGH;
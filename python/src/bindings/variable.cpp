@@ -13,10 +13,18 @@
 #include <bindings/variable.hpp>
 
 #include <hpx/assert.hpp>
+#include <hpx/include/lcos_local.hpp>
+#include <hpx/include/run_as.hpp>
+#include <hpx/include/threads.hpp>
 #include <hpx/modules/format.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <utility>
@@ -147,6 +155,17 @@ namespace phylanx { namespace execution_tree
       , shape_(pybind11::none())
     {}
 
+    variable::variable(bindings::compiler_state& state,
+        std::shared_ptr<detail::lazy_expression> expr, pybind11::object dtype,
+        char const* name)
+      : state_(state)
+      , dtype_(detail::to_dtype(std::move(dtype)))
+      , name_(hpx::util::format("{}_{}", name, ++variable_count))
+      , expr_(std::move(expr))
+      , constraint_(pybind11::none())
+      , shape_(pybind11::none())
+    {}
+
     ///////////////////////////////////////////////////////////////////////////
     primitive variable::create_variable(
         primitive_argument_type&& value, std::string const& name)
@@ -168,7 +187,7 @@ namespace phylanx { namespace execution_tree
     {
         if (dtype_.is_none())
         {
-            return bindings::extract_dtype(primitive_argument_type{value_});
+            return bindings::extract_dtype(primitive_argument_type{value()});
         }
         return dtype_;
     }
@@ -183,7 +202,7 @@ namespace phylanx { namespace execution_tree
     {
         if (shape_.is_none())
         {
-            return bindings::extract_shape(primitive_argument_type{value_});
+            return bindings::extract_shape(primitive_argument_type{value()});
         }
         return pybind11::tuple(shape_);
     }
@@ -193,6 +212,274 @@ namespace phylanx { namespace execution_tree
         shape_ = sh;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // support for recording operations in lazy mode
+    detail::lazy_operand variable::operand() const
+    {
+        if (expr_ && !expr_->materialized_.load(std::memory_order_acquire))
+        {
+            return detail::lazy_operand{expr_, primitive_argument_type{}};
+        }
+        return detail::lazy_operand{
+            nullptr, primitive_argument_type{value()}};
+    }
+
+    variable variable::record(std::string op,
+        std::vector<detail::lazy_operand>&& operands, char const* name) const
+    {
+        variable result{state_,
+            std::make_shared<detail::lazy_expression>(
+                std::move(op), std::move(operands)),
+            dtype_, name};
+
+        result.limit_expression_size();
+        return result;
+    }
+
+    variable variable::record_inplace(std::string op,
+        std::vector<detail::lazy_operand>&& operands, char const* name)
+    {
+        expr_ = std::make_shared<detail::lazy_expression>(
+            std::move(op), std::move(operands));
+        value_ = primitive{};
+        shape_ = pybind11::none();
+
+        limit_expression_size();
+        return variable{state_, expr_, dtype_, name};
+    }
+
+    // Long chains of operations are materialized as soon as they grow beyond
+    // the configured limit. This bounds the size of the generated code and
+    // the recursion depth needed to generate it.
+    void variable::limit_expression_size() const
+    {
+        if (expr_->size_ > state_.lazy_operations_max)
+        {
+            materialize();
+        }
+    }
+
+    namespace detail
+    {
+        // protects the recorded expressions and the cache of compiled
+        // functions while expressions are materialized
+        static hpx::lcos::local::mutex lazy_expression_mtx;
+
+        // Generate the PhySL code for a recorded expression. All values and
+        // materialized sub-expressions become arguments of the generated
+        // function. This makes the generated code independent of the values
+        // involved, which allows to reuse it. Sub-expressions that are used
+        // more than once are bound to a local variable and are evaluated
+        // only once.
+        class lazy_code_generator
+        {
+        public:
+            std::string generate(lazy_expression const& expr)
+            {
+                count_uses(expr);
+
+                std::string code = generate_expression(expr);
+                if (definitions_.empty())
+                {
+                    return code;
+                }
+                return hpx::util::format("block({}{})", definitions_, code);
+            }
+
+            primitive_arguments_type& arguments()
+            {
+                return args_;
+            }
+
+        private:
+            void count_uses(lazy_expression const& expr)
+            {
+                for (auto const& operand : expr.operands_)
+                {
+                    lazy_expression const* p = operand.expr_.get();
+                    if (p != nullptr &&
+                        !p->materialized_.load(std::memory_order_relaxed) &&
+                        ++uses_[p] == 1)
+                    {
+                        count_uses(*p);
+                    }
+                }
+            }
+
+            std::string generate_expression(lazy_expression const& expr)
+            {
+                std::string code = expr.op_;
+                code += '(';
+
+                bool first = true;
+                for (auto const& operand : expr.operands_)
+                {
+                    if (!first)
+                    {
+                        code += ", ";
+                    }
+                    first = false;
+
+                    code += generate_operand(operand);
+                }
+
+                code += ')';
+                return code;
+            }
+
+            std::string generate_operand(lazy_operand const& operand)
+            {
+                lazy_expression const* p = operand.expr_.get();
+                if (p == nullptr)
+                {
+                    return add_argument(operand.value_);
+                }
+
+                auto it = names_.find(p);
+                if (it != names_.end())
+                {
+                    return it->second;
+                }
+
+                std::string name;
+                if (p->materialized_.load(std::memory_order_relaxed))
+                {
+                    name = add_argument(primitive_argument_type{p->value_});
+                }
+                else
+                {
+                    std::string code = generate_expression(*p);
+                    if (uses_[p] == 1)
+                    {
+                        return code;
+                    }
+
+                    name = hpx::util::format("_lazy_{}", temporaries_++);
+                    definitions_ +=
+                        hpx::util::format("define({}, {}), ", name, code);
+                }
+
+                names_.emplace(p, name);
+                return name;
+            }
+
+            std::string add_argument(primitive_argument_type const& value)
+            {
+                std::string name = hpx::util::format("arg{}", args_.size());
+                args_.emplace_back(value);
+                return name;
+            }
+
+            std::map<lazy_expression const*, std::size_t> uses_;
+            std::map<lazy_expression const*, std::string> names_;
+            std::string definitions_;
+            std::size_t temporaries_ = 0;
+            primitive_arguments_type args_;
+        };
+
+        // Return the name of the function compiled for the given code, the
+        // least recently used function is replaced if the cache is full.
+        std::string const& lazy_function(bindings::compiler_state& state,
+            std::string const& code, std::size_t num_args)
+        {
+            auto it = state.lazy_function_index.find(code);
+            if (it != state.lazy_function_index.end())
+            {
+                state.lazy_functions.splice(state.lazy_functions.begin(),
+                    state.lazy_functions, it->second);
+                return it->second->second;
+            }
+
+            // reusing the name of an evicted function makes its new
+            // definition replace the old one in the evaluation context
+            std::string funcname;
+            if (!state.lazy_functions.empty() &&
+                state.lazy_functions.size() >= state.lazy_functions_max)
+            {
+                funcname = std::move(state.lazy_functions.back().second);
+                state.lazy_function_index.erase(
+                    state.lazy_functions.back().first);
+                state.lazy_functions.pop_back();
+            }
+            else
+            {
+                funcname = hpx::util::format(
+                    "_lazy_expression_{}", state.lazy_functions.size());
+            }
+
+            std::string parameters;
+            for (std::size_t i = 0; i != num_args; ++i)
+            {
+                parameters += hpx::util::format("arg{}, ", i);
+            }
+
+            phylanx::execution_tree::compile(state.codename_, funcname,
+                hpx::util::format(
+                    "define({}, {}{})", funcname, parameters, code),
+                state.eval_snippets, state.eval_env)
+                .run(state.eval_ctx);
+
+            state.lazy_functions.emplace_front(code, std::move(funcname));
+            state.lazy_function_index.emplace(
+                code, state.lazy_functions.begin());
+
+            return state.lazy_functions.front().second;
+        }
+
+        primitive materialize_lazy_expression(
+            bindings::compiler_state& state, lazy_expression& expr)
+        {
+            std::lock_guard<hpx::lcos::local::mutex> l(lazy_expression_mtx);
+
+            if (expr.materialized_.load(std::memory_order_relaxed))
+            {
+                return expr.value_;
+            }
+
+            lazy_code_generator generator;
+            std::string code = generator.generate(expr);
+            primitive_arguments_type& args = generator.arguments();
+
+            // compile the expression only once, the element-wise operations
+            // are fused by the compiler
+            std::string const& funcname =
+                lazy_function(state, code, args.size());
+
+            auto* p = state.eval_ctx.get_var(funcname);
+            HPX_ASSERT(p != nullptr);
+
+            // bind the values to the compiled function
+            auto result = phylanx::execution_tree::bind_arguments(
+                state.codename_, funcname, state.eval_snippets, *p,
+                std::move(args));
+
+            expr.value_ = primitive_operand(std::move(result.arg_));
+
+            // the operands are not needed anymore, release them
+            expr.operands_.clear();
+            expr.materialized_.store(true, std::memory_order_release);
+
+            return expr.value_;
+        }
+    }
+
+    primitive variable::materialize() const
+    {
+        if (expr_->materialized_.load(std::memory_order_acquire))
+        {
+            return expr_->value_;
+        }
+
+        if (hpx::threads::get_self_ptr() == nullptr)
+        {
+            pybind11::gil_scoped_release release;       // release GIL
+            return hpx::threads::run_as_hpx_thread([&]() {
+                return detail::materialize_lazy_expression(state_, *expr_);
+            });
+        }
+        return detail::materialize_lazy_expression(state_, *expr_);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -296,7 +583,7 @@ namespace phylanx { namespace execution_tree
 
         static std::string varname("variable::eval");
         primitive_argument_type result = value_operand_sync(
-            primitive_argument_type{value_}, std::move(fargs),
+            primitive_argument_type{value()}, std::move(fargs),
             varname, state().codename_);
 
         // re-acquire GIL
@@ -368,6 +655,12 @@ namespace phylanx { namespace execution_tree
         phylanx::execution_tree::variable& lhs,                                \
         phylanx::execution_tree::primitive_argument_type const& rhs)           \
     {                                                                          \
+        if (lhs.lazy())                                                        \
+        {                                                                      \
+            return lhs.record("__" #op,                                        \
+                {lhs.operand(), detail::lazy_operand{nullptr, rhs}}, name);    \
+        }                                                                      \
+                                                                               \
         pybind11::gil_scoped_release release;                                  \
         return hpx::threads::run_as_hpx_thread(                                \
             [&]() -> phylanx::execution_tree::variable {                       \
@@ -389,6 +682,10 @@ namespace phylanx { namespace execution_tree
         phylanx::execution_tree::variable& lhs,                                \
         phylanx::execution_tree::variable const& rhs)                          \
     {                                                                          \
+        if (lhs.lazy())                                                        \
+        {                                                                      \
+            return lhs.record("__" #op, {lhs.operand(), rhs.operand()}, name); \
+        }                                                                      \
         return op##_variables_gen(lhs, primitive_argument_type{rhs.value()});  \
     }                                                                          \
                                                                                \
@@ -397,6 +694,12 @@ namespace phylanx { namespace execution_tree
         phylanx::execution_tree::variable& rhs,                                \
         phylanx::execution_tree::primitive_argument_type const& lhs)           \
     {                                                                          \
+        if (rhs.lazy())                                                        \
+        {                                                                      \
+            return rhs.record("__" #op,                                        \
+                {detail::lazy_operand{nullptr, lhs}, rhs.operand()}, name);    \
+        }                                                                      \
+                                                                               \
         pybind11::gil_scoped_release release;                                  \
         return hpx::threads::run_as_hpx_thread(                                \
             [&]() -> phylanx::execution_tree::variable {                       \
@@ -421,6 +724,12 @@ namespace phylanx { namespace execution_tree
         phylanx::execution_tree::variable& lhs,                                \
         phylanx::execution_tree::primitive_argument_type const& rhs)           \
     {                                                                          \
+        if (lhs.lazy())                                                        \
+        {                                                                      \
+            return lhs.record_inplace("__" #op,                                \
+                {lhs.operand(), detail::lazy_operand{nullptr, rhs}}, __name);  \
+        }                                                                      \
+                                                                               \
         pybind11::gil_scoped_release release;                                  \
         return hpx::threads::run_as_hpx_thread(                                \
             [&]() -> phylanx::execution_tree::variable {                       \
@@ -449,6 +758,11 @@ namespace phylanx { namespace execution_tree
         phylanx::execution_tree::variable& lhs,                                \
         phylanx::execution_tree::variable const& rhs)                          \
     {                                                                          \
+        if (lhs.lazy())                                                        \
+        {                                                                      \
+            return lhs.record_inplace(                                         \
+                "__" #op, {lhs.operand(), rhs.operand()}, __name);             \
+        }                                                                      \
         return i##op##_variables_gen(                                          \
             lhs, primitive_argument_type{rhs.value()});                        \
     }                                                                          \
@@ -471,6 +785,11 @@ namespace phylanx { namespace execution_tree
     phylanx::execution_tree::variable unary_minus_variables_gen(    // __neg__
         phylanx::execution_tree::variable& target)
     {
+        if (target.lazy())
+        {
+            return target.record("__minus", {target.operand()}, "Neg");
+        }
+
         pybind11::gil_scoped_release release;
 
         return hpx::threads::run_as_hpx_thread(
@@ -502,11 +821,38 @@ namespace phylanx { namespace execution_tree
     //
     //      variable -= (1 - momentum) * (variable - value)
     //
+    namespace detail
+    {
+        std::vector<lazy_operand> moving_average_operands(lazy_operand&& var,
+            lazy_operand&& value, primitive_argument_type const& momentum)
+        {
+            auto op1 = std::make_shared<lazy_expression>("__sub",
+                std::vector<lazy_operand>{
+                    lazy_operand{nullptr, primitive_argument_type{1.0}},
+                    lazy_operand{nullptr, momentum}});
+            auto op2 = std::make_shared<lazy_expression>("__sub",
+                std::vector<lazy_operand>{var, std::move(value)});
+            auto op3 = std::make_shared<lazy_expression>("__mul",
+                std::vector<lazy_operand>{lazy_operand{std::move(op1), {}},
+                    lazy_operand{std::move(op2), {}}});
+
+            return {std::move(var), lazy_operand{std::move(op3), {}}};
+        }
+    }
+
     phylanx::execution_tree::variable moving_average_variables_gen(
         phylanx::execution_tree::variable& var,
         phylanx::execution_tree::primitive_argument_type const& value,
         phylanx::execution_tree::primitive_argument_type const& momentum)
     {
+        if (var.lazy())
+        {
+            return var.record_inplace("__sub",
+                detail::moving_average_operands(var.operand(),
+                    detail::lazy_operand{nullptr, value}, momentum),
+                "AssignMovingAvg");
+        }
+
         pybind11::gil_scoped_release release;
 
         return hpx::threads::run_as_hpx_thread(
@@ -557,6 +903,13 @@ namespace phylanx { namespace execution_tree
         phylanx::execution_tree::variable const& value,
         phylanx::execution_tree::primitive_argument_type const& momentum)
     {
+        if (var.lazy())
+        {
+            return var.record_inplace("__sub",
+                detail::moving_average_operands(
+                    var.operand(), value.operand(), momentum),
+                "AssignMovingAvg");
+        }
         return moving_average_variables_gen(
             var, primitive_argument_type{value.value()}, momentum);
     }
@@ -13,14 +13,63 @@
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include <utility>
 
 namespace phylanx { namespace execution_tree
 {
+    namespace detail
+    {
+        struct lazy_expression;
+
+        // An operand of an operation recorded in lazy mode, either an
+        // expression that was not materialized yet or a value
+        struct lazy_operand
+        {
+            std::shared_ptr<lazy_expression> expr_;
+            primitive_argument_type value_;
+        };
+
+        // An operation recorded in lazy mode, the whole expression is
+        // compiled into a single function once its value is needed
+        struct lazy_expression
+        {
+            lazy_expression(
+                std::string op, std::vector<lazy_operand>&& operands)
+              : op_(std::move(op))
+              , operands_(std::move(operands))
+              , size_(1)
+              , materialized_(false)
+            {
+                for (auto const& operand : operands_)
+                {
+                    if (operand.expr_ &&
+                        !operand.expr_->materialized_.load(
+                            std::memory_order_acquire))
+                    {
+                        size_ += operand.expr_->size_;
+                    }
+                }
+            }
+
+            std::string op_;                        // PhySL function name
+            std::vector<lazy_operand> operands_;    // cleared once materialized
+
+            // upper bound for the number of operations that are not
+            // materialized yet (shared sub-expressions are counted for each
+            // of their uses), this limits the depth of the expression as well
+            std::size_t size_;
+
+            std::atomic<bool> materialized_;
+            primitive value_;                       // materialized expression
+        };
+    }
+
     struct variable
     {
     private:
@@ -28,6 +77,13 @@ namespace phylanx { namespace execution_tree
             primitive_argument_type&& value, std::string const& name);
         static primitive create_variable(std::string const& name);
 
+        variable(bindings::compiler_state& state,
+            std::shared_ptr<detail::lazy_expression> expr,
+            pybind11::object dtype, char const* name);
+
+        primitive materialize() const;
+        void limit_expression_size() const;
+
         static std::size_t variable_count;
 
     public:
@@ -91,13 +147,20 @@ namespace phylanx { namespace execution_tree
             return name_;
         }
 
+        // The value of a recorded expression is kept by the expression
+        // itself, materializing it does not modify this variable.
         primitive value() const
         {
+            if (expr_)
+            {
+                return materialize();
+            }
             return value_;
         }
         void value(primitive new_value)
         {
             value_ = std::move(new_value);
+            expr_.reset();
 
             if (!shape_.is_none())
             {
@@ -115,6 +178,21 @@ namespace phylanx { namespace execution_tree
             return state_;
         }
 
+        // In lazy mode the arithmetic operations are only recorded, the
+        // resulting expression is compiled and evaluated on first use.
+        bool lazy() const
+        {
+            return state_.lazy_variables;
+        }
+
+        detail::lazy_operand operand() const;
+
+        variable record(std::string op,
+            std::vector<detail::lazy_operand>&& operands,
+            char const* name) const;
+        variable record_inplace(std::string op,
+            std::vector<detail::lazy_operand>&& operands, char const* name);
+
     protected:
         pybind11::object handle_return_f(
             primitive_argument_type&& result, pybind11::ssize_t itemsize) const;
@@ -136,6 +214,7 @@ namespace phylanx { namespace execution_tree
         pybind11::dtype dtype_;
         std::string name_;
         primitive value_;
+        std::shared_ptr<detail::lazy_expression> expr_;
         pybind11::object constraint_;
         pybind11::object shape_;
     };
@@ -16,6 +16,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/serialization/serialize.hpp>
 
+#include <atomic>
 #include <cctype>
 #include <cstdint>
 #include <iosfwd>
@@ -120,6 +121,8 @@ namespace phylanx { namespace execution_tree {
     void annotation::add_annotation(std::string const& key, ir::range&& data,
         std::string const& name, std::string const& codename)
     {
+        version_ = next_version();
+
         if (has_key(key, name, codename))
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -165,6 +168,8 @@ namespace phylanx { namespace execution_tree {
     void annotation::add_annotation(
         annotation&& data, std::string const& name, std::string const& codename)
     {
+        version_ = next_version();
+
         if (has_key(data.get_type(), name, codename))
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -319,6 +324,8 @@ namespace phylanx { namespace execution_tree {
     void annotation::replace_annotation(std::string const& key,
         annotation&& data, std::string const& name, std::string const& codename)
     {
+        version_ = next_version();
+
         if (!has_key(key, name, codename))
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -381,6 +388,13 @@ namespace phylanx { namespace execution_tree {
         replace_annotation("name", info.as_annotation(), name, codename);
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    std::int64_t annotation::next_version()
+    {
+        static std::atomic<std::int64_t> version(0);
+        return ++version;
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     void annotation::serialize(hpx::serialization::output_archive& ar, unsigned)
     {
@@ -464,8 +478,11 @@ namespace phylanx { namespace execution_tree {
     {
         if (!val.has_annotation() && !!ann_)
         {
-            ann_->increment_generation(name, codename);
-            val.set_annotation(std::move(ann_));
+            // the new value gets its own copy of the annotation, the
+            // annotation of the operand must not change
+            auto ann = std::make_shared<annotation>(*ann_);
+            ann->increment_generation(name, codename);
+            val.set_annotation(std::move(ann));
         }
         return std::move(val);
     }
@@ -7,6 +7,7 @@
 #include <phylanx/ast/generate_ast.hpp>
 #include <phylanx/ast/node.hpp>
 #include <phylanx/execution_tree/compile.hpp>
+#include <phylanx/execution_tree/compile_cache.hpp>
 #include <phylanx/execution_tree/compiler/compiler.hpp>
 #include <phylanx/execution_tree/compiler_component.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
@@ -105,6 +106,38 @@ namespace phylanx { namespace execution_tree
         {
             return hpx::util::format("function_{}", ++function_counter);
         }
+
+        // Compile the given source code, reuse the parsed expressions of an
+        // earlier compilation of the same code if the compile cache is
+        // enabled.
+        //
+        // The expressions are compiled again for every use. This creates
+        // new primitive components, independent of the ones created by
+        // earlier compilations, that bind to the variables currently
+        // defined in the environment.
+        static compiler::entry_point const& compile_source(
+            std::string const& name, std::string const& func_name,
+            std::string const& expr, compiler::function_list& snippets,
+            compiler::environment* env, hpx::id_type const& default_locality)
+        {
+            std::vector<ast::expression> exprs;
+            if (!compile_cache_enabled() || !find_compiled(expr, exprs))
+            {
+                exprs = detail::generate_ast(expr);
+                if (compile_cache_enabled())
+                {
+                    add_compiled(expr, exprs);
+                }
+            }
+
+            if (env != nullptr)
+            {
+                return execution_tree::compile(
+                    name, func_name, exprs, snippets, *env, default_locality);
+            }
+            return execution_tree::compile(
+                name, func_name, exprs, snippets, default_locality);
+        }
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -120,8 +153,9 @@ namespace phylanx { namespace execution_tree
         std::string const& expr, compiler::function_list& snippets,
         compiler::environment& env, hpx::id_type const& default_locality)
     {
-        return compile(name, detail::generate_unique_function_name(),
-            ast::generate_ast(expr), snippets, env, default_locality);
+        return detail::compile_source(name,
+            detail::generate_unique_function_name(), expr, snippets,
+            &env, default_locality);
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -129,8 +163,8 @@ namespace phylanx { namespace execution_tree
         compiler::function_list& snippets, compiler::environment& env,
         hpx::id_type const& default_locality)
     {
-        return compile(name, func_name, ast::generate_ast(expr), snippets, env,
-            default_locality);
+        return detail::compile_source(
+            name, func_name, expr, snippets, &env, default_locality);
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -157,8 +191,9 @@ namespace phylanx { namespace execution_tree
         std::string const& expr, compiler::function_list& snippets,
         hpx::id_type const& default_locality)
     {
-        return compile(name, detail::generate_unique_function_name(),
-            ast::generate_ast(expr), snippets, default_locality);
+        return detail::compile_source(name,
+            detail::generate_unique_function_name(), expr, snippets,
+            nullptr, default_locality);
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -173,8 +208,8 @@ namespace phylanx { namespace execution_tree
         std::string const& func_name, std::string const& expr,
         compiler::function_list& snippets, hpx::id_type const& default_locality)
     {
-        return compile(name, func_name, ast::generate_ast(expr), snippets,
-            default_locality);
+        return detail::compile_source(
+            name, func_name, expr, snippets, nullptr, default_locality);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -191,8 +226,9 @@ namespace phylanx { namespace execution_tree
         compiler::function_list& snippets, compiler::environment& env,
         hpx::id_type const& default_locality)
     {
-        return compile("<unknown>", detail::generate_unique_function_name(),
-            ast::generate_ast(expr), snippets, env, default_locality);
+        return detail::compile_source("<unknown>",
+            detail::generate_unique_function_name(), expr, snippets,
+            &env, default_locality);
     }
 
     compiler::entry_point const& compile(
@@ -206,8 +242,9 @@ namespace phylanx { namespace execution_tree
     compiler::entry_point const& compile(std::string const& expr,
         compiler::function_list& snippets, hpx::id_type const& default_locality)
     {
-        return compile("<unknown>", detail::generate_unique_function_name(),
-            ast::generate_ast(expr), snippets, default_locality);
+        return detail::compile_source("<unknown>",
+            detail::generate_unique_function_name(), expr, snippets,
+            nullptr, default_locality);
     }
 
     ///////////////////////////////////////////////////////////////////////////
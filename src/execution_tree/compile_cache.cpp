@@ -0,0 +1,304 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ast/generate_ast.hpp>
+#include <phylanx/ast/node.hpp>
+#include <phylanx/execution_tree/compile_cache.hpp>
+#include <phylanx/execution_tree/compiler/actors.hpp>
+#include <phylanx/execution_tree/compiler/compiler.hpp>
+#include <phylanx/util/serialization/ast.hpp>
+
+#include <hpx/modules/format.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace phylanx { namespace execution_tree
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The parsed source code, compiled again whenever the entry is used.
+        // The AST depends on nothing but the source code, which therefore is
+        // the only part of the key.
+        using compile_cache_key = std::string;
+        using compile_cache_entry = std::vector<ast::expression>;
+
+        // The cache keeps the least recently used entries at the end of the
+        // list, the map refers to the list elements.
+        class compile_cache
+        {
+            using list_type =
+                std::list<std::pair<compile_cache_key, compile_cache_entry>>;
+            using map_type = std::map<compile_cache_key, list_type::iterator>;
+
+        public:
+            compile_cache()
+              : enabled_(hpx::get_config_entry(
+                             "phylanx.compile_cache", "0") == "1")
+              , max_entries_(std::stoul(hpx::get_config_entry(
+                    "phylanx.compile_cache_size", "256")))
+              , hits_(0)
+              , misses_(0)
+            {
+            }
+
+            bool find(compile_cache_key const& key, compile_cache_entry& entry)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                auto it = map_.find(key);
+                if (it == map_.end())
+                {
+                    ++misses_;
+                    return false;
+                }
+
+                // move the entry to the front of the list
+                entries_.splice(entries_.begin(), entries_, it->second);
+                entry = it->second->second;
+
+                ++hits_;
+                return true;
+            }
+
+            void add(compile_cache_key const& key, compile_cache_entry&& entry)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                if (max_entries_ == 0 || map_.find(key) != map_.end())
+                {
+                    return;
+                }
+
+                while (map_.size() >= max_entries_)
+                {
+                    map_.erase(entries_.back().first);
+                    entries_.pop_back();
+                }
+
+                entries_.emplace_front(key, std::move(entry));
+                map_.emplace(entries_.front().first, entries_.begin());
+            }
+
+            void clear()
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                map_.clear();
+                entries_.clear();
+            }
+
+            compile_cache_statistics statistics(bool reset)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                compile_cache_statistics result{
+                    hits_, misses_, std::int64_t(map_.size())};
+                if (reset)
+                {
+                    hits_ = 0;
+                    misses_ = 0;
+                }
+                return result;
+            }
+
+            std::atomic<bool> enabled_;
+
+        private:
+            hpx::lcos::local::spinlock mtx_;
+            list_type entries_;
+            map_type map_;
+            std::size_t max_entries_;
+            std::int64_t hits_;
+            std::int64_t misses_;
+        };
+
+        compile_cache& get_compile_cache()
+        {
+            static compile_cache cache;
+            return cache;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool find_compiled(std::string const& source,
+            std::vector<ast::expression>& exprs)
+        {
+            return get_compile_cache().find(source, exprs);
+        }
+
+        void add_compiled(std::string const& source,
+            std::vector<ast::expression> const& exprs)
+        {
+            get_compile_cache().add(source, compile_cache_entry(exprs));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // the on-disk AST cache uses the (stable) 64 bit FNV-1a hash of the
+        // source code to name the files
+        std::uint64_t source_hash(std::string const& source)
+        {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (char c : source)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        std::int64_t get_pid()
+        {
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+            return ::_getpid();
+#else
+            return ::getpid();
+#endif
+        }
+
+        // the first line of each file identifies the format
+        char const* const ast_cache_magic = "phylanx-ast-cache-1";
+
+        bool read_cached_ast(std::string const& filename,
+            std::string const& source, std::vector<ast::expression>& result)
+        {
+            std::ifstream in(filename, std::ios::binary);
+            if (!in)
+            {
+                return false;
+            }
+
+            std::string magic;
+            std::uint64_t size = 0;
+            if (!std::getline(in, magic) || magic != ast_cache_magic ||
+                !in.read(reinterpret_cast<char*>(&size), sizeof(size)) ||
+                size != source.size())
+            {
+                return false;
+            }
+
+            // guard against hash collisions
+            std::string cached_source(size, '\0');
+            if (!in.read(&cached_source[0], size) || cached_source != source)
+            {
+                return false;
+            }
+
+            std::vector<char> data{std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>()};
+
+            try
+            {
+                result = util::unserialize<std::vector<ast::expression>>(data);
+            }
+            catch (std::exception const&)
+            {
+                return false;
+            }
+            return true;
+        }
+
+        void write_cached_ast(std::string const& filename,
+            std::string const& source, std::vector<ast::expression> const& ast)
+        {
+            std::vector<char> data = util::serialize(ast);
+
+            // write to a temporary file first to make sure no partially
+            // written file is read by concurrently running applications, the
+            // name is unique across processes and threads
+            static std::atomic<std::size_t> counter(0);
+            std::string tmpname = hpx::util::format("{}.{}.{}", filename,
+                get_pid(), ++counter);
+            {
+                std::ofstream out(tmpname, std::ios::binary);
+                if (!out)
+                {
+                    return;
+                }
+
+                std::uint64_t size = source.size();
+                out << ast_cache_magic << '\n';
+                out.write(reinterpret_cast<char const*>(&size), sizeof(size));
+                out.write(source.data(), source.size());
+                out.write(data.data(), data.size());
+                if (!out)
+                {
+                    out.close();
+                    std::remove(tmpname.c_str());
+                    return;
+                }
+            }
+
+            if (std::rename(tmpname.c_str(), filename.c_str()) != 0)
+            {
+                std::remove(tmpname.c_str());
+            }
+        }
+
+        std::vector<ast::expression> generate_ast(std::string const& source)
+        {
+            static std::string const path =
+                hpx::get_config_entry("phylanx.compile_cache_path", "");
+            if (path.empty())
+            {
+                return ast::generate_ast(source);
+            }
+
+            char hash[17];
+            std::snprintf(hash, sizeof(hash), "%016llx",
+                static_cast<unsigned long long>(source_hash(source)));
+
+            std::string filename = hpx::util::format("{}/{}.ast", path, hash);
+
+            std::vector<ast::expression> result;
+            if (!read_cached_ast(filename, source, result))
+            {
+                result = ast::generate_ast(source);
+                write_cached_ast(filename, source, result);
+            }
+            return result;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_compile_cache(bool enable)
+    {
+        detail::get_compile_cache().enabled_ = enable;
+    }
+
+    bool compile_cache_enabled()
+    {
+        return detail::get_compile_cache().enabled_;
+    }
+
+    void clear_compile_cache()
+    {
+        detail::get_compile_cache().clear();
+    }
+
+    compile_cache_statistics get_compile_cache_statistics(bool reset)
+    {
+        return detail::get_compile_cache().statistics(reset);
+    }
+}}
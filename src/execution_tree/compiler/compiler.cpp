@@ -27,6 +27,7 @@
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/runtime.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
 #include <boost/fusion/include/std_pair.hpp>
 #include <boost/spirit/include/qi_attr.hpp>
@@ -141,7 +142,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
         // parse an __arg(_1, _2) construct
         bool parse_argument_value(expression_pattern_list const& patterns,
             ast::expression const& expr, std::string& argname,
-            std::string& value)
+            ast::expression& value)
         {
             using placeholder_map_type =
                 std::multimap<std::string, ast::expression>;
@@ -177,8 +178,22 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             }
 
             argname = std::move(names.second);
-            value = to_string(p->second, true);
+            value = std::move(p->second);
+
+            return true;
+        }
+
+        bool parse_argument_value(expression_pattern_list const& patterns,
+            ast::expression const& expr, std::string& argname,
+            std::string& value)
+        {
+            ast::expression value_ast;
+            if (!parse_argument_value(patterns, expr, argname, value_ast))
+            {
+                return false;
+            }
 
+            value = to_string(value_ast, true);
             return true;
         }
 
@@ -192,9 +207,18 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             using placeholder_map_type =
                 std::multimap<std::string, ast::expression>;
 
-            std::string match = hpx::util::format("{}(__1_args)", name);
+            // the function name is matched by the (otherwise ignored)
+            // placeholder _0, this allows to parse the pattern only once
+            static ast::expression const match =
+                ast::generate_ast("_0(__1_args)")[0];
+
+            if (ast::detail::function_name(expr) != name)
+            {
+                return true;    // could be operator
+            }
+
             placeholder_map_type placeholders;
-            auto result = ast::match_ast(ast::generate_ast(match)[0], expr,
+            auto result = ast::match_ast(match, expr,
                 ast::detail::on_placeholder_match{placeholders});
             if (!result)
                 return true;    // could be operator
@@ -302,6 +326,25 @@ namespace phylanx { namespace execution_tree { namespace compiler {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        std::vector<ast::expression> generate_default_asts(
+            std::vector<std::string> const& defaults)
+        {
+            std::vector<ast::expression> result;
+            result.reserve(defaults.size());
+            for (auto const& value : defaults)
+            {
+                if (value.empty())
+                {
+                    result.emplace_back();
+                }
+                else
+                {
+                    result.push_back(ast::generate_ast(value)[0]);
+                }
+            }
+            return result;
+        }
+
         void insert_pattern(expression_pattern_list& result,
             std::string pattern, match_pattern_type const& p,
             std::string const& suffix)
@@ -336,12 +379,15 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     p.primitive_type_ + suffix,
                     expression_pattern{std::move(pattern), std::move(exprs[0]),
                         p.create_primitive_, std::move(args),
-                        std::move(defaults)}));
+                        std::move(defaults), std::vector<ast::expression>{}}));
             }
             else
             {
                 // reconstruct all patterns (with varying number of default
                 // arguments)
+                std::vector<ast::expression> default_asts =
+                    generate_default_asts(defaults);
+
                 for (std::size_t i = defaults.size() + 1; i != 0; --i)
                 {
                     std::string resulting_pattern =
@@ -353,7 +399,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                         p.primitive_type_ + suffix,
                         expression_pattern{std::move(resulting_pattern),
                             std::move(exprs[0]), p.create_primitive_, args,
-                            defaults}));
+                            defaults, default_asts}));
                 }
             }
         }
@@ -391,12 +437,198 @@ namespace phylanx { namespace execution_tree { namespace compiler {
         }
     }    // namespace detail
 
+    ///////////////////////////////////////////////////////////////////////////
     expression_pattern_list const& generate_patterns()
     {
         static expression_pattern_list patterns = detail::generate_patterns();
         return patterns;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // alternatives of ast::operand and ast::primary_expr that are
+        // distinguished by the index
+        constexpr std::size_t operand_primary_expr = 1;
+        constexpr std::size_t operand_unary_expr = 2;
+        constexpr std::size_t primary_expr_identifier = 3;
+        constexpr std::size_t primary_expr_function_call = 7;
+
+        // Calculate the key under which patterns that could match the given
+        // expression are indexed. Return false if the expression could match
+        // any pattern (or any expression, if it is a pattern).
+        bool pattern_index_key(ast::expression const& expr, std::string& key,
+            std::size_t& arity, bool& variadic)
+        {
+            ast::expression const& e = ast::detail::extract_expression(expr);
+            if (ast::detail::is_placeholder(e))
+            {
+                return false;
+            }
+
+            arity = 0;
+            variadic = false;
+
+            if (!e.rest.empty())
+            {
+                key = "<operation>";
+                return true;
+            }
+
+            if (e.first.index() != operand_primary_expr)
+            {
+                if (e.first.index() == operand_unary_expr)
+                {
+                    key = "<unary>" +
+                        std::to_string(static_cast<int>(
+                            util::get<operand_unary_expr>(e.first.get())
+                                .get()
+                                .operator_));
+                }
+                else
+                {
+                    key = "<nil>";
+                }
+                return true;
+            }
+
+            ast::primary_expr const& pe =
+                util::get<operand_primary_expr>(e.first.get()).get();
+            if (pe.index() == primary_expr_identifier)
+            {
+                key = "<identifier>" +
+                    util::get<primary_expr_identifier>(pe.get()).name;
+                return true;
+            }
+
+            if (pe.index() != primary_expr_function_call)
+            {
+                key = "<primary>" + std::to_string(pe.index());
+                return true;
+            }
+
+            // function calls are indexed by name and number of arguments
+            ast::function_call const& fc =
+                util::get<primary_expr_function_call>(pe.get()).get();
+            if (ast::detail::is_placeholder(fc.function_name))
+            {
+                return false;
+            }
+
+            key = fc.function_name.name;
+            for (auto const& arg : fc.args)
+            {
+                if (ast::detail::is_placeholder_ellipses(arg))
+                {
+                    variadic = true;
+                    break;
+                }
+                ++arity;
+            }
+            return true;
+        }
+    }
+
+    expression_pattern_index::expression_pattern_index(
+        patterns_type const& patterns)
+      : size_(patterns.size())
+    {
+        struct pattern_key
+        {
+            std::string key_;
+            candidate candidate_;
+            bool wildcard_;
+        };
+
+        // all indexed patterns have to be inserted in the order they appear
+        // in the pattern list, patterns that match anything are added to
+        // all keys
+        std::vector<pattern_key> keys;
+        keys.reserve(patterns.size());
+        all_.reserve(patterns.size());
+
+        for (auto it = patterns.begin(); it != patterns.end(); ++it)
+        {
+            pattern_key k{std::string{}, candidate{it, 0, false}, false};
+            k.wildcard_ = !detail::pattern_index_key(it->second.pattern_ast_,
+                k.key_, k.candidate_.min_arity_, k.candidate_.variadic_);
+            if (!k.wildcard_)
+            {
+                candidates_[k.key_];
+            }
+            keys.push_back(std::move(k));
+            all_.push_back(it);
+        }
+
+        for (auto& k : keys)
+        {
+            if (k.wildcard_)
+            {
+                for (auto& c : candidates_)
+                {
+                    c.second.push_back(k.candidate_);
+                }
+                wildcards_.push_back(k.candidate_);
+            }
+            else
+            {
+                candidates_[k.key_].push_back(k.candidate_);
+            }
+        }
+    }
+
+    std::vector<expression_pattern_index::const_iterator>
+    expression_pattern_index::find(ast::expression const& expr) const
+    {
+        std::string key;
+        std::size_t arity = 0;
+        bool variadic = false;
+        if (!detail::pattern_index_key(expr, key, arity, variadic))
+        {
+            return all_;
+        }
+
+        auto it = candidates_.find(key);
+        std::vector<candidate> const& candidates =
+            it != candidates_.end() ? it->second : wildcards_;
+
+        std::vector<const_iterator> result;
+        result.reserve(candidates.size());
+        for (auto const& c : candidates)
+        {
+            // variadic arguments may match any number of arguments
+            if (variadic || arity == c.min_arity_ ||
+                (c.variadic_ && arity > c.min_arity_))
+            {
+                result.push_back(c.pattern_);
+            }
+        }
+        return result;
+    }
+
+    std::shared_ptr<expression_pattern_index const>
+    expression_pattern_list::index() const
+    {
+        {
+            std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+            if (index_)
+            {
+                return index_;
+            }
+        }
+
+        // build the index without holding the lock
+        auto index =
+            std::make_shared<expression_pattern_index const>(patterns_);
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        if (!index_)
+        {
+            index_ = std::move(index);
+        }
+        return index_;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct compiler_helper
     {
@@ -407,6 +639,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
           , env_(env)
           , snippets_(snippets)
           , patterns_(patterns)
+          , index_(patterns.index())
           , default_locality_(default_locality)
         {
         }
@@ -1325,8 +1558,14 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                         continue;    // skip arguments that have no default value
                     }
 
+                    // the default values are parsed when creating the
+                    // patterns
+                    auto const& default_asts = it->second.default_asts_;
                     ast::expression default_expr =
-                        ast::generate_ast(it->second.defaults_[default_arg])[0];
+                        default_arg < default_asts.size() ?
+                            default_asts[default_arg] :
+                            ast::generate_ast(
+                                it->second.defaults_[default_arg])[0];
 
                     fargs[base + pos] = compile(name_, default_expr, snippets_,
                         env, patterns_, locality)
@@ -1347,7 +1586,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                 {
                     // named argument
                     std::string argname;
-                    std::string value;
+                    ast::expression value;
 
                     if (detail::parse_argument_value(
                             patterns_, argexpr, argname, value))
@@ -1371,10 +1610,9 @@ namespace phylanx { namespace execution_tree { namespace compiler {
 
                         // place the keyword argument into the argument slot
                         // it belongs
-                        fargs[base + pos] =
-                            compile(name_, ast::generate_ast(value)[0],
-                                snippets_, env, patterns_, locality)
-                                .arg_;
+                        fargs[base + pos] = compile(name_, value, snippets_,
+                            env, patterns_, locality)
+                                                .arg_;
                         args_valid[pos] = true;
 
                         count = base + pos + 1;
@@ -1556,6 +1794,183 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             return fullname;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Nested expressions built exclusively from the binary element-wise
+        // arithmetic operations are compiled into a single __fused primitive
+        // that evaluates the whole expression tree in one pass over the data.
+        static bool get_fuse_elementwise()
+        {
+            static bool fuse_elementwise =
+                hpx::get_config_entry("phylanx.fuse_elementwise", "1") == "1";
+            return fuse_elementwise;
+        }
+
+        static char elementwise_opcode(std::string const& name)
+        {
+            if (name == "__add")
+                return '+';
+            if (name == "__sub")
+                return '-';
+            if (name == "__mul")
+                return '*';
+            if (name == "__div")
+                return '/';
+            return '\0';
+        }
+
+        static bool is_elementwise_operation(
+            std::string const& name, placeholder_map_type const& placeholders)
+        {
+            if (elementwise_opcode(name) == '\0' || placeholders.size() < 2)
+            {
+                return false;
+            }
+
+            // keyword arguments are diagnosed by the non-fused primitives
+            for (auto const& placeholder : placeholders)
+            {
+                if (ast::detail::is_function_call(placeholder.second) &&
+                    ast::detail::function_name(placeholder.second) == "__arg")
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // find the element-wise operation the given expression would be
+        // compiled into (if any), this mirrors the matching performed by
+        // operator()
+        std::string match_elementwise_operation(
+            ast::expression const& expr, placeholder_map_type& placeholders)
+        {
+            if (ast::detail::is_function_call(expr))
+            {
+                std::string const& function_name =
+                    ast::detail::function_name(expr);
+                if (elementwise_opcode(function_name) == '\0')
+                {
+                    return std::string{};
+                }
+
+                for (auto cit : index_->find(expr))
+                {
+                    if (cit->first != function_name)
+                    {
+                        continue;
+                    }
+
+                    placeholders.clear();
+                    if (ast::match_ast(expr, cit->second.pattern_ast_,
+                            ast::detail::on_placeholder_match{placeholders}))
+                    {
+                        return function_name;
+                    }
+                }
+                return std::string{};
+            }
+
+            for (auto cit : index_->find(expr))
+            {
+                placeholders.clear();
+                if (ast::match_ast(expr, cit->second.pattern_ast_,
+                        ast::detail::on_placeholder_match{placeholders}))
+                {
+                    return cit->first;
+                }
+            }
+            return std::string{};
+        }
+
+        // Collect the leaf operands of the given element-wise operation while
+        // recording the operations in reverse polish notation, returns the
+        // number of operations collected.
+        std::size_t collect_elementwise_operation(std::string const& name,
+            placeholder_map_type const& placeholders,
+            std::vector<ast::expression>& leaves, std::string& program)
+        {
+            std::size_t count = 0;
+            bool first = true;
+            for (auto const& placeholder : placeholders)
+            {
+                placeholder_map_type nested;
+                std::string const nested_name =
+                    match_elementwise_operation(placeholder.second, nested);
+
+                if (is_elementwise_operation(nested_name, nested))
+                {
+                    count += collect_elementwise_operation(
+                        nested_name, nested, leaves, program);
+                }
+                else
+                {
+                    program += std::to_string(leaves.size());
+                    program += ' ';
+                    leaves.push_back(placeholder.second);
+                }
+
+                // n-ary operations are evaluated left to right
+                if (!first)
+                {
+                    program += elementwise_opcode(name);
+                    program += ' ';
+                    ++count;
+                }
+                first = false;
+            }
+            return count;
+        }
+
+        bool handle_elementwise_fusion(placeholder_map_type const& placeholders,
+            std::string const& name, ast::tagged id, function& result)
+        {
+            if (!get_fuse_elementwise() ||
+                !is_elementwise_operation(name, placeholders))
+            {
+                return false;
+            }
+
+            std::vector<ast::expression> leaves;
+            std::string program;
+            if (collect_elementwise_operation(
+                    name, placeholders, leaves, program) < 2)
+            {
+                return false;   // nothing to gain from fusing
+            }
+
+            compiled_function* cf = env_.find("__fused");
+            if (cf == nullptr)
+            {
+                return false;
+            }
+
+            // add sequence number for this primitive component
+            std::size_t sequence_number =
+                snippets_.sequence_numbers_["__fused"]++;
+
+            // get global name of the component created
+            primitive_name_parts name_parts("__fused", sequence_number, id.id,
+                id.col, snippets_.compile_id_ - 1,
+                get_locality_id(default_locality_));
+
+            program.pop_back();     // remove trailing blank
+
+            std::list<function> args;
+            args.emplace_back(primitive_argument_type{std::move(program)});
+
+            primitive_arguments_type fargs;
+            handle_function_call_argument(
+                "__fused", fargs, leaves, default_locality_, id);
+
+            for (auto&& arg : std::move(fargs))
+            {
+                args.emplace_back(std::move(arg));
+            }
+
+            result = (*cf)(std::move(args), std::move(name_parts), name_);
+            return true;
+        }
+
     public:
         function operator()(ast::expression const& expr)
         {
@@ -1643,21 +2058,32 @@ namespace phylanx { namespace execution_tree { namespace compiler {
                     //     }
                     // }
 
-                    // handle all non-special functions
-                    while (
-                        cit != patterns_.end() && (*cit).first == function_name)
+                    // handle all non-special functions, only patterns with
+                    // a matching name and arity have to be considered
+                    for (auto pit : index_->find(expr))
                     {
+                        if (pit->first != function_name)
+                        {
+                            continue;
+                        }
+
                         placeholder_map_type placeholders;
-                        if (!ast::match_ast(expr, cit->second.pattern_ast_,
+                        if (!ast::match_ast(expr, pit->second.pattern_ast_,
                                 ast::detail::on_placeholder_match{
                                     placeholders}))
                         {
-                            ++cit;
                             continue;    // no match found for the current pattern
                         }
 
+                        function fused;
+                        if (handle_elementwise_fusion(
+                                placeholders, pit->first, id, fused))
+                        {
+                            return fused;
+                        }
+
                         return handle_placeholders(
-                            placeholders, (*cit).first, id);
+                            placeholders, pit->first, id);
                     }
                 }
                 else
@@ -1667,17 +2093,25 @@ namespace phylanx { namespace execution_tree { namespace compiler {
             }
             else
             {
-                // this should handle all remaining constructs (non-function calls)
-                for (auto const& pattern : patterns_)
+                // this should handle all remaining constructs (non-function
+                // calls), only patterns of the same kind have to be considered
+                for (auto pit : index_->find(expr))
                 {
                     placeholder_map_type placeholders;
-                    if (!ast::match_ast(expr, pattern.second.pattern_ast_,
+                    if (!ast::match_ast(expr, pit->second.pattern_ast_,
                             ast::detail::on_placeholder_match{placeholders}))
                     {
                         continue;    // no match found for the current pattern
                     }
 
-                    return handle_placeholders(placeholders, pattern.first, id);
+                    function fused;
+                    if (handle_elementwise_fusion(
+                            placeholders, pit->first, id, fused))
+                    {
+                        return fused;
+                    }
+
+                    return handle_placeholders(placeholders, pit->first, id);
                 }
             }
 
@@ -1772,6 +2206,7 @@ namespace phylanx { namespace execution_tree { namespace compiler {
         environment& env_;           // current compilation environment
         function_list& snippets_;    // list of compiled snippets
         expression_pattern_list const& patterns_;
+        std::shared_ptr<expression_pattern_index const> index_;
         hpx::id_type default_locality_;
     };
 
@@ -45,6 +45,11 @@ namespace phylanx { namespace execution_tree
         locality_ =
             extract_locality_information(ann, name, codename);
 
+        if (arg.has_annotation())
+        {
+            version_ = arg.annotation()->version();
+        }
+
         // extract the globally unique name identifying this object
         annotation name_ann;
         if (!ann.find("name", name_ann, name, codename))
@@ -67,7 +67,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto const* target = ctx.get_var(target_name_);
+        auto const* target = ctx.get_var(target_name_, target_location_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -119,7 +119,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, target_location_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -152,7 +152,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, target_location_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
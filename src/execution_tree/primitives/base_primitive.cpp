@@ -60,7 +60,8 @@ namespace phylanx { namespace execution_tree
             "phylanx::execution_tree::primitive",
             "hpx::shared_future<phylanx::execution_tree::primitive_argument_type>",
             "phylanx::ir::range",
-            "phylanx::ir::dictionary"
+            "phylanx::ir::dictionary",
+            "phylanx::ir::node_data<float>"
         };
 
         char const* get_primitive_argument_type_name(std::size_t index)
@@ -441,6 +442,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -497,6 +499,17 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy(), val.annotation()};
+                }
+                return primitive_argument_type{v, val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto const& args = util::get<7>(val);
@@ -614,6 +627,17 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v, val.annotation()};
+                }
+                return primitive_argument_type{v.ref(), val.annotation()};
+            }
+            break;
+
         default:
             break;
         }
@@ -645,6 +669,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
             return std::move(val);
@@ -709,6 +734,17 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto&& v = util::get<9>(std::move(val));
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy(), val.annotation()};
+                }
+                return primitive_argument_type{std::move(v), val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto ann = val.annotation();
@@ -779,6 +815,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -813,6 +850,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).is_ref();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).is_ref();
+
         case primitive_argument_type::list_index:
             return util::get<7>(val).is_ref();
 
@@ -852,6 +892,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
             return val;
@@ -909,6 +950,17 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case primitive_argument_type::float32_index:
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v, val.annotation()};
+                }
+                return primitive_argument_type{v.ref(), val.annotation()};
+            }
+            break;
+
         case primitive_argument_type::list_index:
             {
                 auto const& r = util::get<7>(val);
@@ -960,6 +1012,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
             return std::move(val);
@@ -992,6 +1045,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             return true;
 
@@ -1023,6 +1077,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).ref();
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<double>{util::get<9>(val).ref()};
+
         case primitive_argument_type::future_index:
             return extract_numeric_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1092,6 +1149,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(std::move(val));
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<double>{util::get<9>(std::move(val))};
+
         case primitive_argument_type::future_index: {
             auto f = util::get<6>(val).get();
             val = f.get();
@@ -1137,6 +1197,11 @@ namespace phylanx { namespace execution_tree
                 return util::get<4>(val)[0];
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return util::get<9>(val)[0];
+            break;
+
         case primitive_argument_type::future_index:
             return extract_scalar_numeric_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1215,6 +1280,11 @@ namespace phylanx { namespace execution_tree
                 return util::get<4>(std::move(val))[0];
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return util::get<9>(std::move(val))[0];
+            break;
+
         case primitive_argument_type::future_index: {
             auto f = util::get<6>(val).get();
             val = f.get();
@@ -1318,6 +1388,7 @@ namespace phylanx { namespace execution_tree
         {
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             return true;
 
@@ -1358,6 +1429,212 @@ namespace phylanx { namespace execution_tree
         return false;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    ir::node_data<float> extract_float32_value(
+        primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return ir::node_data<float>{util::get<1>(val).ref()};
+
+        case primitive_argument_type::int64_index:
+            return ir::node_data<float>{util::get<2>(val).ref()};
+
+        case primitive_argument_type::float64_index:
+            return ir::node_data<float>{util::get<4>(val).ref()};
+
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).ref();
+
+        case primitive_argument_type::future_index:
+            return extract_float32_value(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float32_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a numeric "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<float> extract_float32_value(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return ir::node_data<float>{util::get<1>(std::move(val))};
+
+        case primitive_argument_type::int64_index:
+            return ir::node_data<float>{util::get<2>(std::move(val))};
+
+        case primitive_argument_type::float64_index:
+            return ir::node_data<float>{util::get<4>(std::move(val))};
+
+        case primitive_argument_type::float32_index:
+            return util::get<9>(std::move(val));
+
+        case primitive_argument_type::future_index: {
+            auto f = util::get<6>(val).get();
+            val = f.get();
+            return extract_float32_value(std::move(val), name, codename);
+        }
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float32_value",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a numeric "
+                    "value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<float> extract_float32_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).ref();
+
+        case primitive_argument_type::future_index:
+            return extract_float32_value_strict(
+                util::get<6>(val).get().get(), name, codename);
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float32_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a single precision "
+                    "floating point value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    ir::node_data<float>&& extract_float32_value_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float32_index:
+            return util::get<9>(std::move(val));
+
+        case primitive_argument_type::future_index: {
+            auto f = util::get<6>(val).get();
+            val = f.get();
+            return extract_float32_value_strict(std::move(val), name, codename);
+        }
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+
+        std::string type(detail::get_primitive_argument_type_name(val.index()));
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::extract_float32_value_strict",
+            util::generate_error_message(
+                "primitive_argument_type does not hold a single precision "
+                    "floating point value type (type held: '" + type + "')",
+                name, codename));
+    }
+
+    bool is_float32_operand_strict(primitive_argument_type const& val)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::float32_index:
+            return true;
+
+        case primitive_argument_type::future_index:
+            return is_float32_operand_strict(util::get<6>(val).get().get());
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+        return false;
+    }
+
+    bool is_sparse_operand(primitive_argument_type const& val)
+    {
+        switch (val.index())
+        {
+        case primitive_argument_type::bool_index:
+            return util::get<1>(val).is_sparse();
+
+        case primitive_argument_type::int64_index:
+            return util::get<2>(val).is_sparse();
+
+        case primitive_argument_type::float64_index:
+            return util::get<4>(val).is_sparse();
+
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).is_sparse();
+
+        case primitive_argument_type::future_index:
+            return is_sparse_operand(util::get<6>(val).get().get());
+
+        case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::string_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::list_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+        return false;
+    }
+
     std::size_t extract_numeric_value_dimension(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
@@ -1373,6 +1650,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).num_dimensions();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).num_dimensions();
+
         case primitive_argument_type::future_index:
             return extract_numeric_value_dimension(
                 util::get<6>(val).get().get(), name, codename);
@@ -1410,6 +1690,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).size();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).size();
+
         case primitive_argument_type::future_index:
             return extract_numeric_value_size(
                 util::get<6>(val).get().get(), name, codename);
@@ -1447,6 +1730,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return util::get<4>(val).dimensions();
 
+        case primitive_argument_type::float32_index:
+            return util::get<9>(val).dimensions();
+
         case primitive_argument_type::future_index:
             return extract_numeric_value_dimensions(
                 util::get<6>(val).get().get(), name, codename);
@@ -1484,6 +1770,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1509,6 +1796,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return ir::node_data<std::int64_t>(util::get<4>(val).ref());
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::int64_t>(util::get<9>(val).ref());
+
         case primitive_argument_type::future_index:
             return extract_integer_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1546,6 +1836,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return ir::node_data<std::int64_t>(util::get<4>(std::move(val)));
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::int64_t>(util::get<9>(std::move(val)));
+
         case primitive_argument_type::future_index:
             return extract_integer_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1589,6 +1882,11 @@ namespace phylanx { namespace execution_tree
                 return std::int64_t(util::get<4>(val)[0]);
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<9>(val)[0]);
+            break;
+
         case primitive_argument_type::future_index:
             return extract_scalar_integer_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1633,6 +1931,11 @@ namespace phylanx { namespace execution_tree
                 return std::int64_t(util::get<4>(std::move(val))[0]);
             break;
 
+        case primitive_argument_type::float32_index:
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<9>(std::move(val))[0]);
+            break;
+
         case primitive_argument_type::future_index:
             return extract_scalar_integer_value(
                 util::get<6>(val).get().get(), name, codename);
@@ -1662,6 +1965,7 @@ namespace phylanx { namespace execution_tree
         {
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             return true;
 
@@ -1699,6 +2003,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1734,6 +2039,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1768,6 +2074,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1803,6 +2110,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1833,6 +2141,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -1984,6 +2293,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return ir::node_data<std::uint8_t>{util::get<4>(val).ref()};
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::uint8_t>{util::get<9>(val).ref()};
+
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -2015,6 +2327,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2047,6 +2360,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return ir::node_data<std::uint8_t>{util::get<4>(std::move(val))};
 
+        case primitive_argument_type::float32_index:
+            return ir::node_data<std::uint8_t>{util::get<9>(std::move(val))};
+
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
@@ -2079,6 +2395,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2115,6 +2432,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return bool(util::get<4>(val));
 
+        case primitive_argument_type::float32_index:
+            return bool(util::get<9>(val));
+
         case primitive_argument_type::list_index:
             return !(util::get<7>(val).empty());
 
@@ -2154,6 +2474,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return bool(util::get<4>(std::move(val)));
 
+        case primitive_argument_type::float32_index:
+            return bool(util::get<9>(std::move(val)));
+
         case primitive_argument_type::list_index:
             return !(util::get<7>(std::move(val)).empty());
 
@@ -2188,6 +2511,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
@@ -2218,6 +2542,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
@@ -2244,6 +2569,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index:
             return true;
 
@@ -2268,6 +2594,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2292,6 +2619,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2321,6 +2649,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2349,6 +2678,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2371,6 +2701,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -2400,6 +2731,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -2428,6 +2760,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
@@ -2454,6 +2787,9 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return {ast::expression(util::get<4>(val))};
 
+        case primitive_argument_type::float32_index:
+            return {ast::expression(ir::node_data<double>{util::get<9>(val)})};
+
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
@@ -2488,6 +2824,10 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::float64_index:
             return {ast::expression(util::get<4>(std::move(val)))};
 
+        case primitive_argument_type::float32_index:
+            return {ast::expression(
+                ir::node_data<double>{util::get<9>(std::move(val))})};
+
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::nil_index: HPX_FALLTHROUGH;
         case primitive_argument_type::bool_index: HPX_FALLTHROUGH;
@@ -2533,6 +2873,10 @@ namespace phylanx { namespace execution_tree
             return primitive_arguments_type{primitive_argument_type{
                 util::get<4>(val).ref(), val.annotation()}};
 
+        case primitive_argument_type::float32_index:
+            return primitive_arguments_type{primitive_argument_type{
+                util::get<9>(val).ref(), val.annotation()}};
+
         case primitive_argument_type::list_index:
             return util::get<7>(val);
 
@@ -2560,6 +2904,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index:
@@ -2590,6 +2935,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2616,6 +2962,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2645,6 +2992,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2675,6 +3023,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2703,6 +3052,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::dictionary_index: HPX_FALLTHROUGH;
@@ -2724,6 +3074,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2741,6 +3092,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
             return true;
 
@@ -2768,6 +3120,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2797,6 +3150,7 @@ namespace phylanx { namespace execution_tree
         case primitive_argument_type::int64_index: HPX_FALLTHROUGH;
         case primitive_argument_type::string_index: HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index: HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index: HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index: HPX_FALLTHROUGH;
         case primitive_argument_type::future_index: HPX_FALLTHROUGH;
         case primitive_argument_type::list_index: HPX_FALLTHROUGH;
@@ -2834,6 +3188,8 @@ namespace phylanx { namespace execution_tree
             HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
+            HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index:
             HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
@@ -2873,6 +3229,8 @@ namespace phylanx { namespace execution_tree
             HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
+            HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index:
             HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
@@ -2912,6 +3270,8 @@ namespace phylanx { namespace execution_tree
             HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
+            HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index:
             HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
@@ -2949,6 +3309,8 @@ namespace phylanx { namespace execution_tree
             HPX_FALLTHROUGH;
         case primitive_argument_type::float64_index:
             HPX_FALLTHROUGH;
+        case primitive_argument_type::float32_index:
+            HPX_FALLTHROUGH;
         case primitive_argument_type::primitive_index:
             HPX_FALLTHROUGH;
         case primitive_argument_type::future_index:
@@ -4453,6 +4815,10 @@ namespace phylanx { namespace execution_tree
             ast::detail::to_string{os}(util::get<4>(val));
             break;
 
+        case primitive_argument_type::float32_index:
+            os << util::get<9>(val);
+            break;
+
         case primitive_argument_type::primitive_index:
             break;
 
@@ -4585,6 +4951,10 @@ namespace std
             return phylanx::execution_tree::hash_node_data_zero_dim_value(
                 phylanx::util::get<4>(val));
 
+        case primitive_argument_type::float32_index:
+            return phylanx::execution_tree::hash_node_data_zero_dim_value(
+                phylanx::util::get<9>(val));
+
         case primitive_argument_type::future_index:
             return (*this)(phylanx::util::get<6>(val).get().get());
 
@@ -1,10 +1,11 @@
-//  Copyright (c) 2017-2018 Hartmut Kaiser
+//  Copyright (c) 2017-2020 Hartmut Kaiser
 //
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/enable_tracing.hpp>
+#include <phylanx/util/execution_trace.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -32,12 +33,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
     match_pattern_type const enable_tracing::match_data =
     {
         hpx::make_tuple("enable_tracing",
-            std::vector<std::string>{"enable_tracing(_1)"},
+            std::vector<std::string>{
+                "enable_tracing(_1)", "enable_tracing(_1, _2)"},
             &create_enable_tracing, &create_primitive<enable_tracing>,
-            R"(eon
+            R"(eon, kind
             Args:
 
                 eon (boolean) : set to true/false to enable/disable tracing.
+                kind (string, optional) : the kind of tracing to enable or
+                    disable, either 'log' (default, writes debug log
+                    entries) or 'timeline' (records the execution trace
+                    that can be retrieved in the Chrome trace format).
 
             Returns:)"
             )
@@ -54,26 +60,51 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
     {
-        if (operands.size() != 1)
+        if (operands.empty() || operands.size() > 2)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
                 "enable_tracing::eval",
                 generate_error_message(
-                    "expected one (boolean) argument", std::move(ctx)));
+                    "expected one (boolean) argument and an optional kind "
+                    "of tracing", std::move(ctx)));
         }
 
-        if (!valid(operands[0]))
+        if (!valid(operands[0]) ||
+            (operands.size() == 2 && !valid(operands[1])))
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter, "enable_tracing::eval",
                 generate_error_message(
                     "the enable_tracing primitive requires that the "
-                    "argument given by the operand is valid",
+                    "arguments given by the operands are valid",
                     std::move(ctx)));
         }
 
-        primitive::enable_tracing =
-            scalar_boolean_operand_sync(
-                operands[0], args, name_, codename_, std::move(ctx)) != 0;
+        std::string kind("log");
+        if (operands.size() == 2)
+        {
+            kind = string_operand_sync(
+                operands[1], args, name_, codename_, ctx);
+        }
+
+        bool enable = scalar_boolean_operand_sync(
+                          operands[0], args, name_, codename_, ctx) != 0;
+
+        if (kind == "log")
+        {
+            primitive::enable_tracing = enable;
+        }
+        else if (kind == "timeline")
+        {
+            util::enable_execution_trace(enable);
+        }
+        else
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "enable_tracing::eval",
+                generate_error_message(
+                    "the kind of tracing must be either 'log' or "
+                    "'timeline'",
+                    std::move(ctx)));
+        }
 
         return hpx::make_ready_future(primitive_argument_type{});
     }
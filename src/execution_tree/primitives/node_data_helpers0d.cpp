@@ -35,6 +35,10 @@ namespace phylanx { namespace execution_tree
         {
             result = node_data_type_int64;
         }
+        else if (spec == "float32")
+        {
+            result = node_data_type_float32;
+        }
         else if (spec.find("float") == 0)
         {
             result = node_data_type_double;
@@ -66,6 +70,10 @@ namespace phylanx { namespace execution_tree
         {
             result = node_data_type_double;
         }
+        else if (is_float32_operand_strict(arg))
+        {
+            result = node_data_type_float32;
+        }
         else if (is_integer_operand_strict(arg))
         {
             result = node_data_type_int64;
@@ -89,6 +97,10 @@ namespace phylanx { namespace execution_tree
                 result = node_data_type_double;
                 break;
             }
+            else if (is_float32_operand_strict(arg))
+            {
+                result = node_data_type_float32;
+            }
             else if (is_integer_operand_strict(arg) &&
                 (result == node_data_type_unknown ||
                     result == node_data_type_bool))
@@ -348,6 +360,9 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_scalar<double>(primitive_argument_type const& val,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_scalar<float>(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_scalar<std::int64_t>(primitive_argument_type const& val,
         std::string const& name, std::string const& codename);
@@ -358,6 +373,9 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_scalar<double>(primitive_argument_type&& val,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_scalar<float>(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_scalar<std::int64_t>(primitive_argument_type&& val,
         std::string const& name, std::string const& codename);
@@ -208,6 +208,9 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_vector<double>(primitive_argument_type const& val,
         std::size_t size, std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_vector<float>(primitive_argument_type const& val,
+        std::size_t size, std::string const& name, std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_vector<std::int64_t>(primitive_argument_type const& val,
         std::size_t size, std::string const& name, std::string const& codename);
@@ -218,6 +221,9 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_vector<double>(primitive_argument_type&& val,
         std::size_t size, std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_vector<float>(primitive_argument_type&& val,
+        std::size_t size, std::string const& name, std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_vector<std::int64_t>(primitive_argument_type&& val,
         std::size_t size, std::string const& name, std::string const& codename);
@@ -240,6 +240,10 @@ namespace phylanx { namespace execution_tree
         primitive_argument_type const& val, std::size_t rows,
         std::size_t columns, std::string const& name,
         std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float> extract_value_matrix<float>(
+        primitive_argument_type const& val, std::size_t rows,
+        std::size_t columns, std::string const& name,
+        std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_matrix<std::int64_t>(primitive_argument_type const& val,
         std::size_t rows, std::size_t columns, std::string const& name,
@@ -252,6 +256,9 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<double> extract_value_matrix<double>(
         primitive_argument_type&& val, std::size_t rows, std::size_t columns,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float> extract_value_matrix<float>(
+        primitive_argument_type&& val, std::size_t rows, std::size_t columns,
+        std::string const& name, std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_matrix<std::int64_t>(primitive_argument_type&& val,
         std::size_t rows, std::size_t columns, std::string const& name,
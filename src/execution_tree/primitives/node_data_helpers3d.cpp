@@ -334,6 +334,10 @@ namespace phylanx { namespace execution_tree
     extract_value_tensor<double>( primitive_argument_type const& val,
         std::size_t pages, std::size_t rows, std::size_t columns,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_tensor<float>( primitive_argument_type const& val,
+        std::size_t pages, std::size_t rows, std::size_t columns,
+        std::string const& name, std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_tensor<std::int64_t>(primitive_argument_type const& val,
         std::size_t pages, std::size_t rows, std::size_t columns,
@@ -347,6 +351,10 @@ namespace phylanx { namespace execution_tree
     extract_value_tensor<double>(primitive_argument_type&& val,
         std::size_t pages, std::size_t rows, std::size_t columns,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_tensor<float>(primitive_argument_type&& val,
+        std::size_t pages, std::size_t rows, std::size_t columns,
+        std::string const& name, std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_tensor<std::int64_t>(primitive_argument_type&& val,
         std::size_t pages, std::size_t rows, std::size_t columns,
@@ -717,6 +717,10 @@ namespace phylanx { namespace execution_tree
         primitive_argument_type const& val, std::size_t quats,
         std::size_t pages, std::size_t rows, std::size_t columns,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float> extract_value_quatern<float>(
+        primitive_argument_type const& val, std::size_t quats,
+        std::size_t pages, std::size_t rows, std::size_t columns,
+        std::string const& name, std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_quatern<std::int64_t>(primitive_argument_type const& val,
         std::size_t quats, std::size_t pages, std::size_t rows,
@@ -732,6 +736,10 @@ namespace phylanx { namespace execution_tree
         primitive_argument_type&& val, std::size_t quats, std::size_t pages,
         std::size_t rows, std::size_t columns, std::string const& name,
         std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float> extract_value_quatern<float>(
+        primitive_argument_type&& val, std::size_t quats, std::size_t pages,
+        std::size_t rows, std::size_t columns, std::string const& name,
+        std::string const& codename);
     template PHYLANX_EXPORT ir::node_data<std::int64_t>
     extract_value_quatern<std::int64_t>(primitive_argument_type&& val,
         std::size_t quats, std::size_t pages, std::size_t rows,
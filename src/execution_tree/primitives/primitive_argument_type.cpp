@@ -13,6 +13,7 @@
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/include/serialization.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -54,14 +55,33 @@ namespace phylanx { namespace execution_tree
         hpx::serialization::output_archive& ar, unsigned)
     {
         int lang = static_cast<int>(lang_);
-        ar & variables_ & lang & name_ & codename_;
+        std::size_t size = variables_.size();
+        ar & size;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            auto& var = variables_[i];
+            ar & var.first & var.second;
+        }
+        ar & lang & name_ & codename_;
     }
 
     void variable_frame::serialize(
         hpx::serialization::input_archive& ar, unsigned)
     {
         int lang = 0;
-        ar & variables_ & lang & name_ & codename_;
+        std::size_t size = 0;
+        ar & size;
+        variables_.clear();
+        defined_ = 0;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            util::hashed_string name;
+            primitive_argument_type var;
+            ar & name & var;
+            defined_ |= name_bit(name);
+            variables_.emplace_back(std::move(name), std::move(var));
+        }
+        ar & lang & name_ & codename_;
         lang_ = static_cast<language>(lang);
     }
 
@@ -183,6 +183,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_->get_direct_execution(reset);
     }
 
+    std::int64_t primitive_component::get_allocated_bytes(bool reset) const
+    {
+        return primitive_->get_allocated_bytes(reset);
+    }
+
+    std::int64_t primitive_component::get_copied_bytes(bool reset) const
+    {
+        return primitive_->get_copied_bytes(reset);
+    }
+
+    std::int64_t primitive_component::get_peak_bytes(bool reset) const
+    {
+        return primitive_->get_peak_bytes(reset);
+    }
+
     void primitive_component::enable_measurements()
     {
         primitive_->enable_measurements();
@@ -7,15 +7,21 @@
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/execution_trace.hpp>
 #include <phylanx/util/scoped_timer.hpp>
 
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/errors/throw_exception.hpp>
 #include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/modules/naming.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -45,7 +51,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
       , eval_count_(0ll)
       , eval_duration_(0ll)
       , execute_directly_(eval_direct ? 1 : -1)
+      , memory_counters_(new util::memory_counters)
       , measurements_enabled_(false)
+      , tuner_(!eval_direct)
     {
 #if defined(HPX_HAVE_APEX)
         eval_name_ = name_ + "::eval";
@@ -106,8 +114,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         hpx::util::annotate_function annotate(eval_name_.c_str());
 #endif
 
+        std::uint64_t const trace_started_at =
+            util::execution_trace_enabled() ?
+            hpx::chrono::high_resolution_clock::now() : 0;
+
         // perform measurements only when needed
-        bool enable_timer = measurements_enabled_ || (execute_directly_ == -1);
+        bool enable_timer = measurements_enabled_ ||
+            (execute_directly_ == -1) ||
+            (util::adaptive_execution::enabled() && tuner_.sample());
 
         util::scoped_timer<std::int64_t> timer(eval_duration_, enable_timer);
         if (enable_timer)
@@ -115,7 +129,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ++eval_count_;
         }
 
-        auto f = this->eval(params, std::move(ctx));
+        // attribute node_data memory allocated during evaluation to this
+        // primitive, continuations attached by the primitive that requested
+        // the evaluation are attributed to that primitive
+        hpx::future<primitive_argument_type> f;
+        {
+            util::scoped_memory_counters counters(
+                *memory_counters_, measurements_enabled_);
+            f = this->eval(params, std::move(ctx));
+        }
+        f = util::attribute_continuations(std::move(f));
 
         if (enable_timer && !f.is_ready())
         {
@@ -128,6 +151,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             state->set_on_completed(keep_alive(std::move(timer)));
         }
 
+        if (trace_started_at != 0)
+        {
+            return trace_eval(std::move(f), trace_started_at);
+        }
         return f;
     }
 
@@ -138,8 +165,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         hpx::util::annotate_function annotate(eval_name_.c_str());
 #endif
 
+        std::uint64_t const trace_started_at =
+            util::execution_trace_enabled() ?
+            hpx::chrono::high_resolution_clock::now() : 0;
+
         // perform measurements only when needed
-        bool enable_timer = measurements_enabled_ || (execute_directly_ == -1);
+        bool enable_timer = measurements_enabled_ ||
+            (execute_directly_ == -1) ||
+            (util::adaptive_execution::enabled() && tuner_.sample());
 
         util::scoped_timer<std::int64_t> timer(eval_duration_, enable_timer);
         if (enable_timer)
@@ -147,7 +180,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ++eval_count_;
         }
 
-        auto f = this->eval(std::move(param), std::move(ctx));
+        hpx::future<primitive_argument_type> f;
+        {
+            util::scoped_memory_counters counters(
+                *memory_counters_, measurements_enabled_);
+            f = this->eval(std::move(param), std::move(ctx));
+        }
+        f = util::attribute_continuations(std::move(f));
 
         if (enable_timer && !f.is_ready())
         {
@@ -160,9 +199,113 @@ namespace phylanx { namespace execution_tree { namespace primitives
             state->set_on_completed(keep_alive(std::move(timer)));
         }
 
+        if (trace_started_at != 0)
+        {
+            return trace_eval(std::move(f), trace_started_at);
+        }
         return f;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename T>
+        bool trace_shape(primitive_argument_type const& value,
+            util::execution_trace_event& event)
+        {
+            ir::node_data<T> const* data =
+                util::get_if<ir::node_data<T>>(&value);
+            if (data == nullptr)
+            {
+                return false;
+            }
+
+            auto dims = data->dimensions();
+            event.ndim_ = std::int32_t(data->num_dimensions());
+            std::copy(dims.begin(), dims.end(), event.shape_.begin());
+            return true;
+        }
+
+        // Record the event for an evaluation that has finished, the shape of
+        // the result is recorded as well (if it is an array).
+        template <typename SharedState>
+        void record_trace_event(SharedState& state,
+            util::execution_trace_event& event)
+        {
+            event.end_ = hpx::chrono::high_resolution_clock::now();
+
+            hpx::error_code ec(hpx::lightweight);
+            primitive_argument_type const* result = state.get_result(ec);
+            if (result != nullptr && !ec)
+            {
+                trace_shape<double>(*result, event) ||
+                    trace_shape<std::int64_t>(*result, event) ||
+                    trace_shape<std::uint8_t>(*result, event) ||
+                    trace_shape<float>(*result, event);
+            }
+
+            util::record_execution_trace_event(event);
+        }
+
+        // The callback is owned by the shared state, which therefore is
+        // alive whenever the callback is invoked.
+        template <typename SharedState>
+        struct trace_on_completed
+        {
+            void operator()() const
+            {
+                util::execution_trace_event event = event_;
+                record_trace_event(*state_, event);
+            }
+
+            SharedState* state_;
+            util::execution_trace_event event_;
+        };
+    }
+
+    hpx::future<primitive_argument_type> primitive_component_base::trace_eval(
+        hpx::future<primitive_argument_type>&& f,
+        std::uint64_t started_at) const
+    {
+        std::int64_t name = trace_name_.load(std::memory_order_relaxed);
+        if (name == -1)
+        {
+            compiler::primitive_name_parts name_parts;
+            name = util::execution_trace_name(
+                compiler::parse_primitive_name(name_, name_parts) ?
+                    name_parts.primitive :
+                    name_,
+                name_, codename_);
+            trace_name_.store(name, std::memory_order_relaxed);
+        }
+
+        util::execution_trace_event event{started_at, 0,
+            std::uint32_t(name), util::execution_trace_worker(), -1, {}};
+
+        using shared_state_ptr =
+            typename hpx::traits::detail::shared_state_ptr_for<
+                hpx::future<primitive_argument_type>>::type;
+        shared_state_ptr const& state =
+            hpx::traits::future_access<hpx::future<primitive_argument_type>>::
+                get_shared_state(f);
+
+        // most evaluations finish synchronously, their events are recorded
+        // right away instead of attaching a continuation
+        if (f.is_ready())
+        {
+            detail::record_trace_event(*state, event);
+        }
+        else
+        {
+            using shared_state_type =
+                typename shared_state_ptr::element_type;
+            state->set_on_completed(
+                detail::trace_on_completed<shared_state_type>{
+                    state.get(), event});
+        }
+        return std::move(f);
+    }
+
     // eval_action
     hpx::future<primitive_argument_type> primitive_component_base::eval(
         primitive_arguments_type const& params, eval_context ctx) const
@@ -303,6 +446,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return hpx::util::get_and_reset_value(execute_directly_, reset);
     }
 
+    std::int64_t primitive_component_base::get_allocated_bytes(bool reset) const
+    {
+        return hpx::util::get_and_reset_value(
+            memory_counters_->allocated_bytes_, reset);
+    }
+
+    std::int64_t primitive_component_base::get_copied_bytes(bool reset) const
+    {
+        return hpx::util::get_and_reset_value(
+            memory_counters_->copied_bytes_, reset);
+    }
+
+    std::int64_t primitive_component_base::get_peak_bytes(bool reset) const
+    {
+        return hpx::util::get_and_reset_value(
+            memory_counters_->peak_bytes_, reset);
+    }
+
     void primitive_component_base::enable_measurements()
     {
         measurements_enabled_ = true;
@@ -549,7 +710,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return hpx::launch::sync;
         }
 
-        if ((eval_count_ != 0 && measurements_enabled_) ||
+        if (util::adaptive_execution::enabled())
+        {
+            // let the online tuner decide based on the measured evaluation
+            // time relative to the overhead of spawning a new thread
+            execute_directly_ = tuner_.update(eval_count_, eval_duration_,
+                get_ec_threshold(), execute_directly_);
+        }
+        else if ((eval_count_ != 0 && measurements_enabled_) ||
             (eval_count_ > get_ec_threshold()))
         {
             // check whether execution status needs to be changed (with some
@@ -4,9 +4,11 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
 #include <phylanx/execution_tree/primitives/slice.hpp>
 #include <phylanx/execution_tree/primitives/variable.hpp>
 #include <phylanx/ir/ranges.hpp>
+#include <phylanx/util/tile_cache.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/util.hpp>
@@ -14,6 +16,7 @@
 #include <hpx/errors/throw_exception.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -280,6 +283,55 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename T>
+        bool aliases(primitive_argument_type const& value,
+            primitive_argument_type const& target)
+        {
+            auto const* v = util::get_if<ir::node_data<T>>(&value);
+            auto const* t = util::get_if<ir::node_data<T>>(&target);
+            if (v == nullptr || t == nullptr || !v->is_ref())
+            {
+                return false;
+            }
+
+            auto vspan = v->span();
+            auto tspan = t->span();
+            if (vspan.data_ == nullptr || tspan.data_ == nullptr ||
+                vspan.size_ == 0 || tspan.size_ == 0)
+            {
+                return false;
+            }
+
+            T const* vend = vspan.data_ +
+                (vspan.rows() - 1) * vspan.spacing_ + vspan.columns_;
+            T const* tend = tspan.data_ +
+                (tspan.rows() - 1) * tspan.spacing_ + tspan.columns_;
+
+            return vspan.data_ < tend && tspan.data_ < vend;
+        }
+
+        // Slices are stored in place. The value to store may however refer
+        // to the memory of the variable itself (slicing rows of referenced
+        // data returns a view), in which case the elements would be read
+        // after they have been overwritten. Such values are copied first.
+        primitive_argument_type unalias(primitive_argument_type&& value,
+            primitive_argument_type const& target, std::string const& name,
+            std::string const& codename)
+        {
+            if (aliases<double>(value, target) ||
+                aliases<float>(value, target) ||
+                aliases<std::int64_t>(value, target) ||
+                aliases<std::uint8_t>(value, target))
+            {
+                return extract_copy_value(std::move(value), name, codename);
+            }
+            return std::move(value);
+        }
+    }
+
     void variable::store1dslice(primitive_arguments_type&& data,
         primitive_arguments_type&& params, eval_context ctx)
     {
@@ -292,10 +344,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "a value bound to it", ctx));
         }
 
+        auto value = detail::unalias(
+            std::move(data[0]), bound_value_, name_, codename_);
         auto result = slice(std::move(bound_value_),
             value_operand_sync(std::move(data[1]), std::move(params), name_,
                 codename_, ctx),
-            std::move(data[0]), name_, codename_, ctx);
+            std::move(value), name_, codename_, ctx);
         bound_value_ = std::move(result);
     }
 
@@ -311,12 +365,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "a value bound to it", ctx));
         }
 
+        auto value = detail::unalias(
+            std::move(data[0]), bound_value_, name_, codename_);
         auto data1 =
             value_operand_sync(data[1], params, name_, codename_, ctx);
         auto result = slice(std::move(bound_value_), std::move(data1),
             value_operand_sync(
                 data[2], std::move(params), name_, codename_, ctx),
-            std::move(data[0]), name_, codename_, ctx);
+            std::move(value), name_, codename_, ctx);
         bound_value_ = std::move(result);
     }
 
@@ -332,16 +388,54 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "a value bound to it", ctx));
         }
 
+        auto value = detail::unalias(
+            std::move(data[0]), bound_value_, name_, codename_);
         auto data1 = value_operand_sync(data[1], params, name_, codename_, ctx);
         auto data2 = value_operand_sync(data[2], params, name_, codename_, ctx);
         auto result =
             slice(std::move(bound_value_), std::move(data1), std::move(data2),
                 value_operand_sync(
                     data[3], std::move(params), name_, codename_, ctx),
-                std::move(data[0]), name_, codename_, ctx);
+                std::move(value), name_, codename_, ctx);
         bound_value_ = std::move(result);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Tiles of a distributed array that were fetched from other
+        // localities may have been cached, they are outdated as soon as the
+        // array is stored to (all localities store to their part). The
+        // version of the stored value changes as well, which prevents tiles
+        // of the old data from being cached under the current version.
+        void invalidate_cached_tiles(primitive_argument_type const& value,
+            std::string const& name, std::string const& codename)
+        {
+            if (!valid(value) || !value.has_annotation())
+            {
+                return;
+            }
+
+            value.annotation()->update_version();
+
+            annotation localities;
+            if (!util::tile_cache_enabled() ||
+                !value.get_annotation_if(
+                    "localities", localities, name, codename))
+            {
+                return;
+            }
+
+            annotation name_ann;
+            if (localities.find("name", name_ann, name, codename))
+            {
+                util::invalidate_cached_tiles(
+                    extract_annotation_information(name_ann, name, codename)
+                        .name_);
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void variable::store(primitive_arguments_type&& data,
         primitive_arguments_type&& params, eval_context ctx)
@@ -357,6 +451,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the right hand side expression is not valid", ctx));
         }
 
+        detail::invalidate_cached_tiles(bound_value_, name_, codename_);
+        detail::invalidate_cached_tiles(data[0], name_, codename_);
+
         if (!value_set_ || !valid(operands_[0]))
         {
             if (data.size() > 1)
@@ -426,6 +523,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
 //                     "store shouldn't be called with dynamic arguments", ctx));
 //         }
 
+        detail::invalidate_cached_tiles(bound_value_, name_, codename_);
+        detail::invalidate_cached_tiles(data, name_, codename_);
+
         if (!value_set_ || !valid(operands_[0]))
         {
             // extract the initial value for this variable
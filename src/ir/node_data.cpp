@@ -7,6 +7,8 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/buffer_pool.hpp>
+#include <phylanx/util/memory_counters.hpp>
 #include <phylanx/util/serialization/blaze.hpp>
 #include <phylanx/util/serialization/variant.hpp>
 
@@ -98,6 +100,71 @@ namespace phylanx { namespace ir
         return hpx::util::get_and_reset_value(count_move_assignments_, reset);
     }
 
+    // number of bytes of heap memory owned by the stored data
+    template <typename T>
+    std::int64_t node_data<T>::owned_bytes() const
+    {
+        switch (data_.index())
+        {
+        case storage1d:
+            return util::get<storage1d>(data_).capacity() * sizeof(T);
+
+        case storage2d:
+            return util::get<storage2d>(data_).capacity() * sizeof(T);
+
+        case storage3d:
+            return util::get<storage3d>(data_).capacity() * sizeof(T);
+
+        case storage4d:
+            {
+                auto const& q = util::get<storage4d>(data_);
+                return q.quats() * q.pages() * q.rows() * q.spacing() *
+                    sizeof(T);
+            }
+
+        // shared compressed data is accounted for by the instance that
+        // created it
+        case sparse_storage2d:
+            {
+                auto const& p = util::get<sparse_storage2d>(data_);
+                if (p.use_count() != 1)
+                {
+                    return 0;
+                }
+                return p->matrix().capacity() *
+                    (sizeof(T) + sizeof(std::size_t));
+            }
+
+        default:
+            break;
+        }
+        return 0;
+    }
+
+    template <typename T>
+    void node_data<T>::track_allocation(bool copied)
+    {
+        if (enable_counts_.load(std::memory_order_relaxed))
+        {
+            tracked_bytes_ = owned_bytes();
+            if (tracked_bytes_ != 0)
+            {
+                tracked_by_ = util::track_allocation(tracked_bytes_, copied);
+            }
+        }
+    }
+
+    template <typename T>
+    void node_data<T>::track_deallocation()
+    {
+        if (tracked_bytes_ != 0)
+        {
+            util::track_deallocation(tracked_bytes_, tracked_by_);
+            tracked_bytes_ = 0;
+            tracked_by_ = nullptr;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// Create node data for a 0-dimensional value
     template <typename T>
@@ -134,6 +201,7 @@ namespace phylanx { namespace ir
       : data_(values)
     {
         increment_copy_construction_count();
+        track_allocation(true);
     }
 
     template <typename T>
@@ -141,6 +209,7 @@ namespace phylanx { namespace ir
         : data_(std::move(values))
     {
         increment_move_construction_count();
+        track_allocation(false);
     }
 
     template <typename T>
@@ -166,6 +235,7 @@ namespace phylanx { namespace ir
         {
             data_ = storage0d_type();
         }
+        track_allocation(false);
     }
 
     template <typename T>
@@ -192,6 +262,7 @@ namespace phylanx { namespace ir
         {
             data_ = default_value;
         }
+        track_allocation(false);
     }
 
     template <typename T>
@@ -215,6 +286,7 @@ namespace phylanx { namespace ir
       : data_(values)
     {
         increment_copy_construction_count();
+        track_allocation(true);
     }
 
     template <typename T>
@@ -222,6 +294,7 @@ namespace phylanx { namespace ir
       : data_(std::move(values))
     {
         increment_move_construction_count();
+        track_allocation(false);
     }
 
     template <typename T>
@@ -239,12 +312,30 @@ namespace phylanx { namespace ir
         increment_move_construction_count();
     }
 
+    // Create node data for a sparse 2-dimensional value
+    template <typename T>
+    node_data<T>::node_data(sparse_storage2d_type const& values)
+      : data_(std::make_shared<detail::sparse_storage<T>>(values))
+    {
+        increment_copy_construction_count();
+        track_allocation(true);
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage2d_type&& values)
+      : data_(std::make_shared<detail::sparse_storage<T>>(std::move(values)))
+    {
+        increment_move_construction_count();
+        track_allocation(false);
+    }
+
     // Create node data for a 3-dimensional value
     template <typename T>
     node_data<T>::node_data(storage3d_type const& values)
       : data_(values)
     {
         increment_copy_construction_count();
+        track_allocation(true);
     }
 
     template <typename T>
@@ -252,6 +343,7 @@ namespace phylanx { namespace ir
       : data_(std::move(values))
     {
         increment_move_construction_count();
+        track_allocation(false);
     }
 
     template <typename T>
@@ -275,6 +367,7 @@ namespace phylanx { namespace ir
       : data_(values)
     {
         increment_copy_construction_count();
+        track_allocation(true);
     }
 
     template <typename T>
@@ -282,6 +375,7 @@ namespace phylanx { namespace ir
       : data_(std::move(values))
     {
         increment_move_construction_count();
+        track_allocation(false);
     }
 
     template <typename T>
@@ -310,6 +404,7 @@ namespace phylanx { namespace ir
         {
             util::get<storage1d>(data_)[i] = values[i];
         }
+        track_allocation(true);
     }
 
     template <typename T>
@@ -327,6 +422,7 @@ namespace phylanx { namespace ir
                 util::get<storage2d>(data_)(i, j) = row[j];
             }
         }
+        track_allocation(true);
     }
 
     template <typename T>
@@ -351,6 +447,7 @@ namespace phylanx { namespace ir
                 }
             }
         }
+        track_allocation(true);
     }
 
     template <typename T>
@@ -383,6 +480,7 @@ namespace phylanx { namespace ir
                 }
             }
         }
+        track_allocation(true);
     }
 
     template <typename T>
@@ -393,7 +491,8 @@ namespace phylanx { namespace ir
         {
         case storage0d: HPX_FALLTHROUGH;
         case storage1d: HPX_FALLTHROUGH;
-        case storage2d:
+        case storage2d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
             {
                 increment_copy_construction_count();
                 return d.data_;
@@ -469,19 +568,57 @@ namespace phylanx { namespace ir
     node_data<T>::node_data(node_data const& d)
       : data_(init_data_from(d))
     {
+        track_allocation(true);
     }
 
     template <typename T>
     node_data<T>::node_data(node_data&& d)
       : data_(std::move(d.data_))
+      , tracked_bytes_(d.tracked_bytes_)
+      , tracked_by_(d.tracked_by_)
     {
+        d.tracked_bytes_ = 0;
+        d.tracked_by_ = nullptr;
         increment_move_construction_count();
     }
 
+    template <typename T>
+    node_data<T>::~node_data()
+    {
+        track_deallocation();
+        recycle();
+    }
+
+    template <typename T>
+    void node_data<T>::recycle()
+    {
+        switch (data_.index())
+        {
+        case storage1d:
+            util::buffer_pool<storage1d_type>::recycle(
+                util::get<storage1d>(data_));
+            break;
+
+        case storage2d:
+            util::buffer_pool<storage2d_type>::recycle(
+                util::get<storage2d>(data_));
+            break;
+
+        case storage3d:
+            util::buffer_pool<storage3d_type>::recycle(
+                util::get<storage3d>(data_));
+            break;
+
+        default:
+            break;
+        }
+    }
+
     template <typename T>
     node_data<T>& node_data<T>::operator=(storage0d_type val)
     {
         increment_copy_assignment_count();
+        track_deallocation();
         data_ = val;
         return *this;
     }
@@ -490,6 +627,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage0d_type const& val)
     {
         increment_copy_assignment_count();
+        track_deallocation();
         data_ = val;
         return *this;
     }
@@ -498,6 +636,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage0d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
         return *this;
     }
@@ -506,7 +645,9 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(storage1d_type const& val)
     {
         increment_copy_assignment_count();
+        track_deallocation();
         data_ = val;
+        track_allocation(true);
         return *this;
     }
 
@@ -514,7 +655,9 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(storage1d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
+        track_allocation(false);
         return *this;
     }
 
@@ -522,6 +665,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage1d_type const& val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = custom_storage1d_type{
             const_cast<T*>(val.data()), val.size(), val.spacing()};
         return *this;
@@ -531,6 +675,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage1d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
         return *this;
     }
@@ -539,7 +684,9 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(storage2d_type const& val)
     {
         increment_copy_assignment_count();
+        track_deallocation();
         data_ = val;
+        track_allocation(true);
         return *this;
     }
 
@@ -547,7 +694,9 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(storage2d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
+        track_allocation(false);
         return *this;
     }
 
@@ -555,6 +704,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage2d_type const& val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = custom_storage2d_type{const_cast<T*>(val.data()), val.rows(),
             val.columns(), val.spacing()};
         return *this;
@@ -564,15 +714,38 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage2d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
         return *this;
     }
 
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage2d_type const& val)
+    {
+        increment_copy_assignment_count();
+        track_deallocation();
+        data_ = std::make_shared<detail::sparse_storage<T>>(val);
+        track_allocation(true);
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage2d_type && val)
+    {
+        increment_move_assignment_count();
+        track_deallocation();
+        data_ = std::make_shared<detail::sparse_storage<T>>(std::move(val));
+        track_allocation(false);
+        return *this;
+    }
+
     template <typename T>
     node_data<T>& node_data<T>::operator=(storage3d_type const& val)
     {
         increment_copy_assignment_count();
+        track_deallocation();
         data_ = val;
+        track_allocation(true);
         return *this;
     }
 
@@ -580,7 +753,9 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(storage3d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
+        track_allocation(false);
         return *this;
     }
 
@@ -588,6 +763,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage3d_type const& val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = custom_storage3d_type{const_cast<T*>(val.data()), val.pages(),
             val.rows(), val.columns(), val.spacing()};
         return *this;
@@ -597,6 +773,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage3d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
         return *this;
     }
@@ -606,7 +783,9 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(storage4d_type const& val)
     {
         increment_copy_assignment_count();
+        track_deallocation();
         data_ = val;
+        track_allocation(true);
         return *this;
     }
 
@@ -614,7 +793,9 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(storage4d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
+        track_allocation(false);
         return *this;
     }
 
@@ -622,6 +803,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage4d_type const& val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = custom_storage4d_type{const_cast<T*>(val.data()), val.quats(),
             val.pages(), val.rows(), val.columns(), val.spacing()};
         return *this;
@@ -631,6 +813,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(custom_storage4d_type && val)
     {
         increment_move_assignment_count();
+        track_deallocation();
         data_ = std::move(val);
         return *this;
     }
@@ -639,12 +822,14 @@ namespace phylanx { namespace ir
     template <typename T>
     node_data<T>& node_data<T>::operator=(std::vector<T> const& values)
     {
+        track_deallocation();
         data_ = storage1d_type(values.size());
         std::size_t const nx = values.size();
         for (std::size_t i = 0; i != nx; ++i)
         {
             util::get<storage1d>(data_)[i] = values[i];
         }
+        track_allocation(true);
         return *this;
     }
 
@@ -652,6 +837,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(
         std::vector<std::vector<T>> const& values)
     {
+        track_deallocation();
         data_ = storage2d_type{values.size(), values[0].size()};
         std::size_t const nx = values.size();
         for (std::size_t i = 0; i != nx; ++i)
@@ -663,6 +849,7 @@ namespace phylanx { namespace ir
                 util::get<storage2d>(data_)(i, j) = row[j];
             }
         }
+        track_allocation(true);
         return *this;
     }
 
@@ -670,6 +857,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(
         std::vector<std::vector<std::vector<T>>> const& values)
     {
+        track_deallocation();
         data_ = storage3d_type{
             values.size(), values[0].size(), values[0][0].size()};
 
@@ -688,6 +876,7 @@ namespace phylanx { namespace ir
                 }
             }
         }
+        track_allocation(true);
         return *this;
     }
 
@@ -695,6 +884,7 @@ namespace phylanx { namespace ir
     node_data<T>& node_data<T>::operator=(
         std::vector<std::vector<std::vector<std::vector<T>>>> const& values)
     {
+        track_deallocation();
         data_ = storage4d_type{values.size(), values[0].size(),
             values[0][0].size(), values[0][0][0].size()};
 
@@ -718,6 +908,7 @@ namespace phylanx { namespace ir
                 }
             }
         }
+        track_allocation(true);
         return *this;
     }
 
@@ -729,7 +920,8 @@ namespace phylanx { namespace ir
         {
         case storage0d: HPX_FALLTHROUGH;
         case storage1d: HPX_FALLTHROUGH;
-        case storage2d:
+        case storage2d: HPX_FALLTHROUGH;
+        case sparse_storage2d:
             {
                 increment_copy_assignment_count();
                 return d.data_;
@@ -806,7 +998,11 @@ namespace phylanx { namespace ir
     {
         if (this != &d)
         {
-            data_ = copy_data_from(d);
+            storage_type data = copy_data_from(d);
+            track_deallocation();
+            recycle();
+            data_ = std::move(data);
+            track_allocation(true);
         }
         return *this;
     }
@@ -817,7 +1013,13 @@ namespace phylanx { namespace ir
         if (this != &d)
         {
             increment_move_assignment_count();
+            track_deallocation();
+            recycle();
             data_ = std::move(d.data_);
+            tracked_bytes_ = d.tracked_bytes_;
+            tracked_by_ = d.tracked_by_;
+            d.tracked_bytes_ = 0;
+            d.tracked_by_ = nullptr;
         }
         return *this;
     }
@@ -857,6 +1059,14 @@ namespace phylanx { namespace ir
             }
             break;
 
+        // modifying element access requires dense storage
+        case sparse_storage2d:
+            {
+                make_dense();
+                auto m = matrix();
+                return m(index / m.columns(), index % m.columns());
+            }
+
         default:
             break;
         }
@@ -892,6 +1102,11 @@ namespace phylanx { namespace ir
             return quatern()(
                 indicies[0], indicies[1], indicies[2], indicies[3]);
 
+        // modifying element access requires dense storage
+        case sparse_storage2d:
+            make_dense();
+            return matrix()(indicies[0], indicies[1]);
+
         default:
             break;
         }
@@ -927,6 +1142,11 @@ namespace phylanx { namespace ir
         case custom_storage4d:
             return quatern()(index1, index2, index3, index4);
 
+        // modifying element access requires dense storage
+        case sparse_storage2d:
+            make_dense();
+            return matrix()(index1, index2);
+
         default:
             break;
         }
@@ -958,17 +1178,21 @@ namespace phylanx { namespace ir
                 return m(idx_m, idx_n);
             }
 
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                return m(index / m.columns(), index % m.columns());
+            }
+
         case storage3d:         HPX_FALLTHROUGH;
         case custom_storage3d:  HPX_FALLTHROUGH;
         case storage4d:         HPX_FALLTHROUGH;
         case custom_storage4d:
             {
-                HPX_THROW_EXCEPTION(hpx::invalid_status,
-                    "phylanx::ir::node_data<T>::operator[]()",
-                    "node_data object holds data type that does not support "
-                    "1d indexing");
+                detail::node_data_span<T> s = span();
+                return s.data_[
+                    (index / s.columns_) * s.spacing_ + index % s.columns_];
             }
-            break;
 
         default:
             break;
@@ -996,6 +1220,9 @@ namespace phylanx { namespace ir
         case custom_storage2d:
             return matrix()(indices[0], indices[1]);
 
+        case sparse_storage2d:
+            return sparse_matrix()(indices[0], indices[1]);
+
         case storage3d:         HPX_FALLTHROUGH;
         case custom_storage3d:
             return tensor()(indices[0], indices[1], indices[2]);
@@ -1031,6 +1258,9 @@ namespace phylanx { namespace ir
         case custom_storage2d:
             return matrix()(index1, index2);
 
+        case sparse_storage2d:
+            return sparse_matrix()(index1, index2);
+
         case storage3d:         HPX_FALLTHROUGH;
         case custom_storage3d:
             return tensor()(index1, index2, index3);
@@ -1068,6 +1298,12 @@ namespace phylanx { namespace ir
                 return m.rows() * m.columns();
             }
 
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                return m.rows() * m.columns();
+            }
+
         case storage3d:         HPX_FALLTHROUGH;
         case custom_storage3d:
             {
@@ -1091,6 +1327,62 @@ namespace phylanx { namespace ir
             "node_data object holds unsupported data type");
     }
 
+    template <typename T>
+    detail::node_data_span<T> node_data<T>::span() const
+    {
+        switch (data_.index())
+        {
+        case storage0d: HPX_FALLTHROUGH;
+        case custom_storage0d:
+            return detail::node_data_span<T>{&scalar(), 1, 1, 1};
+
+        case storage1d: HPX_FALLTHROUGH;
+        case custom_storage1d:
+            {
+                auto v = vector();
+                return detail::node_data_span<T>{
+                    v.data(), v.size(), v.size(), v.size()};
+            }
+
+        case storage2d: HPX_FALLTHROUGH;
+        case custom_storage2d:
+            {
+                auto m = matrix();
+                return detail::node_data_span<T>{m.data(),
+                    m.rows() * m.columns(), m.columns(), m.spacing()};
+            }
+
+        case storage3d: HPX_FALLTHROUGH;
+        case custom_storage3d:
+            {
+                auto t = tensor();
+                return detail::node_data_span<T>{t.data(),
+                    t.pages() * t.rows() * t.columns(), t.columns(),
+                    t.spacing()};
+            }
+
+        case storage4d: HPX_FALLTHROUGH;
+        case custom_storage4d:
+            {
+                auto q = quatern();
+                return detail::node_data_span<T>{q.data(),
+                    q.quats() * q.pages() * q.rows() * q.columns(),
+                    q.columns(), q.spacing()};
+            }
+
+        case sparse_storage2d:
+            return detail::node_data_span<T>{
+                nullptr, size(), dimension(1), dimension(1)};
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<T>::span()",
+            "node_data object holds unsupported data type");
+    }
+
     template <typename T>
     typename node_data<T>::const_iterator node_data<T>::begin() const
     {
@@ -1498,6 +1790,11 @@ namespace phylanx { namespace ir
     template <typename T>
     typename node_data<T>::storage2d_type& node_data<T>::matrix_non_ref()
     {
+        if (is_sparse())
+        {
+            make_dense();
+        }
+
         storage2d_type* m = util::get_if<storage2d_type>(&data_);
         if (m == nullptr)
         {
@@ -1512,6 +1809,11 @@ namespace phylanx { namespace ir
     typename node_data<T>::storage2d_type const& node_data<T>::matrix_non_ref()
         const
     {
+        if (is_sparse())
+        {
+            return util::get<sparse_storage2d>(data_)->dense();
+        }
+
         storage2d_type const* m = util::get_if<storage2d_type>(&data_);
         if (m == nullptr)
         {
@@ -1539,6 +1841,11 @@ namespace phylanx { namespace ir
             return *m;
         }
 
+        if (is_sparse())
+        {
+            return storage2d_type{sparse_matrix()};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix_copy() &",
             "node_data object holds unsupported data type");
@@ -1560,6 +1867,11 @@ namespace phylanx { namespace ir
             return *m;
         }
 
+        if (is_sparse())
+        {
+            return storage2d_type{sparse_matrix()};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix_copy() const&",
             "node_data object holds unsupported data type");
@@ -1581,6 +1893,11 @@ namespace phylanx { namespace ir
             return std::move(*m);
         }
 
+        if (is_sparse())
+        {
+            return storage2d_type{sparse_matrix()};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix_copy() &&",
             "node_data object holds unsupported data type");
@@ -1602,6 +1919,11 @@ namespace phylanx { namespace ir
             return *m;
         }
 
+        if (is_sparse())
+        {
+            return storage2d_type{sparse_matrix()};
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix_copy() const&&",
             "node_data object holds unsupported data type");
@@ -1611,6 +1933,11 @@ namespace phylanx { namespace ir
     template <typename T>
     typename node_data<T>::custom_storage2d_type node_data<T>::matrix() &
     {
+        if (is_sparse())
+        {
+            make_dense();
+        }
+
         custom_storage2d_type* cm =
             util::get_if<custom_storage2d_type>(&data_);
         if (cm != nullptr)
@@ -1648,11 +1975,69 @@ namespace phylanx { namespace ir
                 m->rows(), m->columns(), m->spacing());
         }
 
+        // refer to the dense copy shared by all users of the sparse data
+        if (is_sparse())
+        {
+            auto const& d = util::get<sparse_storage2d>(data_)->dense();
+            return custom_storage2d_type(const_cast<T*>(d.data()),
+                d.rows(), d.columns(), d.spacing());
+        }
+
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::ir::node_data<T>::matrix() const&",
             "node_data object holds unsupported data type");
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type const&
+    node_data<T>::sparse_matrix() const
+    {
+        shared_sparse_storage2d_type const* sm =
+            util::get_if<shared_sparse_storage2d_type>(&data_);
+        if (sm == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_matrix()",
+                "node_data object does not hold sparse data");
+        }
+        return (*sm)->matrix();
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type&
+    node_data<T>::sparse_matrix_non_ref()
+    {
+        shared_sparse_storage2d_type* sm =
+            util::get_if<shared_sparse_storage2d_type>(&data_);
+        if (sm == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_matrix_non_ref()",
+                "node_data object does not hold sparse data");
+        }
+
+        // copy the compressed data if it is shared with other instances
+        if (sm->use_count() != 1)
+        {
+            auto p = std::make_shared<detail::sparse_storage<T>>(
+                (*sm)->matrix());
+            track_deallocation();
+            *sm = std::move(p);
+            track_allocation(true);
+        }
+        return (*sm)->matrix();
+    }
+
+    template <typename T>
+    void node_data<T>::make_dense()
+    {
+        storage2d_type m{sparse_matrix()};
+        track_deallocation();
+        data_ = std::move(m);
+        track_allocation(true);
+    }
+
     template <typename T>
     typename node_data<T>::custom_storage2d_type node_data<T>::matrix() &&
     {
@@ -2066,7 +2451,8 @@ namespace phylanx { namespace ir
             return 1;
 
         case storage2d:         HPX_FALLTHROUGH;
-        case custom_storage2d:
+        case custom_storage2d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
             return 2;
 
         case storage3d:         HPX_FALLTHROUGH;
@@ -2106,6 +2492,12 @@ namespace phylanx { namespace ir
                 return dimensions_type{m.rows(), m.columns()};
             }
 
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                return dimensions_type{m.rows(), m.columns()};
+            }
+
         case storage3d:         HPX_FALLTHROUGH;
         case custom_storage3d:
             {
@@ -2174,6 +2566,25 @@ namespace phylanx { namespace ir
                 }
             }
 
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                switch (dim)
+                {
+                case 0:
+                    return m.rows();
+
+                case 1:
+                    return m.columns();
+
+                default:
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::ir::node_data<T>::dimension()",
+                        "unknown dimension requested");
+                    break;
+                }
+            }
+
         case storage3d:         HPX_FALLTHROUGH;
         case custom_storage3d:
             {
@@ -2252,6 +2663,10 @@ namespace phylanx { namespace ir
         case storage4d:
             return node_data<T>{quatern()};
 
+        // compressed data is shared with the reference
+        case sparse_storage2d:
+            return *this;
+
         case custom_storage0d: HPX_FALLTHROUGH;
         case custom_storage1d: HPX_FALLTHROUGH;
         case custom_storage2d: HPX_FALLTHROUGH;
@@ -2288,6 +2703,10 @@ namespace phylanx { namespace ir
         case storage4d:
             return node_data<T>{quatern()};
 
+        // compressed data is shared with the reference
+        case sparse_storage2d:
+            return *this;
+
         case custom_storage0d: HPX_FALLTHROUGH;
         case custom_storage1d: HPX_FALLTHROUGH;
         case custom_storage2d: HPX_FALLTHROUGH;
@@ -2333,6 +2752,10 @@ namespace phylanx { namespace ir
         case storage4d:
             return *this;
 
+        // create a private copy of the (shared) compressed data
+        case sparse_storage2d:
+            return node_data<T>{sparse_matrix()};
+
         case custom_storage0d:
             return node_data<T>{scalar_copy()};
 
@@ -2379,6 +2802,11 @@ namespace phylanx { namespace ir
         case storage4d:
             return false;
 
+        // compressed data shared with other instances is treated as a
+        // reference
+        case sparse_storage2d:
+            return util::get<sparse_storage2d>(data_).use_count() != 1;
+
         case custom_storage3d: HPX_FALLTHROUGH;
         case custom_storage4d:
             return true;
@@ -2440,6 +2868,21 @@ namespace phylanx { namespace ir
                 return result;
             }
 
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                std::vector<std::vector<T>> result(
+                    m.rows(), std::vector<T>(m.columns(), T(0)));
+                for (std::size_t i = 0; i != m.rows(); ++i)
+                {
+                    for (auto it = m.begin(i); it != m.end(i); ++it)
+                    {
+                        result[i][it->index()] = it->value();
+                    }
+                }
+                return result;
+            }
+
         case storage0d:         HPX_FALLTHROUGH;
         case storage1d:         HPX_FALLTHROUGH;
         case custom_storage0d:  HPX_FALLTHROUGH;
@@ -2542,6 +2985,25 @@ namespace phylanx { namespace ir
             "node_data object holds unsupported data type");
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // compare two (same-sized) matrices at least one of which is sparse
+        template <typename T>
+        bool sparse_equal(node_data<T> const& lhs, node_data<T> const& rhs)
+        {
+            if (lhs.is_sparse())
+            {
+                if (rhs.is_sparse())
+                {
+                    return lhs.sparse_matrix() == rhs.sparse_matrix();
+                }
+                return lhs.sparse_matrix() == rhs.matrix();
+            }
+            return lhs.matrix() == rhs.sparse_matrix();
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool operator==(node_data<double> const& lhs, node_data<double> const& rhs)
     {
@@ -2551,6 +3013,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return detail::sparse_equal(lhs, rhs);
+        }
+
         switch (lhs.index())
         {
         case node_data<double>::storage0d:          HPX_FALLTHROUGH;
@@ -2581,6 +3048,49 @@ namespace phylanx { namespace ir
             "node_data object holds unsupported data type");
     }
 
+    bool operator==(node_data<float> const& lhs, node_data<float> const& rhs)
+    {
+        if (lhs.num_dimensions() != rhs.num_dimensions() ||
+            lhs.dimensions() != rhs.dimensions())
+        {
+            return false;
+        }
+
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return detail::sparse_equal(lhs, rhs);
+        }
+
+        switch (lhs.index())
+        {
+        case node_data<float>::storage0d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage0d:
+            return lhs.scalar() == rhs.scalar();
+
+        case node_data<float>::storage1d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage1d:
+            return lhs.vector() == rhs.vector();
+
+        case node_data<float>::storage2d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage2d:
+            return lhs.matrix() == rhs.matrix();
+
+        case node_data<float>::storage3d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage3d:
+            return lhs.tensor() == rhs.tensor();
+
+        case node_data<float>::storage4d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage4d:
+            return lhs.quatern() == rhs.quatern();
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<T>::operator==()",
+            "node_data object holds unsupported data type");
+    }
+
     bool operator==(
         node_data<std::uint8_t> const& lhs, node_data<std::uint8_t> const& rhs)
     {
@@ -2590,6 +3100,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return detail::sparse_equal(lhs, rhs);
+        }
+
         switch (lhs.index())
         {
         case node_data<std::uint8_t>::storage0d:          HPX_FALLTHROUGH;
@@ -2629,6 +3144,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return detail::sparse_equal(lhs, rhs);
+        }
+
         switch (lhs.index())
         {
         case node_data<std::int64_t>::storage0d:          HPX_FALLTHROUGH;
@@ -2687,6 +3207,13 @@ namespace phylanx { namespace ir
 
         auto isclose = detail::isclose{atol, rtol, equal_nan};
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return blaze::reduce(
+                blaze::map(lhs.matrix_copy(), rhs.matrix_copy(), isclose),
+                std::logical_and<bool>{});
+        }
+
         switch (lhs.index())
         {
         case node_data<double>::storage0d:          HPX_FALLTHROUGH;
@@ -2725,6 +3252,62 @@ namespace phylanx { namespace ir
             "node_data object holds unsupported data type");
     }
 
+    bool allclose(node_data<float> const& lhs, node_data<float> const& rhs,
+        double rtol, double atol, bool equal_nan)
+    {
+        if (lhs.num_dimensions() != rhs.num_dimensions() ||
+            lhs.dimensions() != rhs.dimensions())
+        {
+            return false;
+        }
+
+        auto isclose = detail::isclose{atol, rtol, equal_nan};
+
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return blaze::reduce(
+                blaze::map(lhs.matrix_copy(), rhs.matrix_copy(), isclose),
+                std::logical_and<bool>{});
+        }
+
+        switch (lhs.index())
+        {
+        case node_data<float>::storage0d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage0d:
+            return isclose(lhs.scalar(), rhs.scalar());
+
+        case node_data<float>::storage1d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage1d:
+            return blaze::reduce(
+                blaze::map(lhs.vector(), rhs.vector(), isclose),
+                std::logical_and<bool>{});
+
+        case node_data<float>::storage2d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage2d:
+            return blaze::reduce(
+                blaze::map(lhs.matrix(), rhs.matrix(), isclose),
+                std::logical_and<bool>{});
+
+        case node_data<float>::storage3d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage3d:
+            return blaze::reduce(
+                blaze::map(lhs.tensor(), rhs.tensor(), isclose),
+                std::logical_and<bool>{});
+
+        case node_data<float>::storage4d:          HPX_FALLTHROUGH;
+        case node_data<float>::custom_storage4d:
+            return blaze::reduce(
+                blaze::map(lhs.quatern(), rhs.quatern(), isclose),
+                std::logical_and<bool>{});
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<float>::allclose)",
+            "node_data object holds unsupported data type");
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -2814,6 +3397,13 @@ namespace phylanx { namespace ir
                 }
                 break;
 
+            case node_data<double>::sparse_storage2d:
+                {
+                    auto const& m = nd.sparse_matrix();
+                    detail::print_matrix<double>(out, m, m.rows(), m.columns());
+                }
+                break;
+
             case node_data<double>::storage3d:          HPX_FALLTHROUGH;
             case node_data<double>::custom_storage3d:
                 {
@@ -2842,6 +3432,65 @@ namespace phylanx { namespace ir
         return out;
     }
 
+    std::ostream& operator<<(std::ostream& out, node_data<float> const& nd)
+    {
+        auto f = [&]()
+        {
+            switch (nd.index())
+            {
+            case node_data<float>::storage0d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage0d:
+                out << nd.scalar();
+                break;
+
+            case node_data<float>::storage1d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage1d:
+                detail::print_vector<float>(out, nd.vector(), nd.size());
+                break;
+
+            case node_data<float>::storage2d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage2d:
+                {
+                    auto m = nd.matrix();
+                    detail::print_matrix<float>(out, m, m.rows(), m.columns());
+                }
+                break;
+
+            case node_data<float>::sparse_storage2d:
+                {
+                    auto const& m = nd.sparse_matrix();
+                    detail::print_matrix<float>(out, m, m.rows(), m.columns());
+                }
+                break;
+
+            case node_data<float>::storage3d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage3d:
+                {
+                    auto t = nd.tensor();
+                    detail::print_tensor<float>(
+                        out, t, t.pages(), t.rows(), t.columns());
+                }
+                break;
+
+            case node_data<float>::storage4d:          HPX_FALLTHROUGH;
+            case node_data<float>::custom_storage4d:
+                {
+                    auto q = nd.quatern();
+                    detail::print_quatern<float>(
+                        out, q, q.quats(), q.pages(), q.rows(), q.columns());
+                }
+                break;
+            default:
+                throw std::runtime_error("invalid dimensionality: " +
+                    std::to_string(nd.num_dimensions()));
+            }
+        };
+
+        f();
+
+        return out;
+    }
+
     std::ostream& operator<<(
         std::ostream& out, node_data<std::int64_t> const& nd)
     {
@@ -2869,6 +3518,14 @@ namespace phylanx { namespace ir
                 }
                 break;
 
+            case node_data<std::int64_t>::sparse_storage2d:
+                {
+                    auto const& m = nd.sparse_matrix();
+                    detail::print_matrix<std::int64_t>(
+                        out, m, m.rows(), m.columns());
+                }
+                break;
+
             case node_data<std::int64_t>::storage3d:          HPX_FALLTHROUGH;
             case node_data<std::int64_t>::custom_storage3d:
                 {
@@ -2925,6 +3582,14 @@ namespace phylanx { namespace ir
                 }
                 break;
 
+            case node_data<std::uint8_t>::sparse_storage2d:
+                {
+                    auto const& m = nd.sparse_matrix();
+                    out << std::boolalpha;
+                    detail::print_matrix<bool>(out, m, m.rows(), m.columns());
+                }
+                break;
+
             case node_data<std::uint8_t>::storage3d:          HPX_FALLTHROUGH;
             case node_data<std::uint8_t>::custom_storage3d:
                 {
@@ -2971,6 +3636,9 @@ namespace phylanx { namespace ir
         case custom_storage2d:
             return matrix().nonZeros() != 0;
 
+        case sparse_storage2d:
+            return sparse_matrix().nonZeros() != 0;
+
         case storage3d:          HPX_FALLTHROUGH;
         case custom_storage3d:
             return tensor().nonZeros() != 0;
@@ -3035,6 +3703,11 @@ namespace phylanx { namespace ir
         case custom_storage4d:
             ar << util::get<custom_storage4d>(data_);
             break;
+
+        case sparse_storage2d:
+            ar << sparse_matrix();
+            break;
+
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<T>::serialize",
@@ -3049,6 +3722,8 @@ namespace phylanx { namespace ir
         std::size_t index = 0;
         ar >> index;
 
+        track_deallocation();
+
         switch (index)
         {
         case storage0d:         HPX_FALLTHROUGH;
@@ -3095,14 +3770,27 @@ namespace phylanx { namespace ir
                 data_ = std::move(q);
             }
             break;
+
+        case sparse_storage2d:
+            {
+                sparse_storage2d_type m;
+                ar >> m;
+                data_ = std::make_shared<detail::sparse_storage<T>>(
+                    std::move(m));
+            }
+            break;
+
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<T>::serialize",
                 "node_data object holds unsupported data type");
         }
+
+        track_allocation(false);
     }
 }}
 
 template class PHYLANX_EXPORT phylanx::ir::node_data<double>;
+template class PHYLANX_EXPORT phylanx::ir::node_data<float>;
 template class PHYLANX_EXPORT phylanx::ir::node_data<std::uint8_t>;
 template class PHYLANX_EXPORT phylanx::ir::node_data<std::int64_t>;
@@ -9,6 +9,9 @@
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/memory_counters.hpp>
+#include <phylanx/util/tile_cache.hpp>
+#include <phylanx/util/transfer_codec.hpp>
 
 #include <hpx/include/agas.hpp>
 #include <hpx/include/components.hpp>
@@ -65,22 +68,53 @@ namespace phylanx { namespace performance_counters
             primitive_counter>
     {
     public:
+        enum counter_kind
+        {
+            eval_count,
+            eval_duration,
+            allocated_bytes,
+            copied_bytes,
+            peak_bytes
+        };
+
         primitive_counter()
           : first_init_(false)
-          , duration_counter_(false)
+          , kind_(eval_count)
         {}
 
         primitive_counter(hpx::performance_counters::counter_info const& info)
           : hpx::performance_counters::base_performance_counter<
                 primitive_counter>(info)
           , first_init_(false)
-          , duration_counter_(false)
+          , kind_(eval_count)
         {
             hpx::performance_counters::counter_path_elements paths;
             hpx::performance_counters::get_counter_path_elements(
                 info.fullname_, paths);
-            duration_counter_ =
-                paths.countername_.find("time") != std::string::npos;
+
+            std::string const& name = paths.countername_;
+            if (name.find("time") != std::string::npos)
+            {
+                kind_ = eval_duration;
+            }
+            else if (name.find("memory/allocated") != std::string::npos)
+            {
+                kind_ = allocated_bytes;
+            }
+            else if (name.find("memory/copied") != std::string::npos)
+            {
+                kind_ = copied_bytes;
+            }
+            else if (name.find("memory/peak") != std::string::npos)
+            {
+                kind_ = peak_bytes;
+            }
+
+            // node_data accounts for its memory only if counting is enabled
+            if (kind_ != eval_count && kind_ != eval_duration)
+            {
+                ir::node_data<double>::enable_counts(true);
+            }
         }
 
         // Produce the counter value
@@ -106,14 +140,7 @@ namespace phylanx { namespace performance_counters
             // Extract the values from instances_
             for (auto const& instance : instances_)
             {
-                if (duration_counter_)
-                {
-                    result.push_back(instance->get_eval_duration(reset));
-                }
-                else
-                {
-                    result.push_back(instance->get_eval_count(reset));
-                }
+                result.push_back(get_value(*instance, reset));
             }
 
             value.values_ = std::move(result);
@@ -149,14 +176,7 @@ namespace phylanx { namespace performance_counters
                 // Consider the reset flag
                 if (reset)
                 {
-                    if (duration_counter_)
-                    {
-                        instance->get_eval_duration(true);
-                    }
-                    else
-                    {
-                        instance->get_eval_count(true);
-                    }
+                    get_value(*instance, true);
                 }
                 instances_sorted[instance_info.sequence_number] = instance;
             }
@@ -173,12 +193,38 @@ namespace phylanx { namespace performance_counters
         }
 
     private:
+        std::int64_t get_value(
+            phylanx::execution_tree::primitives::primitive_component const&
+                instance,
+            bool reset) const
+        {
+            switch (kind_)
+            {
+            case eval_duration:
+                return instance.get_eval_duration(reset);
+
+            case allocated_bytes:
+                return instance.get_allocated_bytes(reset);
+
+            case copied_bytes:
+                return instance.get_copied_bytes(reset);
+
+            case peak_bytes:
+                return instance.get_peak_bytes(reset);
+
+            case eval_count: HPX_FALLTHROUGH;
+            default:
+                break;
+            }
+            return instance.get_eval_count(reset);
+        }
+
         using base_primitive_ptr = std::shared_ptr<
             phylanx::execution_tree::primitives::primitive_component>;
 
         std::vector<base_primitive_ptr> instances_;
         std::atomic<bool> first_init_;
-        bool duration_counter_;
+        counter_kind kind_;
     };
 
     hpx::naming::gid_type primitive_counter_creator(
@@ -426,6 +472,59 @@ namespace phylanx { namespace performance_counters
             "returns the current value of the move-assignment count of "
                 "any node_data<double>");
 
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/node_data/memory/allocated",
+            &util::allocated_bytes,
+            "returns the number of bytes of memory owned by newly created "
+                "node_data instances (requires node_data counting to be "
+                "enabled)",
+            "bytes");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/node_data/memory/copied",
+            &util::copied_bytes,
+            "returns the number of bytes of memory copied while creating "
+                "node_data instances (requires node_data counting to be "
+                "enabled)",
+            "bytes");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/node_data/memory/live",
+            &util::live_bytes,
+            "returns the number of bytes of memory owned by all currently "
+                "existing node_data instances (requires node_data counting "
+                "to be enabled)",
+            "bytes");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/transfer/bytes/raw",
+            &util::transfer_raw_bytes,
+            "returns the number of bytes of the data fetched from remote parts "
+                "of distributed objects before it was encoded (only data "
+                "sent using a transfer codec is accounted for)",
+            "bytes");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/transfer/bytes/encoded",
+            &util::transfer_encoded_bytes,
+            "returns the number of bytes of the data fetched from remote parts "
+                "of distributed objects after it was encoded (only data sent "
+                "using a transfer codec is accounted for)",
+            "bytes");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/tile_cache/hits",
+            &util::tile_cache_hits,
+            "returns the number of fetches of remote tiles of distributed "
+                "objects that were served from the tile cache");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/tile_cache/misses",
+            &util::tile_cache_misses,
+            "returns the number of fetches of remote tiles of distributed "
+                "objects that were not served from the tile cache (only "
+                "objects using the cache are accounted for)");
+
         // Iterate and register a time and count performance counter per each
         // primitive
         namespace et = phylanx::execution_tree;
@@ -464,6 +563,40 @@ namespace phylanx { namespace performance_counters
                     "was executed directly",
                 &direct_execution_counter_creator,
                 &hpx::performance_counters::locality_counter_discoverer);
+
+            // Register the memory performance counters, the node_data
+            // memory is attributed to the primitive whose eval function
+            // was executing while it was created
+            hpx::performance_counters::install_counter_type(
+                "/phylanx/primitives/" + name + "/memory/allocated",
+                hpx::performance_counters::counter_raw_values,
+                "returns a list whose elements contain the number of bytes "
+                    "of node_data memory allocated by the eval function of "
+                    "each " + name + " primitive",
+                &primitive_counter_creator,
+                &hpx::performance_counters::locality_counter_discoverer,
+                HPX_PERFORMANCE_COUNTER_V1, "bytes");
+
+            hpx::performance_counters::install_counter_type(
+                "/phylanx/primitives/" + name + "/memory/copied",
+                hpx::performance_counters::counter_raw_values,
+                "returns a list whose elements contain the number of bytes "
+                    "of node_data memory copied by the eval function of "
+                    "each " + name + " primitive",
+                &primitive_counter_creator,
+                &hpx::performance_counters::locality_counter_discoverer,
+                HPX_PERFORMANCE_COUNTER_V1, "bytes");
+
+            hpx::performance_counters::install_counter_type(
+                "/phylanx/primitives/" + name + "/memory/peak",
+                hpx::performance_counters::counter_raw_values,
+                "returns a list whose elements contain the peak number of "
+                    "bytes owned by all live node_data instances observed "
+                    "while the eval function of each " + name +
+                    " primitive allocated memory",
+                &primitive_counter_creator,
+                &hpx::performance_counters::locality_counter_discoverer,
+                HPX_PERFORMANCE_COUNTER_V1, "bytes");
         }
     }
 }}
@@ -13,6 +13,8 @@ PHYLANX_REGISTER_PLUGIN_MODULE();
 
 PHYLANX_REGISTER_PLUGIN_FACTORY(als_plugin,
     phylanx::execution_tree::primitives::als::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_kmeans_plugin,
+    phylanx::execution_tree::primitives::dist_kmeans::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(kmeans_plugin,
     phylanx::execution_tree::primitives::kmeans::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(lra_plugin,
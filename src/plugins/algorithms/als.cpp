@@ -57,6 +57,42 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Update the factors X from the factors Y for compressed confidence
+        // data. The confidence weighted terms are accumulated over the
+        // observed entries only, which avoids building the dense diagonal
+        // confidence matrices used for dense ratings.
+        void als_sparse_step(blaze::CompressedMatrix<double> const& conf,
+            blaze::DynamicMatrix<double> const& Y,
+            blaze::DynamicMatrix<double> const& YtY,
+            blaze::DynamicMatrix<double>& X)
+        {
+            for (std::size_t u = 0; u != conf.rows(); ++u)
+            {
+                blaze::DynamicMatrix<double> A = YtY;
+                blaze::DynamicVector<double, blaze::rowVector> b(
+                    Y.columns(), 0.0);
+
+                for (auto it = conf.begin(u); it != conf.end(u); ++it)
+                {
+                    double const c = it->value();
+                    if (c == 0.0)
+                    {
+                        continue;
+                    }
+
+                    auto y = blaze::row(Y, it->index());
+                    A += c * (blaze::trans(y) * y);
+                    b += (c + 1.0) * y;
+                }
+
+                blaze::row(X, u) = b * blaze::inv(A);
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     primitive_argument_type als::calculate_als(
         primitive_arguments_type&& args) const
@@ -70,7 +106,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the als algorithm primitive requires for the first "
                     "argument ('ratings') to represent a matrix"));
         }
-        auto ratings = arg1.matrix();
 
         auto arg2 = extract_numeric_value(args[1], name_, codename_);
         if (arg2.num_dimensions() != 0)
@@ -107,9 +142,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         using matrix_type = ir::node_data<double>::storage2d_type;
 
         // perform calculations
-        std::int64_t num_users = ratings.rows();
-        std::int64_t num_items = ratings.columns();
-        auto conf = alpha * ratings;
+        std::int64_t num_users = arg1.dimension(0);
+        std::int64_t num_items = arg1.dimension(1);
 
         matrix_type X(num_users, num_factors);
         matrix_type Y(num_items, num_factors);
@@ -138,47 +172,75 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         blaze::IdentityMatrix<double> I_f(num_factors);
-        blaze::IdentityMatrix<double> I_i(num_items);
-        blaze::IdentityMatrix<double> I_u(num_users);
-
-        blaze::DynamicMatrix<double> c_u(num_items, num_items, 0);
-        blaze::DynamicMatrix<double> c_i(num_users, num_users, 0);
 
-        for (std::int64_t step = 0; step < iterations; ++step)
+        if (arg1.is_sparse())
         {
-            YtY = (blaze::trans(Y) * Y) + regularization * I_f;
-            XtX = (blaze::trans(X) * X) + regularization * I_f;
+            blaze::CompressedMatrix<double> conf =
+                alpha * arg1.sparse_matrix();
+            blaze::CompressedMatrix<double> conf_t = blaze::trans(conf);
 
-            if (enable_output)
+            for (std::int64_t step = 0; step < iterations; ++step)
             {
-                hpx::cout << "iteration " << step << "\nX: " << X
-                          << "\nY: " << Y << std::endl;
-            }
+                YtY = (blaze::trans(Y) * Y) + regularization * I_f;
+                XtX = (blaze::trans(X) * X) + regularization * I_f;
 
-            for (std::int64_t u = 0; u < num_users; u++)
-            {
-                auto conf_u = blaze::trans(blaze::row(conf, u));
-                auto diag = blaze::band(c_u, 0);
-                diag = conf_u;
-                blaze::DynamicVector<double> p_u =
-                    blaze::map(conf_u, [&](double x) { return (x != 0.0); });
-                auto A = (blaze::trans(Y) * c_u) * Y + YtY;
-                auto b = (blaze::trans(Y) * (c_u + I_i)) * (p_u);
-                auto row_x = blaze::row(X, u);
-                row_x = (trans(b) * blaze::inv(A));
+                if (enable_output)
+                {
+                    hpx::cout << "iteration " << step << "\nX: " << X
+                              << "\nY: " << Y << std::endl;
+                }
+
+                detail::als_sparse_step(conf, Y, YtY, X);
+                detail::als_sparse_step(conf_t, X, XtX, Y);
             }
+        }
+        else
+        {
+            auto ratings = arg1.matrix();
+            auto conf = alpha * ratings;
+
+            blaze::IdentityMatrix<double> I_i(num_items);
+            blaze::IdentityMatrix<double> I_u(num_users);
 
-            for (std::int64_t i = 0; i < num_items; i++)
+            blaze::DynamicMatrix<double> c_u(num_items, num_items, 0);
+            blaze::DynamicMatrix<double> c_i(num_users, num_users, 0);
+
+            for (std::int64_t step = 0; step < iterations; ++step)
             {
-                auto conf_i = blaze::column(conf, i);
-                auto diag = blaze::band(c_i, 0);
-                diag = conf_i;
-                blaze::DynamicVector<double> p_i =
-                    blaze::map(conf_i, [&](double x) { return (x != 0.0); });
-                auto A = (blaze::trans(X) * c_i) * X + XtX;
-                auto b = (blaze::trans(X) * (c_i + I_u)) * (p_i);
-                auto row_y = blaze::row(Y, i);
-                row_y = (trans(b) * blaze::inv(A));
+                YtY = (blaze::trans(Y) * Y) + regularization * I_f;
+                XtX = (blaze::trans(X) * X) + regularization * I_f;
+
+                if (enable_output)
+                {
+                    hpx::cout << "iteration " << step << "\nX: " << X
+                              << "\nY: " << Y << std::endl;
+                }
+
+                for (std::int64_t u = 0; u < num_users; u++)
+                {
+                    auto conf_u = blaze::trans(blaze::row(conf, u));
+                    auto diag = blaze::band(c_u, 0);
+                    diag = conf_u;
+                    blaze::DynamicVector<double> p_u = blaze::map(
+                        conf_u, [&](double x) { return (x != 0.0); });
+                    auto A = (blaze::trans(Y) * c_u) * Y + YtY;
+                    auto b = (blaze::trans(Y) * (c_u + I_i)) * (p_u);
+                    auto row_x = blaze::row(X, u);
+                    row_x = (trans(b) * blaze::inv(A));
+                }
+
+                for (std::int64_t i = 0; i < num_items; i++)
+                {
+                    auto conf_i = blaze::column(conf, i);
+                    auto diag = blaze::band(c_i, 0);
+                    diag = conf_i;
+                    blaze::DynamicVector<double> p_i = blaze::map(
+                        conf_i, [&](double x) { return (x != 0.0); });
+                    auto A = (blaze::trans(X) * c_i) * X + XtX;
+                    auto b = (blaze::trans(X) * (c_i + I_u)) * (p_i);
+                    auto row_y = blaze::row(Y, i);
+                    row_y = (trans(b) * blaze::inv(A));
+                }
             }
         }
 
@@ -0,0 +1,364 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/plugins/algorithms/dist_kmeans.hpp>
+#include <phylanx/util/random.hpp>
+#include <phylanx/util/serialization/blaze.hpp>
+
+#include <hpx/iostream.hpp>
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/errors/throw_exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const dist_kmeans::match_data =
+    {
+        hpx::make_tuple("kmeans_d",
+        std::vector<std::string>{R"(
+                kmeans_d(
+                    _1_points,
+                    __arg(_2_num_centroid, 3),
+                    __arg(_3_iterations, 10),
+                    __arg(_4_show_result, false),
+                    __arg(_5_seed, nil),
+                    __arg(_6_initial_centroids, nil)
+                )
+            )"},
+            &create_dist_kmeans, &create_primitive<dist_kmeans>, R"(
+            points, num_centroids, iterations, show_result, seed,
+            initial_centroids
+
+            Args:
+
+                points (matrix): a (possibly tiled) matrix with any number of
+                    rows and columns, each row representing a point. The
+                    matrix has to be tiled by rows.
+                num_centroids (int, optional): the number of clusters in which
+                    we need to break down the data. It sets to 3 by default
+                iterations (int, optional): the number of iterations. It sets
+                    to 10 by default.
+                show_result (bool, optional): defaults to false.
+                seed (int) : the seed of a random number generator.
+                initial_centroids (matrix): if not given, the centroids are
+                    initialized by num_centroids randomly chosen points. If
+                    given there is no use for a seed. The initial_centroids
+                    matrix should have num_centroids rows and as many columns
+                    as the points matrix.
+
+            Returns:
+
+            Number of centroids points that shows the center of clusters given
+            the points matrix. The same centroids are returned on all
+            localities.)")
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_kmeans::dist_kmeans(primitive_arguments_type && operands,
+        std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    // choose num_centroids random points as the initial centroids, all
+    // localities draw the same (global) indices, the rows are contributed by
+    // the localities owning them
+    blaze::DynamicMatrix<double> dist_kmeans::initialize_centroids(
+        blaze::DynamicMatrix<double> const& points, std::int64_t row_start,
+        std::size_t num_points, std::size_t num_centroids,
+        std::string const& basename, std::uint32_t num_localities,
+        std::uint32_t locality_id) const
+    {
+        blaze::DynamicMatrix<double> centroids(
+            num_centroids, points.columns(), 0.0);
+        std::uniform_int_distribution<std::int64_t> distribution(
+            0, num_points - 1);
+        std::vector<std::int64_t> indices;
+        std::int64_t rand_index;
+
+        for (std::size_t i = 0; i != num_centroids; ++i)
+        {
+            rand_index = distribution(util::rng_);
+
+            // rand indices should be unique
+            while (std::find(indices.begin(), indices.end(), rand_index) !=
+                indices.end())
+            {
+                rand_index = distribution(util::rng_);
+            }
+            indices.emplace_back(rand_index);
+
+            std::int64_t const local_index = rand_index - row_start;
+            if (local_index >= 0 && local_index < std::int64_t(points.rows()))
+            {
+                blaze::row(centroids, i) = blaze::row(points, local_index);
+            }
+        }
+
+        if (num_localities > 1)
+        {
+            centroids = hpx::all_reduce(
+                ("all_reduce_kmeans_init_" + basename).c_str(),
+                std::move(centroids),
+                std::plus<blaze::DynamicMatrix<double>>{}, num_localities,
+                std::size_t(-1), locality_id)
+                            .get();
+        }
+        return centroids;
+    }
+
+    // assign each point to its closest centroid and generate the new
+    // centroids as the centers of the clusters
+    blaze::DynamicMatrix<double> dist_kmeans::move_centroids(
+        blaze::DynamicMatrix<double> const& points,
+        blaze::DynamicMatrix<double>&& centroids, std::size_t num_points,
+        std::string const& basename, std::uint32_t num_localities,
+        std::uint32_t locality_id) const
+    {
+        std::size_t const num_centroids = centroids.rows();
+        std::size_t const columns = centroids.columns();
+
+        // the squared distance of a point p to a centroid c is
+        // |p|^2 - 2 p.c + |c|^2, where |p|^2 does not influence which
+        // centroid is the closest one
+        blaze::DynamicVector<double, blaze::rowVector> centroid_norms =
+            blaze::trans(blaze::sum<blaze::rowwise>(centroids % centroids));
+        blaze::DynamicMatrix<double> products =
+            points * blaze::trans(centroids);
+
+        // sums of the points assigned to each centroid, the last column
+        // holds the number of points
+        blaze::DynamicMatrix<double> sums(num_centroids, columns + 1, 0.0);
+        for (std::size_t i = 0; i != points.rows(); ++i)
+        {
+            std::size_t const k = blaze::argmin(
+                centroid_norms - 2.0 * blaze::row(products, i));
+
+            blaze::submatrix(sums, k, 0, 1, columns) +=
+                blaze::submatrix(points, i, 0, 1, columns);
+            sums(k, columns) += 1.0;
+        }
+
+        if (num_localities > 1)
+        {
+            sums = hpx::all_reduce(("all_reduce_kmeans_" + basename).c_str(),
+                std::move(sums), std::plus<blaze::DynamicMatrix<double>>{},
+                num_localities, std::size_t(-1), locality_id)
+                       .get();
+        }
+
+        if (blaze::sum(blaze::column(sums, columns)) != double(num_points))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_kmeans::move_centroids",
+                generate_error_message(
+                    "the kmeans_d primitive requires the tiles of the points "
+                    "to cover the matrix without overlapping"));
+        }
+
+        blaze::DynamicMatrix<double> result(num_centroids, columns, 0.0);
+        for (std::size_t k = 0; k != num_centroids; ++k)
+        {
+            double const count = sums(k, columns);
+            if (count != 0)
+            {
+                blaze::row(result, k) =
+                    blaze::subvector(blaze::row(sums, k), 0, columns) / count;
+            }
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type dist_kmeans::calculate_kmeans(
+        primitive_arguments_type&& args) const
+    {
+        // the tiling of the points, if any
+        std::uint32_t locality_id = 0;
+        std::uint32_t num_localities = 1;
+        std::string basename;
+        std::int64_t row_start = 0;
+        std::size_t num_points = 0;
+
+        bool const is_tiled = args[0].has_annotation();
+        if (is_tiled)
+        {
+            localities_information localities =
+                extract_localities_information(args[0], name_, codename_);
+
+            locality_id = localities.locality_.locality_id_;
+            num_localities = localities.locality_.num_localities_;
+            basename = localities.annotation_.name_;
+
+            if (localities.num_dimensions() != 2)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans_d algorithm primitive requires for the "
+                        "first argument, points, to represent a matrix"));
+            }
+
+            tiling_information_2d tile_info(
+                localities.tiles_[locality_id], name_, codename_);
+            if (tile_info.spans_[1].size() !=
+                std::int64_t(localities.columns(name_, codename_)))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans_d algorithm primitive requires for the "
+                        "first argument, points, to be tiled by rows"));
+            }
+
+            row_start = tile_info.spans_[0].start_;
+            num_points = localities.rows(name_, codename_);
+        }
+
+        // extract arguments
+        auto arg0 = extract_numeric_value(std::move(args[0]), name_, codename_);
+        if (arg0.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_kmeans::calculate_kmeans",
+                generate_error_message(
+                    "the kmeans_d algorithm primitive requires for the first "
+                    "argument, points, to represent a matrix"));
+        }
+        auto const points = arg0.matrix();
+        if (!is_tiled)
+        {
+            num_points = points.rows();
+        }
+
+        std::size_t num_centroids = 3;
+        if (valid(args[1]))
+        {
+            num_centroids = extract_scalar_positive_integer_value_strict(
+                std::move(args[1]), name_, codename_);
+        }
+
+        std::size_t iterations = 10;
+        if (valid(args[2]))
+        {
+            iterations = extract_scalar_positive_integer_value_strict(
+                std::move(args[2]), name_, codename_);
+        }
+
+        bool show_result = false;
+        if (valid(args[3]))
+        {
+            show_result = extract_scalar_boolean_value(
+                std::move(args[3]), name_, codename_);
+        }
+
+        std::uint32_t seed = 42;
+        if (valid(args[4]))
+        {
+            seed = extract_scalar_positive_integer_value_strict(
+                std::move(args[4]), name_, codename_);
+        }
+        util::set_seed(seed);
+
+        // initializing the centroids
+        blaze::DynamicMatrix<double> centroids;
+        if (valid(args[5]))
+        {
+            auto arg5 =
+                extract_numeric_value(std::move(args[5]), name_, codename_);
+            if (arg5.num_dimensions() != 2)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans_d algorithm primitive requires for the "
+                        "initial_centroids to represent a matrix"));
+            }
+            centroids = arg5.matrix();
+            if (centroids.columns() != points.columns() ||
+                centroids.rows() != num_centroids)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_kmeans::calculate_kmeans",
+                    generate_error_message(
+                        "the kmeans_d algorithm primitive requires for the "
+                        "initial_centroids to have num_centroids rows and as "
+                        "many columns as the points"));
+            }
+        }
+        else
+        {
+            centroids = initialize_centroids(points, row_start, num_points,
+                num_centroids, basename, num_localities, locality_id);
+        }
+
+        // kmeans calculations
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            centroids = move_centroids(points, std::move(centroids),
+                num_points, basename, num_localities, locality_id);
+            if (show_result && locality_id == 0)
+            {
+                std::cout << "centroids after iteration " << i << ": "
+                          << centroids << std::endl;
+            }
+        }
+
+        return primitive_argument_type{std::move(centroids)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> dist_kmeans::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.empty() || operands.size() > 6)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_kmeans::eval",
+                generate_error_message(
+                    "the kmeans_d algorithm primitive requires at least one "
+                    "and at most 6 operands"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "dist_kmeans::eval",
+                generate_error_message(
+                    "the kmeans_d algorithm primitive requires that the "
+                    "arguments given by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            hpx::util::unwrapping(
+                [this_ = std::move(this_)](primitive_arguments_type&& args)
+                    -> primitive_argument_type
+                {
+                    return this_->calculate_kmeans(std::move(args));
+                }),
+            detail::map_operands(
+                operands, functional::value_operand{}, args, name_, codename_,
+                std::move(ctx)));
+    }
+}}}
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -25,6 +26,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         struct add_op
         {
+            // the operation is closed over compressed matrices
+            using supports_sparse = std::true_type;
+
             template <typename T1, typename T2>
             auto operator()(T1 const& t1, T2 const& t2) const
             ->  decltype(t1 + t2)
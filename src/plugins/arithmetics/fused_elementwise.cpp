@@ -0,0 +1,718 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/arithmetics/fused_elementwise.hpp>
+#include <phylanx/util/buffer_pool.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/errors/throw_exception.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const fused_elementwise::match_data =
+    {
+        match_pattern_type{"__fused",
+            std::vector<std::string>{"__fused(_1, __2)"},
+            &create_fused_elementwise,
+            &create_primitive<fused_elementwise>, R"(
+            program, args
+            Args:
+
+                program (string) : the element-wise operations to apply,
+                    encoded in reverse polish notation
+                *args (arg list) : the leaf operands of the fused expression
+
+            Returns:
+
+            The result of applying the encoded sequence of element-wise
+            operations to the given arguments. This primitive is generated
+            by the compiler for nested expressions built from the
+            operations __add, __sub, __mul, and __div.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        fused_program parse_fused_program(std::string const& program,
+            std::size_t num_operands, std::string const& name,
+            std::string const& codename)
+        {
+            fused_program result;
+            std::vector<std::uint8_t> loaded(num_operands, 0);
+
+            std::size_t depth = 0;
+            std::istringstream strm(program);
+            std::string token;
+            while (strm >> token)
+            {
+                fused_instruction instr{fused_instruction::load, 0};
+                if (token == "+")
+                {
+                    instr.op_ = fused_instruction::add;
+                }
+                else if (token == "-")
+                {
+                    instr.op_ = fused_instruction::sub;
+                }
+                else if (token == "*")
+                {
+                    instr.op_ = fused_instruction::mul;
+                }
+                else if (token == "/")
+                {
+                    instr.op_ = fused_instruction::div;
+                }
+                else
+                {
+                    std::size_t pos = 0;
+                    try
+                    {
+                        instr.operand_ = std::stoul(token, &pos);
+                    }
+                    catch (std::exception const&)
+                    {
+                        pos = 0;
+                    }
+
+                    if (pos != token.size() || instr.operand_ >= num_operands)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "parse_fused_program",
+                            util::generate_error_message(
+                                "invalid token in fused program: '" + token +
+                                    "'",
+                                name, codename));
+                    }
+                    if (loaded[instr.operand_]++ != 0)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "parse_fused_program",
+                            util::generate_error_message(
+                                "each operand can be referenced only once by "
+                                    "a fused program",
+                                name, codename));
+                    }
+
+                    ++depth;
+                    result.push_back(instr);
+                    continue;
+                }
+
+                if (depth < 2)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "parse_fused_program",
+                        util::generate_error_message(
+                            "stack underflow while parsing fused program: '" +
+                                program + "'",
+                            name, codename));
+                }
+
+                --depth;
+                result.push_back(instr);
+            }
+
+            if (depth != 1 ||
+                std::find(loaded.begin(), loaded.end(), 0) != loaded.end())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "parse_fused_program",
+                    util::generate_error_message(
+                        "the fused program must reference all operands and "
+                            "must produce exactly one result: '" + program +
+                            "'",
+                        name, codename));
+            }
+
+            return result;
+        }
+
+        std::size_t fused_stack_depth(fused_program const& program)
+        {
+            std::size_t depth = 0, max_depth = 0;
+            for (auto const& instr : program)
+            {
+                if (instr.op_ == fused_instruction::load)
+                {
+                    max_depth = (std::max)(max_depth, ++depth);
+                }
+                else
+                {
+                    --depth;
+                }
+            }
+            return max_depth;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Evaluates a fused program for contiguous runs of elements. All
+        // intermediate values are kept in a block sized scratch buffer (one
+        // block per stack slot), such that the temporaries stay in cache.
+        template <typename T>
+        class fused_kernel
+        {
+        public:
+            static constexpr std::size_t block_size = 512;
+
+            fused_kernel(fused_program const& program, std::size_t stack_depth)
+              : program_(program)
+              , buffer_(stack_depth * block_size)
+              , stack_(stack_depth)
+            {}
+
+            // Evaluate the program for 'count' elements. The data of operand
+            // 'i' starts at operands[i], scalar operands are broadcast.
+            void operator()(T* result, std::vector<T const*> const& operands,
+                std::vector<std::uint8_t> const& is_scalar, std::size_t count)
+            {
+                for (std::size_t base = 0; base < count; base += block_size)
+                {
+                    std::size_t const len =
+                        (std::min)(block_size, count - base);
+
+                    std::size_t sp = 0;
+                    std::size_t const last = program_.size() - 1;
+                    for (std::size_t i = 0; i != program_.size(); ++i)
+                    {
+                        fused_instruction const& instr = program_[i];
+                        if (instr.op_ == fused_instruction::load)
+                        {
+                            std::size_t const k = instr.operand_;
+                            stack_[sp++] = is_scalar[k] ?
+                                entry{operands[k], true} :
+                                entry{operands[k] + base, false};
+                            continue;
+                        }
+
+                        entry& lhs = stack_[sp - 2];
+                        entry const& rhs = stack_[sp - 1];
+
+                        // the last operation writes directly into the result
+                        T* out = (i == last) ?
+                            result + base :
+                            buffer_.data() + (sp - 2) * block_size;
+
+                        switch (instr.op_)
+                        {
+                        case fused_instruction::add:
+                            apply(std::plus<T>{}, out, lhs, rhs, len);
+                            break;
+
+                        case fused_instruction::sub:
+                            apply(std::minus<T>{}, out, lhs, rhs, len);
+                            break;
+
+                        case fused_instruction::mul:
+                            apply(std::multiplies<T>{}, out, lhs, rhs, len);
+                            break;
+
+                        case fused_instruction::div:
+                            apply(std::divides<T>{}, out, lhs, rhs, len);
+                            break;
+
+                        default:
+                            break;
+                        }
+
+                        lhs = entry{out, lhs.scalar_ && rhs.scalar_};
+                        --sp;
+                    }
+
+                    // broadcast the result if all operands were scalars
+                    if (stack_[0].scalar_)
+                    {
+                        std::fill(result + base + 1, result + base + len,
+                            *stack_[0].data_);
+                    }
+                }
+            }
+
+        private:
+            struct entry
+            {
+                T const* data_;
+                bool scalar_;
+            };
+
+            template <typename Op>
+            static void apply(Op op, T* out, entry const& lhs,
+                entry const& rhs, std::size_t len)
+            {
+                if (lhs.scalar_)
+                {
+                    T const l = *lhs.data_;
+                    if (rhs.scalar_)
+                    {
+                        out[0] = op(l, *rhs.data_);
+                        return;
+                    }
+                    for (std::size_t j = 0; j != len; ++j)
+                    {
+                        out[j] = op(l, rhs.data_[j]);
+                    }
+                }
+                else if (rhs.scalar_)
+                {
+                    T const r = *rhs.data_;
+                    for (std::size_t j = 0; j != len; ++j)
+                    {
+                        out[j] = op(lhs.data_[j], r);
+                    }
+                }
+                else
+                {
+                    for (std::size_t j = 0; j != len; ++j)
+                    {
+                        out[j] = op(lhs.data_[j], rhs.data_[j]);
+                    }
+                }
+            }
+
+            fused_program const& program_;
+            std::vector<T> buffer_;
+            std::vector<entry> stack_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Memory layout of one operand: scalars have no spacing, otherwise
+        // the element (row/page) r starts at data_ + r * spacing_
+        template <typename T>
+        struct fused_operand
+        {
+            T const* data_;
+            std::size_t spacing_;
+            bool scalar_;
+        };
+
+        template <typename T>
+        fused_operand<T> extract_fused_operand(ir::node_data<T> const& data)
+        {
+            switch (data.num_dimensions())
+            {
+            case 1:
+                return fused_operand<T>{data.vector().data(), 0, false};
+
+            case 2:
+            {
+                auto m = data.matrix();
+                return fused_operand<T>{m.data(), m.spacing(), false};
+            }
+
+            case 3:
+            {
+                auto t = data.tensor();
+                return fused_operand<T>{t.data(), t.spacing(), false};
+            }
+
+            default:
+                break;
+            }
+            return fused_operand<T>{&data.scalar(), 0, true};
+        }
+
+        // Find an operand that holds its own data and has the shape of the
+        // result, its storage can be reused for the result
+        template <typename T>
+        std::size_t find_reusable_operand(
+            std::vector<ir::node_data<T>> const& data, std::size_t dims)
+        {
+            for (std::size_t i = 0; i != data.size(); ++i)
+            {
+                if (!data[i].is_ref() && data[i].num_dimensions() == dims)
+                {
+                    return i;
+                }
+            }
+            return data.size();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    fused_elementwise::fused_elementwise(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , stack_depth_(0)
+    {
+        if (!operands_.empty() && is_string_operand(operands_[0]))
+        {
+            program_ = detail::parse_fused_program(
+                extract_string_value_strict(operands_[0], name_, codename_),
+                operands_.size() - 1, name_, codename_);
+            stack_depth_ = detail::fused_stack_depth(program_);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool fused_elementwise::supports_fused_evaluation(
+        primitive_arguments_type const& ops) const
+    {
+        for (auto const& op : ops)
+        {
+            if (op.has_annotation() || is_sparse_operand(op) ||
+                !(is_numeric_operand_strict(op) ||
+                    is_float32_operand_strict(op) ||
+                    is_integer_operand_strict(op)))
+            {
+                return false;
+            }
+        }
+
+        std::size_t const dims = extract_largest_dimension(ops, name_, codename_);
+        if (dims > 3)
+        {
+            return false;
+        }
+
+        // all operands must be scalars or must have the shape of the result,
+        // everything else is handled by the broadcasting non-fused operations
+        auto const shape = extract_largest_dimensions(ops, name_, codename_);
+        for (auto const& op : ops)
+        {
+            std::size_t const opdims =
+                extract_numeric_value_dimension(op, name_, codename_);
+            if (opdims != 0 &&
+                (opdims != dims ||
+                    extract_numeric_value_dimensions(op, name_, codename_) !=
+                        shape))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type fused_elementwise::fused0d(
+        primitive_arguments_type&& ops) const
+    {
+        std::vector<ir::node_data<T>> data;
+        data.reserve(ops.size());
+
+        std::vector<T const*> operands;
+        operands.reserve(ops.size());
+
+        for (auto&& op : ops)
+        {
+            data.push_back(extract_node_data<T>(std::move(op), name_, codename_));
+            operands.push_back(&data.back().scalar());
+        }
+
+        T result = T(0);
+        detail::fused_kernel<T> kernel(program_, stack_depth_);
+        kernel(&result, operands,
+            std::vector<std::uint8_t>(operands.size(), 1), 1);
+
+        return primitive_argument_type{ir::node_data<T>{result}};
+    }
+
+    template <typename T>
+    primitive_argument_type fused_elementwise::fused1d(
+        primitive_arguments_type&& ops, std::size_t size) const
+    {
+        std::vector<ir::node_data<T>> data;
+        data.reserve(ops.size());
+        for (auto&& op : ops)
+        {
+            data.push_back(extract_node_data<T>(std::move(op), name_, codename_));
+        }
+
+        std::vector<T const*> operands;
+        std::vector<std::uint8_t> is_scalar;
+        operands.reserve(data.size());
+        is_scalar.reserve(data.size());
+        for (auto const& d : data)
+        {
+            auto const op = detail::extract_fused_operand(d);
+            operands.push_back(op.data_);
+            is_scalar.push_back(op.scalar_);
+        }
+
+        std::size_t const reuse = detail::find_reusable_operand(data, 1);
+        ir::node_data<T> result = (reuse != data.size()) ?
+            std::move(data[reuse]) :
+            ir::node_data<T>{util::pooled_vector<T>(size)};
+
+        detail::fused_kernel<T> kernel(program_, stack_depth_);
+        kernel(result.vector().data(), operands, is_scalar, size);
+
+        return primitive_argument_type{std::move(result)};
+    }
+
+    template <typename T>
+    primitive_argument_type fused_elementwise::fused2d(
+        primitive_arguments_type&& ops, std::size_t rows,
+        std::size_t columns) const
+    {
+        std::vector<ir::node_data<T>> data;
+        data.reserve(ops.size());
+        for (auto&& op : ops)
+        {
+            data.push_back(extract_node_data<T>(std::move(op), name_, codename_));
+        }
+
+        std::vector<detail::fused_operand<T>> layout;
+        layout.reserve(data.size());
+        for (auto const& d : data)
+        {
+            layout.push_back(detail::extract_fused_operand(d));
+        }
+
+        std::size_t const reuse = detail::find_reusable_operand(data, 2);
+        ir::node_data<T> result = (reuse != data.size()) ?
+            std::move(data[reuse]) :
+            ir::node_data<T>{util::pooled_matrix<T>(rows, columns)};
+
+        auto m = result.matrix();
+
+        std::vector<T const*> operands(layout.size());
+        std::vector<std::uint8_t> is_scalar(layout.size());
+        for (std::size_t k = 0; k != layout.size(); ++k)
+        {
+            is_scalar[k] = layout[k].scalar_;
+        }
+
+        detail::fused_kernel<T> kernel(program_, stack_depth_);
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            for (std::size_t k = 0; k != layout.size(); ++k)
+            {
+                operands[k] = layout[k].data_ + i * layout[k].spacing_;
+            }
+            kernel(m.data(i), operands, is_scalar, columns);
+        }
+
+        return primitive_argument_type{std::move(result)};
+    }
+
+    template <typename T>
+    primitive_argument_type fused_elementwise::fused3d(
+        primitive_arguments_type&& ops, std::size_t pages, std::size_t rows,
+        std::size_t columns) const
+    {
+        std::vector<ir::node_data<T>> data;
+        data.reserve(ops.size());
+        for (auto&& op : ops)
+        {
+            data.push_back(extract_node_data<T>(std::move(op), name_, codename_));
+        }
+
+        std::vector<detail::fused_operand<T>> layout;
+        layout.reserve(data.size());
+        for (auto const& d : data)
+        {
+            layout.push_back(detail::extract_fused_operand(d));
+        }
+
+        std::size_t const reuse = detail::find_reusable_operand(data, 3);
+        ir::node_data<T> result = (reuse != data.size()) ?
+            std::move(data[reuse]) :
+            ir::node_data<T>{
+                util::pooled_tensor<T>(pages, rows, columns)};
+
+        auto t = result.tensor();
+
+        std::vector<T const*> operands(layout.size());
+        std::vector<std::uint8_t> is_scalar(layout.size());
+        for (std::size_t k = 0; k != layout.size(); ++k)
+        {
+            is_scalar[k] = layout[k].scalar_;
+        }
+
+        detail::fused_kernel<T> kernel(program_, stack_depth_);
+        for (std::size_t p = 0; p != pages; ++p)
+        {
+            for (std::size_t i = 0; i != rows; ++i)
+            {
+                std::size_t const row = p * rows + i;
+                for (std::size_t k = 0; k != layout.size(); ++k)
+                {
+                    operands[k] = layout[k].data_ + row * layout[k].spacing_;
+                }
+                kernel(t.data(i, p), operands, is_scalar, columns);
+            }
+        }
+
+        return primitive_argument_type{std::move(result)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type fused_elementwise::fused_helper(
+        primitive_arguments_type&& ops) const
+    {
+        auto const dims = extract_largest_dimensions(ops, name_, codename_);
+        switch (extract_largest_dimension(ops, name_, codename_))
+        {
+        case 0:
+            return fused0d<T>(std::move(ops));
+
+        case 1:
+            return fused1d<T>(std::move(ops), dims[0]);
+
+        case 2:
+            return fused2d<T>(std::move(ops), dims[0], dims[1]);
+
+        case 3:
+            return fused3d<T>(std::move(ops), dims[0], dims[1], dims[2]);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "fused_elementwise::fused_helper",
+            generate_error_message("operand has unsupported number of "
+                "dimensions"));
+    }
+
+    primitive_argument_type fused_elementwise::fused(
+        primitive_arguments_type&& ops) const
+    {
+        if (supports_fused_evaluation(ops))
+        {
+            switch (extract_common_type(ops))
+            {
+            case node_data_type_int64:
+                return fused_helper<std::int64_t>(std::move(ops));
+
+            case node_data_type_float32:
+                return fused_helper<float>(std::move(ops));
+
+            case node_data_type_double:
+                return fused_helper<double>(std::move(ops));
+
+            default:
+                break;
+            }
+        }
+        return unfused(std::move(ops));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type fused_elementwise::unfused(
+        primitive_arguments_type&& ops) const
+    {
+        static char const* const primitive_names[] = {
+            "", "__add", "__sub", "__mul", "__div"
+        };
+
+        compiler::primitive_name_parts name_parts;
+        if (!compiler::parse_primitive_name(name_, name_parts))
+        {
+            name_parts = compiler::primitive_name_parts("__fused");
+        }
+
+        // the primitives are not registered with AGAS, they are used locally
+        // only for the duration of this evaluation
+        std::array<primitive, 5> operations;
+
+        std::vector<primitive_argument_type> stack;
+        stack.reserve(stack_depth_);
+
+        for (auto const& instr : program_)
+        {
+            if (instr.op_ == detail::fused_instruction::load)
+            {
+                stack.push_back(std::move(ops[instr.operand_]));
+                continue;
+            }
+
+            primitive_arguments_type args;
+            args.reserve(2);
+            args.push_back(std::move(stack[stack.size() - 2]));
+            args.push_back(std::move(stack.back()));
+            stack.pop_back();
+
+            primitive& p = operations[instr.op_];
+            if (!p.valid())
+            {
+                name_parts.primitive = primitive_names[instr.op_];
+                p = create_primitive_component(hpx::find_here(),
+                    name_parts.primitive, primitive_arguments_type{},
+                    compiler::compose_primitive_name(name_parts), codename_,
+                    false);
+            }
+
+            stack.back() = p.eval(hpx::launch::sync, std::move(args));
+        }
+
+        return std::move(stack.back());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> fused_elementwise::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() < 3 || !is_string_operand(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise::eval",
+                generate_error_message(
+                    "the fused_elementwise primitive requires a program "
+                    "and at least two operands"));
+        }
+
+        if (program_.empty())
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "fused_elementwise::eval",
+                generate_error_message(
+                    "the fused_elementwise primitive was not initialized "
+                    "with a valid program"));
+        }
+
+        for (auto it = operands.begin() + 1; it != operands.end(); ++it)
+        {
+            if (!valid(*it))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "fused_elementwise::eval",
+                    generate_error_message(
+                        "the fused_elementwise primitive requires that the "
+                        "arguments given by the operands array are valid"));
+            }
+        }
+
+        primitive_arguments_type leaves(operands.begin() + 1, operands.end());
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            hpx::util::unwrapping(
+                [this_ = std::move(this_)](primitive_arguments_type&& ops)
+                -> primitive_argument_type
+                {
+                    return this_->fused(std::move(ops));
+                }),
+            detail::map_operands(leaves, functional::value_operand{}, args,
+                name_, codename_, std::move(ctx)));
+    }
+}}}
@@ -152,8 +152,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            // single precision operands are never widened to double
+            t = retain_argument_type_ || is_float32_operand_strict(op) ?
+                extract_common_type(op) :
+                node_data_type_double;
         }
 
         switch (t)
@@ -162,6 +164,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic0d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
+            return generic0d(
+                extract_float32_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -179,8 +185,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            // single precision operands are never widened to double
+            t = retain_argument_type_ || is_float32_operand_strict(op) ?
+                extract_common_type(op) :
+                node_data_type_double;
         }
 
         switch (t)
@@ -189,6 +197,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic1d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
+            return generic1d(
+                extract_float32_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -206,8 +218,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            // single precision operands are never widened to double
+            t = retain_argument_type_ || is_float32_operand_strict(op) ?
+                extract_common_type(op) :
+                node_data_type_double;
         }
 
         switch (t)
@@ -216,6 +230,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic2d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
+            return generic2d(
+                extract_float32_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -233,8 +251,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         if (t == node_data_type_unknown)
         {
-            t = retain_argument_type_ ? extract_common_type(op) :
-                                        node_data_type_double;
+            // single precision operands are never widened to double
+            t = retain_argument_type_ || is_float32_operand_strict(op) ?
+                extract_common_type(op) :
+                node_data_type_double;
         }
 
         switch (t)
@@ -243,6 +263,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic3d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
+            return generic3d(
+                extract_float32_value(std::move(op), name_, codename_));
+
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
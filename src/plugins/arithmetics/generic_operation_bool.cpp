@@ -117,6 +117,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic0d_bool(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -144,6 +145,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic1d_bool(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -171,6 +173,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic2d_bool(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -198,6 +201,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return generic3d_bool(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -28,6 +28,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         // scalars need 't1 * t2', vectors and matrices use blaze::map()
         struct mul_op
         {
+            // the operation is closed over compressed matrices
+            using supports_sparse = std::true_type;
+
             ///////////////////////////////////////////////////////////////////
             template <typename T1, typename T2>
             typename std::enable_if<
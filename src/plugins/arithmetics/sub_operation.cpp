@@ -8,6 +8,7 @@
 #include <phylanx/plugins/arithmetics/numeric_impl.hpp>
 
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -21,6 +22,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         struct sub_op
         {
+            // the operation is closed over compressed matrices
+            using supports_sparse = std::true_type;
+
             template <typename T1, typename T2>
             auto operator()(T1 const& t1, T2 const& t2) const
             {
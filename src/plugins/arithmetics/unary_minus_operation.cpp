@@ -134,6 +134,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 std::move(op), name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return neg0d(
                 extract_value_scalar<double>(std::move(op), name_, codename_));
@@ -168,6 +169,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 std::move(op), sizes[0], name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return neg1d(extract_value_vector<double>(
                 std::move(op), sizes[0], name_, codename_));
@@ -202,6 +204,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return neg2d(extract_value_matrix<double>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
@@ -236,6 +239,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return neg3d(extract_value_matrix<double>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
@@ -42,6 +42,12 @@ namespace phylanx { namespace common
                 extract_integer_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_float32:
+            return dot0d(
+                extract_float32_value(std::move(lhs), name, codename),
+                extract_float32_value(std::move(rhs), name, codename),
+                name, codename);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot0d(
@@ -81,6 +87,12 @@ namespace phylanx { namespace common
                 extract_integer_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_float32:
+            return dot1d(
+                extract_float32_value(std::move(lhs), name, codename),
+                extract_float32_value(std::move(rhs), name, codename),
+                name, codename);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot1d(
@@ -120,6 +132,12 @@ namespace phylanx { namespace common
                 extract_integer_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_float32:
+            return dot2d(
+                extract_float32_value(std::move(lhs), name, codename),
+                extract_float32_value(std::move(rhs), name, codename),
+                name, codename);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot2d(
@@ -159,6 +177,12 @@ namespace phylanx { namespace common
                 extract_integer_value(std::move(rhs), name, codename),
                 name, codename);
 
+        case node_data_type_float32:
+            return dot3d(
+                extract_float32_value(std::move(lhs), name, codename),
+                extract_float32_value(std::move(rhs), name, codename),
+                name, codename);
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot3d(
@@ -79,6 +79,7 @@ namespace phylanx { namespace common {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return indices1d_helper<double>(size);
 
@@ -148,6 +149,7 @@ namespace phylanx { namespace common {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return indices2d_helper<double>(rows, columns);
 
@@ -225,6 +227,7 @@ namespace phylanx { namespace common {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return indices3d_helper<double>(pages, rows, columns);
 
@@ -315,6 +318,7 @@ namespace phylanx { namespace common {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return indices4d_helper<double>(quats, pages, rows, columns);
 
@@ -423,6 +427,7 @@ namespace phylanx { namespace common {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return sparse_indices1d_helper<double>(size);
 
@@ -490,6 +495,7 @@ namespace phylanx { namespace common {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return sparse_indices2d_helper<double>(rows, columns);
 
@@ -564,6 +570,7 @@ namespace phylanx { namespace common {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return sparse_indices3d_helper<double>(pages, rows, columns);
 
@@ -652,6 +659,7 @@ namespace phylanx { namespace common {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return sparse_indices4d_helper<double>(quats, pages, rows, columns);
 
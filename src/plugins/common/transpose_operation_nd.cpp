@@ -35,7 +35,11 @@ namespace phylanx { namespace common
     template <typename T>
     execution_tree::primitive_argument_type transpose2d(ir::node_data<T>&& arg)
     {
-        if (arg.is_ref())
+        if (arg.is_sparse())
+        {
+            blaze::transpose(arg.sparse_matrix());
+        }
+        else if (arg.is_ref())
         {
             arg = blaze::trans(arg.matrix());
         }
@@ -64,6 +68,7 @@ namespace phylanx { namespace common
                 extract_integer_value_strict(std::move(arg), name, codename));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose2d(
                 extract_numeric_value(std::move(arg), name, codename));
@@ -117,6 +122,7 @@ namespace phylanx { namespace common
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose2d(
                 extract_numeric_value(std::move(arg), name, codename),
@@ -215,6 +221,7 @@ namespace phylanx { namespace common
                 extract_integer_value_strict(std::move(arg), name, codename));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg), name, codename));
@@ -276,6 +283,7 @@ namespace phylanx { namespace common
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg), name, codename),
@@ -493,6 +501,7 @@ namespace phylanx { namespace common
                 extract_integer_value_strict(std::move(arg), name, codename));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose4d(
                 extract_numeric_value(std::move(arg), name, codename));
@@ -637,6 +646,7 @@ namespace phylanx { namespace common
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose4d(
                 extract_numeric_value(std::move(arg), name, codename),
@@ -292,6 +292,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 std::move(ctx));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return fold_right_array_helper(std::move(bound_func),
                 std::move(initial), extract_node_data<double>(std::move(data)),
@@ -15,12 +15,15 @@
 #include <phylanx/plugins/common/conv1d_all_paddings.hpp>
 #include <phylanx/plugins/dist_keras_support/dist_conv1d.hpp>
 #include <phylanx/plugins/keras_support/conv_indices_helper.hpp>
+#include <phylanx/util/distributed_tensor.hpp>
+#include <phylanx/util/halo_exchange.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/errors/throw_exception.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -31,6 +34,9 @@
 #include <blaze/Math.h>
 #include <blaze_tensor/Math.h>
 
+////////////////////////////////////////////////////////////////////////////////
+REGISTER_DISTRIBUTED_TENSOR_DECLARATION(double);
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace dist_keras_support { namespace primitives
 {
@@ -158,6 +164,166 @@ namespace phylanx { namespace dist_keras_support { namespace primitives
 
             return execution_tree::primitive_argument_type{std::move(result)};
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // valid convolution of x, the results are stored starting at the
+        // given row of result
+        template <typename Tensor>
+        void conv1d_valid(Tensor const& x,
+            blaze::DynamicTensor<double> const& k,
+            blaze::DynamicTensor<double>& result, std::size_t offset)
+        {
+            std::size_t filter_length = k.pages();
+            if (x.rows() < filter_length)
+            {
+                return;
+            }
+
+            std::size_t batch = x.pages();
+            std::size_t in_channels = x.columns();
+            std::size_t out_channels = k.columns();
+            std::size_t result_length = x.rows() - filter_length + 1;
+
+            for (std::size_t c = 0; c != out_channels; ++c)
+            {
+                auto kslice = blaze::columnslice(k, c);
+                for (std::size_t i = 0; i != result_length; ++i)
+                {
+                    auto schur_product =
+                        blaze::subtensor(
+                            x, 0, i, 0, batch, filter_length, in_channels) %
+                        blaze::submatrix(
+                            kslice, 0, 0, filter_length, in_channels);
+                    for (std::size_t p = 0; p != batch; ++p)
+                    {
+                        auto pslice = blaze::pageslice(schur_product, p);
+                        result(p, offset + i, c) = blaze::sum(pslice);
+                    }
+                }
+            }
+        }
+
+        // stack the rows of two tensors
+        template <typename Tensor1, typename Tensor2>
+        blaze::DynamicTensor<double> conv1d_concat(
+            Tensor1 const& top, Tensor2 const& bottom)
+        {
+            std::size_t batch = top.pages();
+            std::size_t in_channels = top.columns();
+
+            blaze::DynamicTensor<double> result(
+                batch, top.rows() + bottom.rows(), in_channels);
+            blaze::subtensor(result, 0, 0, 0, batch, top.rows(),
+                in_channels) = top;
+            blaze::subtensor(result, 0, top.rows(), 0, batch, bottom.rows(),
+                in_channels) = bottom;
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The tiles of arg partition its rows. The rows of the neighbouring
+        // tiles needed at the boundaries of the local tile (the halo) are
+        // fetched while the interior of the local tile is convolved. The
+        // halo has pad_top rows above the local tile and
+        // filter_length - 1 - pad_top rows below it. Halo rows outside of
+        // the array are zero unless zero_pad is false, in which case they
+        // are dropped along with the results depending on them.
+        execution_tree::primitive_argument_type conv1d_halo(
+            ir::node_data<double>&& arg, ir::node_data<double>&& kernel,
+            execution_tree::localities_information const& arg_locs,
+            std::int64_t pad_top, bool zero_pad, std::int64_t& res_row_stop,
+            std::string const& name, std::string const& codename)
+        {
+            using namespace execution_tree;
+
+            std::uint32_t const loc_id = arg_locs.locality_.locality_id_;
+            std::uint32_t const numtiles = arg_locs.locality_.num_localities_;
+
+            auto a = arg.tensor();
+            blaze::DynamicTensor<double> k = kernel.tensor();
+
+            std::int64_t const overlap = k.pages() - 1;
+            std::int64_t const length = a.rows();
+
+            tiling_information_3d tile_info(
+                arg_locs.tiles_[loc_id], name, codename);
+            std::int64_t const row_start = tile_info.spans_[1].start_;
+            std::int64_t const row_stop = tile_info.spans_[1].stop_;
+
+            std::int64_t const before = pad_top;
+            std::int64_t after = overlap - pad_top;
+            if (!zero_pad)
+            {
+                after = (std::min)(after,
+                    std::int64_t(arg_locs.rows(name, codename)) - row_stop);
+            }
+
+            util::distributed_tensor<double> data(
+                "halo_" + arg_locs.annotation_.name_, a, numtiles, loc_id);
+
+            auto top = util::fetch_halo(data, arg_locs,
+                tiling_span(row_start - before, row_start), name, codename);
+            auto bottom = util::fetch_halo(data, arg_locs,
+                tiling_span(row_stop, row_stop + after), name, codename);
+
+            std::int64_t const result_length =
+                (std::max)(before + length + after - overlap, std::int64_t(0));
+            blaze::DynamicTensor<double> result(
+                a.pages(), result_length, k.columns());
+
+            if (length >= overlap)
+            {
+                // the interior does not depend on the halo
+                conv1d_valid(a, k, result, before);
+
+                conv1d_valid(conv1d_concat(top.get(),
+                                 blaze::subtensor(a, 0, 0, 0, a.pages(),
+                                     overlap, a.columns())),
+                    k, result, 0);
+                conv1d_valid(conv1d_concat(blaze::subtensor(a, 0,
+                                               length - overlap, 0, a.pages(),
+                                               overlap, a.columns()),
+                                 bottom.get()),
+                    k, result, before + length - overlap);
+            }
+            else
+            {
+                // the local tile is smaller than the kernel
+                conv1d_valid(
+                    conv1d_concat(conv1d_concat(top.get(), a), bottom.get()),
+                    k, result, 0);
+            }
+
+            // make sure no other locality still accesses the local tile
+            hpx::lcos::barrier b("barrier_halo_" + arg_locs.annotation_.name_,
+                numtiles, loc_id);
+            b.wait();
+
+            res_row_stop = row_start + result_length;
+            return primitive_argument_type{std::move(result)};
+        }
+
+        // the tiles of arg partition its rows (they don't overlap)
+        bool conv1d_rows_partitioned(
+            execution_tree::localities_information const& arg_locs,
+            std::string const& name, std::string const& codename)
+        {
+            if (!arg_locs.is_row_tiled(name, codename) ||
+                arg_locs.is_page_tiled(name, codename))
+            {
+                return false;
+            }
+
+            std::int64_t rows = 0;
+            for (auto const& tile : arg_locs.tiles_)
+            {
+                if (tile.spans_[1].is_valid())
+                {
+                    rows += tile.spans_[1].size();
+                }
+            }
+            return rows == std::int64_t(arg_locs.rows(name, codename));
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -201,7 +367,28 @@ namespace phylanx { namespace dist_keras_support { namespace primitives
             std::int64_t arg_row_start = tile_info.spans_[1].start_;
             std::int64_t arg_row_stop = tile_info.spans_[1].stop_;
 
-            if (padding == "valid" || arg_locs.is_page_tiled(name_, codename_))
+            if (detail::conv1d_rows_partitioned(arg_locs, name_, codename_))
+            {
+                // spatial parallelization without overlapping tiles, the
+                // boundary rows are exchanged with the neighbours
+                std::int64_t pad_top = 0;
+                if (padding == "same")
+                {
+                    pad_top = (filter_length - 1) / 2;
+                }
+                else if (padding == "causal")
+                {
+                    pad_top = filter_length - 1;
+                }
+
+                res_row_start = arg_row_start;
+                local_result = detail::conv1d_halo(
+                    ir::node_data<double>(std::move(arg)), std::move(kernel),
+                    arg_locs, pad_top, padding != "valid", res_row_stop,
+                    name_, codename_);
+            }
+            else if (padding == "valid" ||
+                arg_locs.is_page_tiled(name_, codename_))
             {
                 res_row_start = arg_row_start;
                 local_result = common::conv1d_all_paddings(
@@ -300,6 +300,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_numeric_value(std::move(arr), name_, codename_),
                 std::move(locs));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return all_gather2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
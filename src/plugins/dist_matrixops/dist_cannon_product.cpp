@@ -95,6 +95,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dot2d2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
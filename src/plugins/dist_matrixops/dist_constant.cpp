@@ -181,6 +181,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(ctx));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return constant1d_helper<double>(std::move(value), dims[0],
                 tile_idx, numtiles, std::move(given_name), intersection,
@@ -285,6 +286,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 intersections, std::move(ctx));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return constant2d_helper<double>(std::move(value), dims, tile_idx,
                 numtiles, std::move(given_name), tiling_type, intersections,
@@ -396,6 +398,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 intersections, std::move(ctx));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return constant3d_helper<double>(std::move(value), dims, tile_idx,
                 numtiles, std::move(given_name), tiling_type, intersections,
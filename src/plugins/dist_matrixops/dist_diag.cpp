@@ -392,6 +392,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
                 tiling_type, tile_idx, numtiles, std::move(arr_localities),
                 std::move(ctx));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return dist_diag1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
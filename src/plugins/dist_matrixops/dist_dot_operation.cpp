@@ -81,6 +81,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 extract_integer_value(std::move(rhs), name_, codename_));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dot0d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -129,6 +130,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(lhs_localities), rhs_localities);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dot1d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -178,6 +180,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(lhs_localities), rhs_localities);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dot2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -227,6 +230,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 lhs_localities, rhs_localities);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dot3d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -0,0 +1,958 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/locality_annotation.hpp>
+#include <phylanx/execution_tree/meta_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_elementwise_operation.hpp>
+#include <phylanx/util/distributed_matrix.hpp>
+#include <phylanx/util/distributed_tensor.hpp>
+#include <phylanx/util/distributed_vector.hpp>
+#include <phylanx/util/overlapped_fetch.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+using std_int64_t = std::int64_t;
+using std_uint8_t = std::uint8_t;
+
+///////////////////////////////////////////////////////////////////////////////
+REGISTER_DISTRIBUTED_VECTOR_DECLARATION(double);
+REGISTER_DISTRIBUTED_VECTOR_DECLARATION(std_int64_t);
+REGISTER_DISTRIBUTED_VECTOR_DECLARATION(std_uint8_t);
+
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_int64_t);
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(std_uint8_t);
+
+REGISTER_DISTRIBUTED_TENSOR_DECLARATION(double);
+REGISTER_DISTRIBUTED_TENSOR_DECLARATION(std_int64_t);
+REGISTER_DISTRIBUTED_TENSOR_DECLARATION(std_uint8_t);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+#define PHYLANX_ELEMENTWISE_MATCH_DATA(name, doc)                              \
+    execution_tree::match_pattern_type{name,                                   \
+        std::vector<std::string>{name "(_1, _2)"},                             \
+        &create_dist_elementwise_operation,                                    \
+        &execution_tree::create_primitive<dist_elementwise_operation>, doc}    \
+    /**/
+
+    std::vector<execution_tree::match_pattern_type> const
+        dist_elementwise_operation::match_data =
+    {
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__add_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise sum of `lhs` and `rhs`. If the operands are
+            tiled differently, the result is tiled like the operand that
+            requires the least amount of data to be moved between the
+            localities.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__sub_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise difference of `lhs` and `rhs`.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__mul_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise product of `lhs` and `rhs`.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__div_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise quotient of `lhs` and `rhs`.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__gt_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise truth value of `lhs > rhs`.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__ge_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise truth value of `lhs >= rhs`.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__lt_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise truth value of `lhs < rhs`.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__le_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise truth value of `lhs <= rhs`.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__eq_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise truth value of `lhs == rhs`.)"),
+        PHYLANX_ELEMENTWISE_MATCH_DATA("__ne_d", R"(
+            lhs, rhs
+            Args:
+
+                lhs (array) : a (possibly tiled) array or a scalar
+                rhs (array) : a (possibly tiled) array or a scalar
+
+            Returns:
+
+            The element-wise truth value of `lhs != rhs`.)")
+    };
+
+#undef PHYLANX_ELEMENTWISE_MATCH_DATA
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        dist_elementwise_operation::elementwise_op extract_elementwise_op(
+            std::string const& name)
+        {
+            using op_type = dist_elementwise_operation;
+
+            if (name == "__add_d") return op_type::add;
+            if (name == "__sub_d") return op_type::sub;
+            if (name == "__mul_d") return op_type::mul;
+            if (name == "__div_d") return op_type::div;
+            if (name == "__gt_d") return op_type::gt;
+            if (name == "__ge_d") return op_type::ge;
+            if (name == "__lt_d") return op_type::lt;
+            if (name == "__le_d") return op_type::le;
+            if (name == "__eq_d") return op_type::eq;
+
+            HPX_ASSERT(name == "__ne_d");
+            return op_type::ne;
+        }
+    }
+
+    dist_elementwise_operation::dist_elementwise_operation(
+            execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , op_(detail::extract_elementwise_op(extract_function_name(name)))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // the spans of a tile in all of its dimensions ([pages,] [rows,]
+        // columns), unused dimensions are represented by unit spans
+        using tile_box = std::array<execution_tree::tiling_span, 3>;
+
+        tile_box get_tile_box(execution_tree::tiling_information const& tile,
+            std::size_t ndim)
+        {
+            using execution_tree::tiling_span;
+
+            tile_box box{tiling_span(0, 1), tiling_span(0, 1),
+                tiling_span(0, 1)};
+            if (ndim == 1)
+            {
+                // row vectors have an empty column span
+                bool const row_vector =
+                    tile.spans_.size() > 1 && !tile.spans_[0].is_valid();
+                box[0] = row_vector ? tile.spans_[1] : tile.spans_[0];
+                return box;
+            }
+
+            for (std::size_t i = 0; i != ndim; ++i)
+            {
+                box[i] =
+                    i < tile.spans_.size() ? tile.spans_[i] : tiling_span();
+            }
+            return box;
+        }
+
+        std::int64_t box_size(tile_box const& box)
+        {
+            std::int64_t size = 1;
+            for (auto const& span : box)
+            {
+                size *= (std::max)(span.size(), std::int64_t(0));
+            }
+            return size;
+        }
+
+        bool intersect(
+            tile_box const& lhs, tile_box const& rhs, tile_box& result)
+        {
+            for (std::size_t i = 0; i != result.size(); ++i)
+            {
+                if (!execution_tree::intersect(lhs[i], rhs[i], result[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool equal(tile_box const& lhs, tile_box const& rhs)
+        {
+            for (std::size_t i = 0; i != lhs.size(); ++i)
+            {
+                if (lhs[i].start_ != rhs[i].start_ ||
+                    lhs[i].stop_ != rhs[i].stop_)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool contains(tile_box const& box, tile_box const& part)
+        {
+            for (std::size_t i = 0; i != box.size(); ++i)
+            {
+                if (part[i].start_ < box[i].start_ ||
+                    part[i].stop_ > box[i].stop_)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // number of elements of the moved array that have to be sent to
+        // other localities if it is realigned with the tiling of the anchor
+        std::int64_t realignment_cost(
+            execution_tree::localities_information const& anchor,
+            execution_tree::localities_information const& moved,
+            std::size_t ndim)
+        {
+            std::int64_t cost = 0;
+            for (std::size_t loc = 0; loc != anchor.tiles_.size(); ++loc)
+            {
+                tile_box des = get_tile_box(anchor.tiles_[loc], ndim);
+                tile_box intersection;
+
+                cost += box_size(des);
+                if (intersect(des,
+                        get_tile_box(moved.tiles_[loc], ndim), intersection))
+                {
+                    cost -= box_size(intersection);
+                }
+            }
+            return cost;
+        }
+
+        // the moved array has to be fetched from remote localities if any of
+        // its local tiles does not cover the corresponding tile of the anchor
+        bool needs_fetch(execution_tree::localities_information const& anchor,
+            execution_tree::localities_information const& moved,
+            std::size_t ndim)
+        {
+            for (std::size_t loc = 0; loc != anchor.tiles_.size(); ++loc)
+            {
+                tile_box des = get_tile_box(anchor.tiles_[loc], ndim);
+                if (box_size(des) != 0 &&
+                    !contains(get_tile_box(moved.tiles_[loc], ndim), des))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct realign_part
+        {
+            std::uint32_t loc_;
+            tile_box intersection_;     // global coordinates
+            tile_box origin_;           // tile of the array on locality loc_
+        };
+
+        // the remote tiles of the given array holding parts of des which are
+        // not available locally
+        std::vector<realign_part> remote_parts(
+            execution_tree::localities_information const& localities,
+            std::size_t ndim, tile_box const& des)
+        {
+            std::uint32_t const loc_id = localities.locality_.locality_id_;
+
+            tile_box local_intersection;
+            bool const has_local = intersect(des,
+                get_tile_box(localities.tiles_[loc_id], ndim),
+                local_intersection);
+
+            std::vector<realign_part> parts;
+            if (has_local && contains(local_intersection, des))
+            {
+                return parts;
+            }
+
+            for (std::uint32_t loc = 0; loc != localities.tiles_.size(); ++loc)
+            {
+                if (loc == loc_id)
+                {
+                    continue;
+                }
+
+                tile_box origin = get_tile_box(localities.tiles_[loc], ndim);
+                tile_box intersection;
+                if (intersect(des, origin, intersection) &&
+                    !(has_local && contains(local_intersection, intersection)))
+                {
+                    parts.push_back(realign_part{loc, intersection, origin});
+                }
+            }
+            return parts;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        blaze::DynamicVector<T> realign1d(ir::node_data<T>&& arg,
+            execution_tree::localities_information const& arg_localities,
+            tile_box const& des, tile_box const& cur,
+            std::string const& basename, bool needs_fetch)
+        {
+            auto v = arg.vector();
+            blaze::DynamicVector<T> result(des[0].size());
+
+            auto copy_local = [&]() {
+                tile_box intersection;
+                if (intersect(des, cur, intersection))
+                {
+                    blaze::subvector(result,
+                        intersection[0].start_ - des[0].start_,
+                        intersection[0].size()) =
+                        blaze::subvector(v,
+                            intersection[0].start_ - cur[0].start_,
+                            intersection[0].size());
+                }
+            };
+
+            if (!needs_fetch)
+            {
+                copy_local();
+                return result;
+            }
+
+            std::uint32_t const loc_id = arg_localities.locality_.locality_id_;
+            std::uint32_t const num_localities =
+                arg_localities.locality_.num_localities_;
+
+            util::distributed_vector<T> v_data(
+                basename, v, num_localities, loc_id);
+
+            auto parts = remote_parts(arg_localities, 1, des);
+            util::overlapped_fetch(parts.size(),
+                [&](std::size_t i) {
+                    auto const& part = parts[i];
+                    return v_data.fetch(part.loc_,
+                        part.intersection_[0].start_ - part.origin_[0].start_,
+                        part.intersection_[0].stop_ - part.origin_[0].start_);
+                },
+                copy_local,
+                [&](std::size_t i, blaze::DynamicVector<T>&& data) {
+                    auto const& part = parts[i];
+                    blaze::subvector(result,
+                        part.intersection_[0].start_ - des[0].start_,
+                        part.intersection_[0].size()) = data;
+                });
+
+            // keep the local part alive until all localities are done
+            hpx::lcos::barrier b(
+                "barrier_" + basename, num_localities, loc_id);
+            b.wait();
+
+            return result;
+        }
+
+        template <typename T>
+        blaze::DynamicMatrix<T> realign2d(ir::node_data<T>&& arg,
+            execution_tree::localities_information const& arg_localities,
+            tile_box const& des, tile_box const& cur,
+            std::string const& basename, bool needs_fetch)
+        {
+            auto m = arg.matrix();
+            blaze::DynamicMatrix<T> result(des[0].size(), des[1].size());
+
+            auto copy_local = [&]() {
+                tile_box intersection;
+                if (intersect(des, cur, intersection))
+                {
+                    blaze::submatrix(result,
+                        intersection[0].start_ - des[0].start_,
+                        intersection[1].start_ - des[1].start_,
+                        intersection[0].size(), intersection[1].size()) =
+                        blaze::submatrix(m,
+                            intersection[0].start_ - cur[0].start_,
+                            intersection[1].start_ - cur[1].start_,
+                            intersection[0].size(), intersection[1].size());
+                }
+            };
+
+            if (!needs_fetch)
+            {
+                copy_local();
+                return result;
+            }
+
+            std::uint32_t const loc_id = arg_localities.locality_.locality_id_;
+            std::uint32_t const num_localities =
+                arg_localities.locality_.num_localities_;
+
+            util::distributed_matrix<T> m_data(
+                basename, m, num_localities, loc_id);
+
+            auto parts = remote_parts(arg_localities, 2, des);
+            util::overlapped_fetch(parts.size(),
+                [&](std::size_t i) {
+                    auto const& part = parts[i];
+                    return m_data.fetch(part.loc_,
+                        part.intersection_[0].start_ - part.origin_[0].start_,
+                        part.intersection_[1].start_ - part.origin_[1].start_,
+                        part.intersection_[0].stop_ - part.origin_[0].start_,
+                        part.intersection_[1].stop_ - part.origin_[1].start_);
+                },
+                copy_local,
+                [&](std::size_t i, blaze::DynamicMatrix<T>&& data) {
+                    auto const& part = parts[i];
+                    blaze::submatrix(result,
+                        part.intersection_[0].start_ - des[0].start_,
+                        part.intersection_[1].start_ - des[1].start_,
+                        part.intersection_[0].size(),
+                        part.intersection_[1].size()) = data;
+                });
+
+            // keep the local part alive until all localities are done
+            hpx::lcos::barrier b(
+                "barrier_" + basename, num_localities, loc_id);
+            b.wait();
+
+            return result;
+        }
+
+        template <typename T>
+        blaze::DynamicTensor<T> realign3d(ir::node_data<T>&& arg,
+            execution_tree::localities_information const& arg_localities,
+            tile_box const& des, tile_box const& cur,
+            std::string const& basename, bool needs_fetch)
+        {
+            auto t = arg.tensor();
+            blaze::DynamicTensor<T> result(
+                des[0].size(), des[1].size(), des[2].size());
+
+            auto copy_local = [&]() {
+                tile_box intersection;
+                if (intersect(des, cur, intersection))
+                {
+                    blaze::subtensor(result,
+                        intersection[0].start_ - des[0].start_,
+                        intersection[1].start_ - des[1].start_,
+                        intersection[2].start_ - des[2].start_,
+                        intersection[0].size(), intersection[1].size(),
+                        intersection[2].size()) =
+                        blaze::subtensor(t,
+                            intersection[0].start_ - cur[0].start_,
+                            intersection[1].start_ - cur[1].start_,
+                            intersection[2].start_ - cur[2].start_,
+                            intersection[0].size(), intersection[1].size(),
+                            intersection[2].size());
+                }
+            };
+
+            if (!needs_fetch)
+            {
+                copy_local();
+                return result;
+            }
+
+            std::uint32_t const loc_id = arg_localities.locality_.locality_id_;
+            std::uint32_t const num_localities =
+                arg_localities.locality_.num_localities_;
+
+            util::distributed_tensor<T> t_data(
+                basename, t, num_localities, loc_id);
+
+            auto parts = remote_parts(arg_localities, 3, des);
+            util::overlapped_fetch(parts.size(),
+                [&](std::size_t i) {
+                    auto const& part = parts[i];
+                    return t_data.fetch(part.loc_,
+                        part.intersection_[0].start_ - part.origin_[0].start_,
+                        part.intersection_[1].start_ - part.origin_[1].start_,
+                        part.intersection_[2].start_ - part.origin_[2].start_,
+                        part.intersection_[0].stop_ - part.origin_[0].start_,
+                        part.intersection_[1].stop_ - part.origin_[1].start_,
+                        part.intersection_[2].stop_ - part.origin_[2].start_);
+                },
+                copy_local,
+                [&](std::size_t i, blaze::DynamicTensor<T>&& data) {
+                    auto const& part = parts[i];
+                    blaze::subtensor(result,
+                        part.intersection_[0].start_ - des[0].start_,
+                        part.intersection_[1].start_ - des[1].start_,
+                        part.intersection_[2].start_ - des[2].start_,
+                        part.intersection_[0].size(),
+                        part.intersection_[1].size(),
+                        part.intersection_[2].size()) = data;
+                });
+
+            // keep the local part alive until all localities are done
+            hpx::lcos::barrier b(
+                "barrier_" + basename, num_localities, loc_id);
+            b.wait();
+
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename R, typename T, typename Op>
+        execution_tree::primitive_argument_type map_nd(
+            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs, Op op)
+        {
+            using execution_tree::primitive_argument_type;
+
+            auto f = [op](T x, T y) -> R { return R(op(x, y)); };
+
+            std::size_t const lhs_dims = lhs.num_dimensions();
+            std::size_t const rhs_dims = rhs.num_dimensions();
+
+            // scalars are broadcast to the shape of the other operand
+            if (lhs_dims == 0 && rhs_dims != 0)
+            {
+                T const x = lhs.scalar();
+                auto g = [&](T y) -> R { return f(x, y); };
+                switch (rhs_dims)
+                {
+                case 1:
+                    return primitive_argument_type{
+                        ir::node_data<R>{blaze::map(rhs.vector(), g)}};
+                case 2:
+                    return primitive_argument_type{
+                        ir::node_data<R>{blaze::map(rhs.matrix(), g)}};
+                default:
+                    return primitive_argument_type{
+                        ir::node_data<R>{blaze::map(rhs.tensor(), g)}};
+                }
+            }
+
+            if (rhs_dims == 0 && lhs_dims != 0)
+            {
+                T const y = rhs.scalar();
+                auto g = [&](T x) -> R { return f(x, y); };
+                switch (lhs_dims)
+                {
+                case 1:
+                    return primitive_argument_type{
+                        ir::node_data<R>{blaze::map(lhs.vector(), g)}};
+                case 2:
+                    return primitive_argument_type{
+                        ir::node_data<R>{blaze::map(lhs.matrix(), g)}};
+                default:
+                    return primitive_argument_type{
+                        ir::node_data<R>{blaze::map(lhs.tensor(), g)}};
+                }
+            }
+
+            switch (lhs_dims)
+            {
+            case 0:
+                return primitive_argument_type{
+                    ir::node_data<R>{f(lhs.scalar(), rhs.scalar())}};
+            case 1:
+                return primitive_argument_type{ir::node_data<R>{
+                    blaze::map(lhs.vector(), rhs.vector(), f)}};
+            case 2:
+                return primitive_argument_type{ir::node_data<R>{
+                    blaze::map(lhs.matrix(), rhs.matrix(), f)}};
+            default:
+                return primitive_argument_type{ir::node_data<R>{
+                    blaze::map(lhs.tensor(), rhs.tensor(), f)}};
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        execution_tree::annotation tile_annotation(
+            execution_tree::tiling_information const& tile, std::size_t ndim,
+            std::string const& name, std::string const& codename)
+        {
+            using namespace execution_tree;
+
+            switch (ndim)
+            {
+            case 1:
+                return tiling_information_1d(tile, name, codename)
+                    .as_annotation(name, codename);
+            case 2:
+                return tiling_information_2d(tile, name, codename)
+                    .as_annotation(name, codename);
+            default:
+                return tiling_information_3d(tile, name, codename)
+                    .as_annotation(name, codename);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    ir::node_data<T> dist_elementwise_operation::realign(ir::node_data<T>&& arg,
+        execution_tree::localities_information const& arg_localities,
+        execution_tree::localities_information const& anchor_localities,
+        bool needs_fetch) const
+    {
+        std::size_t const ndim = arg.num_dimensions();
+
+        detail::tile_box des = detail::get_tile_box(
+            anchor_localities.tiles_[anchor_localities.locality_.locality_id_],
+            ndim);
+        detail::tile_box cur = detail::get_tile_box(
+            arg_localities.tiles_[arg_localities.locality_.locality_id_],
+            ndim);
+
+        // nothing to do if the tiles are aligned already
+        if (!needs_fetch && detail::equal(des, cur))
+        {
+            return std::move(arg);
+        }
+
+        std::string basename =
+            "elementwise_" + arg_localities.annotation_.name_;
+
+        switch (ndim)
+        {
+        case 1:
+            return ir::node_data<T>{detail::realign1d(std::move(arg),
+                arg_localities, des, cur, basename, needs_fetch)};
+        case 2:
+            return ir::node_data<T>{detail::realign2d(std::move(arg),
+                arg_localities, des, cur, basename, needs_fetch)};
+        case 3:
+            return ir::node_data<T>{detail::realign3d(std::move(arg),
+                arg_localities, des, cur, basename, needs_fetch)};
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_elementwise_operation::realign",
+            generate_error_message(
+                "the operands have unsupported number of dimensions"));
+    }
+
+    template <typename T>
+    execution_tree::primitive_argument_type
+    dist_elementwise_operation::compute(
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const
+    {
+        switch (op_)
+        {
+        case add:
+            return detail::map_nd<T>(
+                std::move(lhs), std::move(rhs), std::plus<T>{});
+        case sub:
+            return detail::map_nd<T>(
+                std::move(lhs), std::move(rhs), std::minus<T>{});
+        case mul:
+            return detail::map_nd<T>(
+                std::move(lhs), std::move(rhs), std::multiplies<T>{});
+        case div:
+            return detail::map_nd<T>(
+                std::move(lhs), std::move(rhs), std::divides<T>{});
+        case gt:
+            return detail::map_nd<std::uint8_t>(
+                std::move(lhs), std::move(rhs), std::greater<T>{});
+        case ge:
+            return detail::map_nd<std::uint8_t>(
+                std::move(lhs), std::move(rhs), std::greater_equal<T>{});
+        case lt:
+            return detail::map_nd<std::uint8_t>(
+                std::move(lhs), std::move(rhs), std::less<T>{});
+        case le:
+            return detail::map_nd<std::uint8_t>(
+                std::move(lhs), std::move(rhs), std::less_equal<T>{});
+        case eq:
+            return detail::map_nd<std::uint8_t>(
+                std::move(lhs), std::move(rhs), std::equal_to<T>{});
+        case ne:
+            return detail::map_nd<std::uint8_t>(
+                std::move(lhs), std::move(rhs), std::not_equal_to<T>{});
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_elementwise_operation::compute",
+            generate_error_message("unknown element-wise operation"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    execution_tree::primitive_argument_type
+    dist_elementwise_operation::elementwise(ir::node_data<T>&& lhs,
+        ir::node_data<T>&& rhs,
+        execution_tree::localities_information&& lhs_localities,
+        execution_tree::localities_information&& rhs_localities,
+        bool lhs_annotated, bool rhs_annotated) const
+    {
+        using namespace execution_tree;
+
+        std::size_t const lhs_dims = lhs.num_dimensions();
+        std::size_t const rhs_dims = rhs.num_dimensions();
+
+        // the result is tiled like the anchor
+        localities_information* anchor = nullptr;
+
+        if (lhs_dims == 0 || rhs_dims == 0)
+        {
+            // scalars are broadcast, no data has to be moved
+            if (lhs_dims != 0 && lhs_annotated)
+            {
+                anchor = &lhs_localities;
+            }
+            else if (rhs_dims != 0 && rhs_annotated)
+            {
+                anchor = &rhs_localities;
+            }
+        }
+        else
+        {
+            if (lhs_dims != rhs_dims ||
+                lhs_localities.dimensions(name_, codename_) !=
+                    rhs_localities.dimensions(name_, codename_))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "dist_elementwise_operation::elementwise",
+                    generate_error_message(
+                        "the dimensions of the operands do not match"));
+            }
+
+            if (lhs_annotated && rhs_annotated)
+            {
+                if (lhs_localities.locality_.num_localities_ !=
+                    rhs_localities.locality_.num_localities_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "dist_elementwise_operation::elementwise",
+                        generate_error_message(
+                            "the operands are distributed over a different "
+                            "number of localities"));
+                }
+
+                // realign the operand that requires moving less data, all
+                // localities come to the same decision
+                if (detail::realignment_cost(
+                        lhs_localities, rhs_localities, lhs_dims) <=
+                    detail::realignment_cost(
+                        rhs_localities, lhs_localities, lhs_dims))
+                {
+                    bool const fetch = detail::needs_fetch(
+                        lhs_localities, rhs_localities, lhs_dims);
+                    rhs = realign(std::move(rhs), rhs_localities,
+                        lhs_localities, fetch);
+                    anchor = &lhs_localities;
+                }
+                else
+                {
+                    bool const fetch = detail::needs_fetch(
+                        rhs_localities, lhs_localities, lhs_dims);
+                    lhs = realign(std::move(lhs), lhs_localities,
+                        rhs_localities, fetch);
+                    anchor = &rhs_localities;
+                }
+            }
+            else if (lhs_annotated)
+            {
+                // the non-annotated operand is available on all localities
+                rhs = realign(
+                    std::move(rhs), rhs_localities, lhs_localities, false);
+                anchor = &lhs_localities;
+            }
+            else if (rhs_annotated)
+            {
+                lhs = realign(
+                    std::move(lhs), lhs_localities, rhs_localities, false);
+                anchor = &rhs_localities;
+            }
+        }
+
+        primitive_argument_type result =
+            compute(std::move(lhs), std::move(rhs));
+        if (anchor == nullptr)
+        {
+            return result;
+        }
+
+        ++anchor->annotation_.generation_;
+
+        auto locality_ann = anchor->locality_.as_annotation();
+        result.set_annotation(
+            localities_annotation(locality_ann,
+                detail::tile_annotation(
+                    anchor->tiles_[anchor->locality_.locality_id_],
+                    (std::max)(lhs_dims, rhs_dims), name_, codename_),
+                anchor->annotation_, name_, codename_),
+            name_, codename_);
+
+        return result;
+    }
+
+    execution_tree::primitive_argument_type
+    dist_elementwise_operation::elementwise(
+        execution_tree::primitive_argument_type&& lhs,
+        execution_tree::primitive_argument_type&& rhs) const
+    {
+        using namespace execution_tree;
+
+        bool const lhs_annotated = lhs.has_annotation();
+        bool const rhs_annotated = rhs.has_annotation();
+
+        localities_information lhs_localities =
+            extract_localities_information(lhs, name_, codename_);
+        localities_information rhs_localities =
+            extract_localities_information(rhs, name_, codename_);
+
+        switch (extract_common_type(lhs, rhs))
+        {
+        case node_data_type_bool:
+            if (is_comparison())
+            {
+                return elementwise(
+                    extract_boolean_value(std::move(lhs), name_, codename_),
+                    extract_boolean_value(std::move(rhs), name_, codename_),
+                    std::move(lhs_localities), std::move(rhs_localities),
+                    lhs_annotated, rhs_annotated);
+            }
+            HPX_FALLTHROUGH;
+
+        case node_data_type_int64:
+            return elementwise(
+                extract_integer_value(std::move(lhs), name_, codename_),
+                extract_integer_value(std::move(rhs), name_, codename_),
+                std::move(lhs_localities), std::move(rhs_localities),
+                lhs_annotated, rhs_annotated);
+
+        case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
+        case node_data_type_double:
+            return elementwise(
+                extract_numeric_value(std::move(lhs), name_, codename_),
+                extract_numeric_value(std::move(rhs), name_, codename_),
+                std::move(lhs_localities), std::move(rhs_localities),
+                lhs_annotated, rhs_annotated);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_elementwise_operation::elementwise",
+            generate_error_message(
+                "the element-wise operations require for all arguments to "
+                    "be numeric data types"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<execution_tree::primitive_argument_type>
+    dist_elementwise_operation::eval(
+        execution_tree::primitive_arguments_type const& operands,
+        execution_tree::primitive_arguments_type const& args,
+        execution_tree::eval_context ctx) const
+    {
+        using namespace execution_tree;
+
+        if (operands.size() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_elementwise_operation::eval",
+                generate_error_message(
+                    "the element-wise primitives require exactly two "
+                        "operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_elementwise_operation::eval",
+                generate_error_message(
+                    "the element-wise primitives require that the "
+                        "arguments given by the operands array are valid"));
+        }
+
+        auto f = value_operand(operands[0], args, name_, codename_, ctx);
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            [this_ = std::move(this_)](
+                    hpx::future<primitive_argument_type>&& op1,
+                    hpx::future<primitive_argument_type>&& op2)
+            -> primitive_argument_type
+            {
+                return this_->elementwise(op1.get(), op2.get());
+            },
+            std::move(f),
+            value_operand(operands[1], args, name_, codename_, std::move(ctx)));
+    }
+}}}
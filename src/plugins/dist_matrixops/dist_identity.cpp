@@ -182,6 +182,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives {
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dist_identity_helper<double>(sz, tile_idx, numtiles,
                 std::move(given_name), tiling_type, std::move(ctx));
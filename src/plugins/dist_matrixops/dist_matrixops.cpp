@@ -11,6 +11,39 @@
 
 PHYLANX_REGISTER_PLUGIN_MODULE();
 
+namespace phylanx { namespace plugin
+{
+    struct dist_elementwise_operation_plugin : plugin_base
+    {
+        void register_known_primitives(std::string const& fullpath) override
+        {
+            namespace pdp = phylanx::dist_matrixops::primitives;
+
+            std::string elementwise_name("__elementwise_d");
+            for (auto const& pattern :
+                pdp::dist_elementwise_operation::match_data)
+            {
+                execution_tree::register_pattern(
+                    elementwise_name, pattern, fullpath);
+            }
+        }
+    };
+
+    struct dist_sort_plugin : plugin_base
+    {
+        void register_known_primitives(std::string const& fullpath) override
+        {
+            namespace pdp = phylanx::dist_matrixops::primitives;
+
+            std::string sort_name("__sort_d");
+            for (auto const& pattern : pdp::dist_sort::match_data)
+            {
+                execution_tree::register_pattern(sort_name, pattern, fullpath);
+            }
+        }
+    };
+}}
+
 PHYLANX_REGISTER_PLUGIN_FACTORY(all_gather_plugin,
     phylanx::dist_matrixops::primitives::all_gather::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_argmax_plugin,
@@ -25,12 +58,24 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(dist_diag_plugin,
     phylanx::dist_matrixops::primitives::dist_diag::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_dot_operation_plugin,
     phylanx::dist_matrixops::primitives::dist_dot_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(
+    phylanx::plugin::dist_elementwise_operation_plugin,
+    dist_elementwise_operation_plugin,
+    phylanx::dist_matrixops::primitives::dist_elementwise_operation::
+        match_data[0],
+    "__elementwise_d");
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_identity_plugin,
     phylanx::dist_matrixops::primitives::dist_identity::match_data)
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_inverse_operation_plugin,
     phylanx::dist_matrixops::primitives::dist_inverse::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_random_plugin,
     phylanx::dist_matrixops::primitives::dist_random::match_data)
+PHYLANX_REGISTER_PLUGIN_FACTORY(phylanx::plugin::dist_sort_plugin,
+    dist_sort_plugin,
+    phylanx::dist_matrixops::primitives::dist_sort::match_data[0],
+    "__sort_d");
+PHYLANX_REGISTER_PLUGIN_FACTORY(dist_summa_product_plugin,
+    phylanx::dist_matrixops::primitives::dist_summa_product::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(dist_transpose_operation_plugin,
     phylanx::dist_matrixops::primitives::dist_transpose_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(retile_annotations_plugin,
@@ -0,0 +1,502 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/annotation.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/locality_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_sort.hpp>
+#include <phylanx/util/distributed_vector.hpp>
+#include <phylanx/util/overlapped_fetch.hpp>
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+using std_int64_t = std::int64_t;
+using std_uint8_t = std::uint8_t;
+
+///////////////////////////////////////////////////////////////////////////////
+REGISTER_DISTRIBUTED_VECTOR_DECLARATION(double);
+REGISTER_DISTRIBUTED_VECTOR_DECLARATION(std_int64_t);
+REGISTER_DISTRIBUTED_VECTOR_DECLARATION(std_uint8_t);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace dist_matrixops { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<execution_tree::match_pattern_type> const
+        dist_sort::match_data =
+    {
+        execution_tree::match_pattern_type{"sort_d",
+            std::vector<std::string>{"sort_d(_1)"},
+            &create_dist_sort, &execution_tree::create_primitive<dist_sort>,
+            R"(
+            a
+            Args:
+
+                a (array) : a (possibly tiled) vector
+
+            Returns:
+
+            The values of `a` in ascending order. The result is tiled
+            according to the partitioning found by the sort, which can
+            differ from the tiling of `a`.)"},
+        execution_tree::match_pattern_type{"argsort_d",
+            std::vector<std::string>{"argsort_d(_1)"},
+            &create_dist_sort, &execution_tree::create_primitive<dist_sort>,
+            R"(
+            a
+            Args:
+
+                a (array) : a (possibly tiled) vector
+
+            Returns:
+
+            The (global) indices that would sort `a`. Equal values are
+            ordered by their index. The result is tiled according to the
+            partitioning found by the sort, which can differ from the
+            tiling of `a`.)"}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_sort::dist_sort(execution_tree::primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , argsort_(extract_function_name(name) == "argsort_d")
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // the values are sorted together with their global index, which
+        // makes all keys unique and the result independent of the tiling
+        template <typename T>
+        using sort_key = std::pair<T, std::int64_t>;
+
+        // select num_localities - 1 splitters from the regular samples
+        // gathered from all localities, the splitters are distinct as long
+        // as there are at least as many samples as localities
+        template <typename T>
+        std::vector<sort_key<T>> select_splitters(
+            std::vector<std::vector<sort_key<T>>>&& all_samples,
+            std::uint32_t num_localities)
+        {
+            std::vector<sort_key<T>> samples;
+            for (auto& s : all_samples)
+            {
+                samples.insert(samples.end(),
+                    std::make_move_iterator(s.begin()),
+                    std::make_move_iterator(s.end()));
+            }
+            std::sort(samples.begin(), samples.end());
+
+            HPX_ASSERT(samples.size() >= num_localities);
+
+            std::vector<sort_key<T>> splitters;
+            splitters.reserve(num_localities - 1);
+            for (std::size_t j = 1; j != num_localities; ++j)
+            {
+                splitters.push_back(
+                    samples[j * samples.size() / num_localities]);
+            }
+            return splitters;
+        }
+
+        template <typename T>
+        void merge_run(std::vector<sort_key<T>>& merged,
+            std::vector<sort_key<T>>&& run)
+        {
+            std::size_t const middle = merged.size();
+            merged.insert(merged.end(), std::make_move_iterator(run.begin()),
+                std::make_move_iterator(run.end()));
+            std::inplace_merge(
+                merged.begin(), merged.begin() + middle, merged.end());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    execution_tree::primitive_argument_type dist_sort::sort1d(
+        ir::node_data<T>&& arg,
+        execution_tree::localities_information&& localities) const
+    {
+        using namespace execution_tree;
+        using key_type = detail::sort_key<T>;
+
+        std::uint32_t const loc_id = localities.locality_.locality_id_;
+        std::uint32_t const num_localities =
+            localities.locality_.num_localities_;
+        std::string const& basename = localities.annotation_.name_;
+
+        tiling_information_1d tile_info(
+            localities.tiles_[loc_id], name_, codename_);
+
+        std::int64_t const size = localities.size(name_, codename_);
+        if (size < std::int64_t(num_localities))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::sort1d",
+                generate_error_message(
+                    "the sort primitives require the operand to have at "
+                    "least as many elements as there are localities"));
+        }
+
+        // sort the local tile
+        auto v = arg.vector();
+        std::vector<key_type> local(v.size());
+        for (std::size_t i = 0; i != v.size(); ++i)
+        {
+            local[i] = key_type(v[i], tile_info.span_.start_ + i);
+        }
+        hpx::parallel::sort(hpx::execution::par, local.begin(), local.end());
+
+        // select the splitters from a regular sample of all sorted tiles
+        std::size_t const num_samples =
+            (std::min)(local.size(), std::size_t(num_localities));
+
+        std::vector<key_type> samples;
+        samples.reserve(num_samples);
+        for (std::size_t k = 0; k != num_samples; ++k)
+        {
+            samples.push_back(local[k * local.size() / num_samples]);
+        }
+
+        std::vector<key_type> splitters = detail::select_splitters(
+            hpx::all_gather(("all_gather_sort_samples_" + basename).c_str(),
+                std::move(samples), num_localities, std::size_t(-1), loc_id)
+                .get(),
+            num_localities);
+
+        // the elements of the local tile destined for locality j are in
+        // [bounds[j], bounds[j + 1])
+        std::vector<std::int64_t> bounds(num_localities + 1, 0);
+        for (std::size_t j = 1; j != num_localities; ++j)
+        {
+            bounds[j] = std::distance(local.begin(),
+                std::lower_bound(local.begin(), local.end(),
+                    splitters[j - 1]));
+        }
+        bounds[num_localities] = local.size();
+
+        std::vector<std::vector<std::int64_t>> all_bounds =
+            hpx::all_gather(("all_gather_sort_bounds_" + basename).c_str(),
+                bounds, num_localities, std::size_t(-1), loc_id)
+                .get();
+
+        // position of the new local tile
+        std::int64_t offset = 0;
+        std::int64_t count = 0;
+        std::int64_t total = 0;
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            for (auto const& b : all_bounds)
+            {
+                std::int64_t const n = b[j + 1] - b[j];
+                if (j < loc_id)
+                {
+                    offset += n;
+                }
+                else if (j == loc_id)
+                {
+                    count += n;
+                }
+                total += n;
+            }
+        }
+
+        if (total != size)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::sort1d",
+                generate_error_message(
+                    "the sort primitives require the tiles of the operand "
+                    "to cover the array without overlapping"));
+        }
+
+        // make the sorted local tile available to the other localities
+        blaze::DynamicVector<T> values(local.size());
+        blaze::DynamicVector<std::int64_t> indices(local.size());
+        for (std::size_t i = 0; i != local.size(); ++i)
+        {
+            values[i] = local[i].first;
+            indices[i] = local[i].second;
+        }
+
+        util::distributed_vector<T> values_data(
+            "sort_values_" + basename, values, num_localities, loc_id);
+        util::distributed_vector<std::int64_t> indices_data(
+            "sort_indices_" + basename, indices, num_localities, loc_id);
+
+        std::vector<std::uint32_t> sources;
+        for (std::uint32_t src = 0; src != num_localities; ++src)
+        {
+            if (src != loc_id &&
+                all_bounds[src][loc_id + 1] != all_bounds[src][loc_id])
+            {
+                sources.push_back(src);
+            }
+        }
+
+        // collect the (sorted) runs destined for this locality, the indices
+        // are needed only for argsort_d
+        std::vector<std::vector<key_type>> runs(num_localities);
+        std::vector<hpx::future<blaze::DynamicVector<std::int64_t>>>
+            index_futures(sources.size());
+
+        util::overlapped_fetch(sources.size(),
+            [&](std::size_t i) {
+                std::uint32_t const src = sources[i];
+                std::size_t const start = all_bounds[src][loc_id];
+                std::size_t const stop = all_bounds[src][loc_id + 1];
+                if (argsort_)
+                {
+                    index_futures[i] = indices_data.fetch(src, start, stop);
+                }
+                return values_data.fetch(src, start, stop);
+            },
+            [&]() {
+                runs[loc_id].assign(local.begin() + bounds[loc_id],
+                    local.begin() + bounds[loc_id + 1]);
+            },
+            [&](std::size_t i, blaze::DynamicVector<T>&& data) {
+                auto& run = runs[sources[i]];
+                run.reserve(data.size());
+                if (argsort_)
+                {
+                    auto idx = index_futures[i].get();
+                    for (std::size_t k = 0; k != data.size(); ++k)
+                    {
+                        run.emplace_back(data[k], idx[k]);
+                    }
+                }
+                else
+                {
+                    for (std::size_t k = 0; k != data.size(); ++k)
+                    {
+                        run.emplace_back(data[k], 0);
+                    }
+                }
+            });
+
+        std::vector<key_type> merged;
+        merged.reserve(count);
+        for (auto& run : runs)
+        {
+            detail::merge_run(merged, std::move(run));
+        }
+        HPX_ASSERT(merged.size() == std::size_t(count));
+
+        // keep the local parts alive until all localities are done
+        hpx::lcos::barrier b(
+            "barrier_sort_" + basename, num_localities, loc_id);
+        b.wait();
+
+        primitive_argument_type result;
+        if (argsort_)
+        {
+            blaze::DynamicVector<std::int64_t> r(merged.size());
+            for (std::size_t i = 0; i != merged.size(); ++i)
+            {
+                r[i] = merged[i].second;
+            }
+            result = primitive_argument_type{std::move(r)};
+        }
+        else
+        {
+            blaze::DynamicVector<T> r(merged.size());
+            for (std::size_t i = 0; i != merged.size(); ++i)
+            {
+                r[i] = merged[i].first;
+            }
+            result = primitive_argument_type{ir::node_data<T>{std::move(r)}};
+        }
+
+        tiling_information_1d result_tile(
+            tile_info.type_, tiling_span(offset, offset + count));
+
+        ++localities.annotation_.generation_;
+
+        auto locality_ann = localities.locality_.as_annotation();
+        result.set_annotation(
+            localities_annotation(locality_ann,
+                result_tile.as_annotation(name_, codename_),
+                localities.annotation_, name_, codename_),
+            name_, codename_);
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename T>
+        execution_tree::primitive_argument_type sort1d_local(
+            ir::node_data<T>&& arg, bool argsort)
+        {
+            auto v = arg.vector();
+
+            std::vector<std::int64_t> order(v.size());
+            for (std::size_t i = 0; i != v.size(); ++i)
+            {
+                order[i] = i;
+            }
+            std::stable_sort(order.begin(), order.end(),
+                [&](std::int64_t lhs, std::int64_t rhs) {
+                    return v[lhs] < v[rhs];
+                });
+
+            if (argsort)
+            {
+                return execution_tree::primitive_argument_type{
+                    blaze::DynamicVector<std::int64_t>(
+                        order.size(), order.data())};
+            }
+
+            blaze::DynamicVector<T> result(v.size());
+            for (std::size_t i = 0; i != order.size(); ++i)
+            {
+                result[i] = v[order[i]];
+            }
+            return execution_tree::primitive_argument_type{
+                ir::node_data<T>{std::move(result)}};
+        }
+    }
+
+    execution_tree::primitive_argument_type dist_sort::sort1d(
+        execution_tree::primitive_argument_type&& arg) const
+    {
+        using namespace execution_tree;
+
+        if (extract_numeric_value_dimension(arg, name_, codename_) != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::sort1d",
+                generate_error_message(
+                    "the sort primitives require the operand to be a "
+                    "vector"));
+        }
+
+        // arrays that are not distributed are sorted locally
+        if (!arg.has_annotation())
+        {
+            switch (extract_common_type(arg))
+            {
+            case node_data_type_bool:
+                return detail::sort1d_local(
+                    extract_boolean_value_strict(
+                        std::move(arg), name_, codename_),
+                    argsort_);
+
+            case node_data_type_int64:
+                return detail::sort1d_local(
+                    extract_integer_value_strict(
+                        std::move(arg), name_, codename_),
+                    argsort_);
+
+            case node_data_type_unknown:
+                HPX_FALLTHROUGH;
+            case node_data_type_float32:
+            case node_data_type_double:
+                return detail::sort1d_local(
+                    extract_numeric_value(std::move(arg), name_, codename_),
+                    argsort_);
+
+            default:
+                break;
+            }
+        }
+        else
+        {
+            localities_information localities =
+                extract_localities_information(arg, name_, codename_);
+
+            switch (extract_common_type(arg))
+            {
+            case node_data_type_bool:
+                return sort1d(extract_boolean_value_strict(
+                                  std::move(arg), name_, codename_),
+                    std::move(localities));
+
+            case node_data_type_int64:
+                return sort1d(extract_integer_value_strict(
+                                  std::move(arg), name_, codename_),
+                    std::move(localities));
+
+            case node_data_type_unknown:
+                HPX_FALLTHROUGH;
+            case node_data_type_float32:
+            case node_data_type_double:
+                return sort1d(
+                    extract_numeric_value(std::move(arg), name_, codename_),
+                    std::move(localities));
+
+            default:
+                break;
+            }
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_sort::sort1d",
+            generate_error_message(
+                "the sort primitives require for all arguments to be "
+                "numeric data types"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<execution_tree::primitive_argument_type> dist_sort::eval(
+        execution_tree::primitive_arguments_type const& operands,
+        execution_tree::primitive_arguments_type const& args,
+        execution_tree::eval_context ctx) const
+    {
+        using namespace execution_tree;
+
+        if (operands.size() != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::eval",
+                generate_error_message(
+                    "the sort primitives require exactly one operand"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_sort::eval",
+                generate_error_message(
+                    "the sort primitives require that the argument given "
+                    "by the operands array is valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return value_operand(operands[0], args, name_, codename_,
+            std::move(ctx))
+            .then(hpx::launch::sync,
+                [this_ = std::move(this_)](
+                    hpx::future<primitive_argument_type>&& op)
+                    -> primitive_argument_type {
+                    return this_->sort1d(op.get());
+                });
+    }
+}}}
@@ -0,0 +1,174 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/dist_matrixops/dist_summa_product.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace dist_matrixops { namespace primitives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    execution_tree::match_pattern_type const dist_summa_product::match_data =
+    {
+        execution_tree::match_pattern_type{
+            "summa_product_d",
+            std::vector<std::string>{"summa_product_d(_1, _2)"},
+            &create_dist_summa_product,
+            &execution_tree::create_primitive<dist_summa_product>,
+            R"(a, b
+            Args:
+
+                a (array) : a distributed matrix
+                b (array) : a distributed matrix
+
+            Returns:
+
+            The dot product of two matrices: `a` and `b` using the SUMMA
+            algorithm. The dot product of an MxN matrix and an NxL is of
+            size MxL. The tiles of the result are made up by the rows of
+            the tiles of `a` and the columns of the tiles of `b`, these
+            tiles have to cover the whole result.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    dist_summa_product::dist_summa_product(
+        execution_tree::primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : execution_tree::primitives::primitive_component_base(
+            std::move(operands), name, codename)
+    {
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type dist_summa_product::dot2d(
+        execution_tree::primitive_argument_type&& lhs,
+        execution_tree::primitive_argument_type&& rhs) const
+    {
+        using namespace execution_tree;
+
+        if (!lhs.has_annotation() || !rhs.has_annotation())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_summa_product::dot2d",
+                generate_error_message(
+                    "the dist_summa_product primitive requires both "
+                    "operands to be distributed"));
+        }
+
+        execution_tree::localities_information lhs_localities =
+            extract_localities_information(lhs, name_, codename_);
+        execution_tree::localities_information rhs_localities =
+            extract_localities_information(rhs, name_, codename_);
+
+        switch (extract_common_type(lhs, rhs))
+        {
+        case node_data_type_bool:
+            return dot2d2d(
+                extract_boolean_value(std::move(lhs), name_, codename_),
+                extract_boolean_value(std::move(rhs), name_, codename_),
+                std::move(lhs_localities), rhs_localities);
+
+        case node_data_type_int64:
+            return dot2d2d(
+                extract_integer_value(std::move(lhs), name_, codename_),
+                extract_integer_value(std::move(rhs), name_, codename_),
+                std::move(lhs_localities), rhs_localities);
+
+        case node_data_type_unknown:
+            HPX_FALLTHROUGH;
+        case node_data_type_float32:
+        case node_data_type_double:
+            return dot2d2d(
+                extract_numeric_value(std::move(lhs), name_, codename_),
+                extract_numeric_value(std::move(rhs), name_, codename_),
+                std::move(lhs_localities), rhs_localities);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "dist_summa_product::dot2d",
+            generate_error_message(
+                "the distributed dot primitive requires for all arguments to "
+                "be numeric data types"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    execution_tree::primitive_argument_type dist_summa_product::dot_nd(
+        execution_tree::primitive_argument_type&& lhs,
+        execution_tree::primitive_argument_type&& rhs) const
+    {
+        using namespace execution_tree;
+
+        if (extract_numeric_value_dimension(lhs, name_, codename_) != 2 ||
+            extract_numeric_value_dimension(rhs, name_, codename_) != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_summa_product::dot_nd",
+                generate_error_message(
+                    "the dist_summa_product primitive requires both "
+                    "operands to be matrices"));
+        }
+
+        return dot2d(std::move(lhs), std::move(rhs));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<execution_tree::primitive_argument_type>
+    dist_summa_product::eval(
+        execution_tree::primitive_arguments_type const& operands,
+        execution_tree::primitive_arguments_type const& args,
+        execution_tree::eval_context ctx) const
+    {
+        using namespace execution_tree;
+
+        if (operands.size() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_summa_product::eval",
+                generate_error_message(
+                    "the dist_summa_product primitive requires exactly "
+                    "two operands"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dist_summa_product::eval",
+                generate_error_message(
+                    "the dist_summa_product primitive requires that the "
+                    "arguments given by the operands array are valid"));
+        }
+
+        auto f = value_operand(operands[0], args, name_, codename_, ctx);
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            [this_ = std::move(this_)](
+                hpx::future<primitive_argument_type>&& op1,
+                hpx::future<primitive_argument_type>&& op2)
+                -> primitive_argument_type {
+                return this_->dot_nd(op1.get(), op2.get());
+            },
+            std::move(f),
+            value_operand(operands[1], args, name_, codename_, std::move(ctx)));
+    }
+}}}
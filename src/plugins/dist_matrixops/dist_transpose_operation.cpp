@@ -233,6 +233,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(localities_info));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose2d(
                 extract_numeric_value(std::move(arg), name_, codename_),
@@ -295,6 +296,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(localities_info));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose2d(
                 extract_numeric_value(std::move(arg), name_, codename_),
@@ -384,6 +386,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(localities_info));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg), name_, codename_),
@@ -477,6 +480,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 std::move(axes), std::move(localities_info));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg), name_, codename_),
@@ -20,6 +20,7 @@
 #include <phylanx/util/distributed_tensor.hpp>
 #include <phylanx/util/distributed_vector.hpp>
 #include <phylanx/util/index_calculation_helper.hpp>
+#include <phylanx/util/overlapped_fetch.hpp>
 
 #include <hpx/assert.hpp>
 #include <hpx/include/lcos.hpp>
@@ -404,6 +405,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
         blaze::DynamicVector<T> result(des_size);
         util::distributed_vector<T> v_data(
             arr_localities.annotation_.name_, v, num_localities, loc_id);
+        v_data.set_cache_version(arr_localities.version_);
 
         // relative start
         std::int64_t rel_start = des_start - cur_start;
@@ -411,17 +413,8 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
         {
             // there is a need to fetch some part
 
-            // copying the local part
-            if (des_start < cur_stop && des_stop > cur_start)
-            {
-                auto indices = util::index_calculation_1d(
-                    des_start, des_stop, cur_start, cur_stop);
-                blaze::subvector(result, indices.projected_start_,
-                    indices.intersection_size_) = blaze::subvector(v,
-                        indices.local_start_, indices.intersection_size_);
-            }
-
-            // collecting other parts from remote localities
+            // collecting the parts needed from remote localities
+            std::vector<std::pair<std::uint32_t, util::indices_pack>> parts;
             for (std::uint32_t loc = 0; loc != num_localities; ++loc)
             {
                 if (loc == loc_id)
@@ -438,15 +431,35 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 if (indices.intersection_size_ > 0)
                 {
                     // loc_span has the part of result that we need
-                    blaze::subvector(result, indices.projected_start_,
-                        indices.intersection_size_) =
-                        v_data
-                        .fetch(loc, indices.local_start_,
-                            indices.local_start_ +
-                            indices.intersection_size_)
-                        .get();
+                    parts.emplace_back(loc, indices);
                 }
             }
+
+            // all remote parts are requested up front, the local part is
+            // copied while they are in flight
+            util::overlapped_fetch(parts.size(),
+                [&](std::size_t i) {
+                    auto const& indices = parts[i].second;
+                    return v_data.fetch(parts[i].first, indices.local_start_,
+                        indices.local_start_ + indices.intersection_size_);
+                },
+                [&]() {
+                    // copying the local part
+                    if (des_start < cur_stop && des_stop > cur_start)
+                    {
+                        auto indices = util::index_calculation_1d(
+                            des_start, des_stop, cur_start, cur_stop);
+                        blaze::subvector(result, indices.projected_start_,
+                            indices.intersection_size_) =
+                            blaze::subvector(v, indices.local_start_,
+                                indices.intersection_size_);
+                    }
+                },
+                [&](std::size_t i, blaze::DynamicVector<T>&& data) {
+                    auto const& indices = parts[i].second;
+                    blaze::subvector(result, indices.projected_start_,
+                        indices.intersection_size_) = data;
+                });
         }
         else // the new array is a subset of the original array
         {
@@ -499,6 +512,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return retile1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -603,6 +617,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
         blaze::DynamicMatrix<T> result(des_row_size, des_col_size);
         util::distributed_matrix<T> m_data(
             arr_localities.annotation_.name_, m, num_localities, loc_id);
+        m_data.set_cache_version(arr_localities.version_);
 
         // relative starts
         std::int64_t rel_row_start = des_row_start - cur_row_start;
@@ -610,25 +625,10 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
         if ((rel_row_start < 0 || des_row_stop > cur_row_stop) ||
             (rel_col_start < 0 || des_col_stop > cur_col_stop))
         {
-            // copying the local part
-            if ((des_row_start < cur_row_stop &&
-                    des_row_stop > cur_row_start) &&
-                (des_col_start < cur_col_stop && des_col_stop > cur_col_start))
-            {
-                auto row_indices = util::index_calculation_1d(
-                    des_row_start, des_row_stop, cur_row_start, cur_row_stop);
-                auto col_indices = util::index_calculation_1d(
-                    des_col_start, des_col_stop, cur_col_start, cur_col_stop);
-
-                blaze::submatrix(result, row_indices.projected_start_,
-                    col_indices.projected_start_,
-                    row_indices.intersection_size_,
-                    col_indices.intersection_size_) = blaze::submatrix(m,
-                    row_indices.local_start_, col_indices.local_start_,
-                    row_indices.intersection_size_,
-                    col_indices.intersection_size_);
-            }
-
+            // collecting the blocks needed from remote localities
+            std::vector<std::tuple<std::uint32_t, util::indices_pack,
+                util::indices_pack>>
+                parts;
             for (std::uint32_t loc = 0; loc != num_localities; ++loc)
             {
                 if (loc == loc_id)
@@ -648,20 +648,55 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                     col_indices.intersection_size_ > 0)
                 {
                     // loc_span has the block of result that we need
+                    parts.emplace_back(loc, row_indices, col_indices);
+                }
+            }
+
+            // all remote blocks are requested up front, the local part is
+            // copied while they are in flight
+            util::overlapped_fetch(parts.size(),
+                [&](std::size_t i) {
+                    auto const& row_indices = std::get<1>(parts[i]);
+                    auto const& col_indices = std::get<2>(parts[i]);
+                    return m_data.fetch(std::get<0>(parts[i]),
+                        row_indices.local_start_, col_indices.local_start_,
+                        row_indices.local_start_ +
+                            row_indices.intersection_size_,
+                        col_indices.local_start_ +
+                            col_indices.intersection_size_);
+                },
+                [&]() {
+                    // copying the local part
+                    if ((des_row_start < cur_row_stop &&
+                            des_row_stop > cur_row_start) &&
+                        (des_col_start < cur_col_stop &&
+                            des_col_stop > cur_col_start))
+                    {
+                        auto row_indices = util::index_calculation_1d(
+                            des_row_start, des_row_stop, cur_row_start,
+                            cur_row_stop);
+                        auto col_indices = util::index_calculation_1d(
+                            des_col_start, des_col_stop, cur_col_start,
+                            cur_col_stop);
+
+                        blaze::submatrix(result, row_indices.projected_start_,
+                            col_indices.projected_start_,
+                            row_indices.intersection_size_,
+                            col_indices.intersection_size_) =
+                            blaze::submatrix(m, row_indices.local_start_,
+                                col_indices.local_start_,
+                                row_indices.intersection_size_,
+                                col_indices.intersection_size_);
+                    }
+                },
+                [&](std::size_t i, blaze::DynamicMatrix<T>&& data) {
+                    auto const& row_indices = std::get<1>(parts[i]);
+                    auto const& col_indices = std::get<2>(parts[i]);
                     blaze::submatrix(result, row_indices.projected_start_,
                         col_indices.projected_start_,
                         row_indices.intersection_size_,
-                        col_indices.intersection_size_) =
-                        m_data
-                            .fetch(loc, row_indices.local_start_,
-                                col_indices.local_start_,
-                                row_indices.local_start_ +
-                                    row_indices.intersection_size_,
-                                col_indices.local_start_ +
-                                    col_indices.intersection_size_)
-                            .get();
-                }
-            }
+                        col_indices.intersection_size_) = data;
+                });
         }
         else // the new array is a subset of the original array
         {
@@ -707,6 +742,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return retile2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -837,31 +873,10 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
             (rel_row_start < 0 || des_row_stop > cur_row_stop) ||
             (rel_col_start < 0 || des_col_stop > cur_col_stop))
         {
-            // copying the local part
-            if ((des_page_start < cur_page_stop &&
-                    des_page_stop > cur_page_start) &&
-                (des_row_start < cur_row_stop &&
-                    des_row_stop > cur_row_start) &&
-                (des_col_start < cur_col_stop && des_col_stop > cur_col_start))
-            {
-                auto page_indices = util::index_calculation_1d(des_page_start,
-                    des_page_stop, cur_page_start, cur_page_stop);
-                auto row_indices = util::index_calculation_1d(
-                    des_row_start, des_row_stop, cur_row_start, cur_row_stop);
-                auto col_indices = util::index_calculation_1d(
-                    des_col_start, des_col_stop, cur_col_start, cur_col_stop);
-
-                blaze::subtensor(result, page_indices.projected_start_,
-                    row_indices.projected_start_, col_indices.projected_start_,
-                    page_indices.intersection_size_,
-                    row_indices.intersection_size_,
-                    col_indices.intersection_size_) = blaze::subtensor(t,
-                    page_indices.local_start_, row_indices.local_start_,
-                    col_indices.local_start_, page_indices.intersection_size_,
-                    row_indices.intersection_size_,
-                    col_indices.intersection_size_);
-            }
-
+            // collecting the blocks needed from remote localities
+            std::vector<std::tuple<std::uint32_t, util::indices_pack,
+                util::indices_pack, util::indices_pack>>
+                parts;
             for (std::uint32_t loc = 0; loc != num_localities; ++loc)
             {
                 if (loc == loc_id)
@@ -885,25 +900,72 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                     col_indices.intersection_size_ > 0)
                 {
                     // loc_span has the block of result that we need
+                    parts.emplace_back(
+                        loc, page_indices, row_indices, col_indices);
+                }
+            }
+
+            // all remote blocks are requested up front, the local part is
+            // copied while they are in flight
+            util::overlapped_fetch(parts.size(),
+                [&](std::size_t i) {
+                    auto const& page_indices = std::get<1>(parts[i]);
+                    auto const& row_indices = std::get<2>(parts[i]);
+                    auto const& col_indices = std::get<3>(parts[i]);
+                    return t_data.fetch(std::get<0>(parts[i]),
+                        page_indices.local_start_, row_indices.local_start_,
+                        col_indices.local_start_,
+                        page_indices.local_start_ +
+                            page_indices.intersection_size_,
+                        row_indices.local_start_ +
+                            row_indices.intersection_size_,
+                        col_indices.local_start_ +
+                            col_indices.intersection_size_);
+                },
+                [&]() {
+                    // copying the local part
+                    if ((des_page_start < cur_page_stop &&
+                            des_page_stop > cur_page_start) &&
+                        (des_row_start < cur_row_stop &&
+                            des_row_stop > cur_row_start) &&
+                        (des_col_start < cur_col_stop &&
+                            des_col_stop > cur_col_start))
+                    {
+                        auto page_indices = util::index_calculation_1d(
+                            des_page_start, des_page_stop, cur_page_start,
+                            cur_page_stop);
+                        auto row_indices = util::index_calculation_1d(
+                            des_row_start, des_row_stop, cur_row_start,
+                            cur_row_stop);
+                        auto col_indices = util::index_calculation_1d(
+                            des_col_start, des_col_stop, cur_col_start,
+                            cur_col_stop);
+
+                        blaze::subtensor(result, page_indices.projected_start_,
+                            row_indices.projected_start_,
+                            col_indices.projected_start_,
+                            page_indices.intersection_size_,
+                            row_indices.intersection_size_,
+                            col_indices.intersection_size_) =
+                            blaze::subtensor(t, page_indices.local_start_,
+                                row_indices.local_start_,
+                                col_indices.local_start_,
+                                page_indices.intersection_size_,
+                                row_indices.intersection_size_,
+                                col_indices.intersection_size_);
+                    }
+                },
+                [&](std::size_t i, blaze::DynamicTensor<T>&& data) {
+                    auto const& page_indices = std::get<1>(parts[i]);
+                    auto const& row_indices = std::get<2>(parts[i]);
+                    auto const& col_indices = std::get<3>(parts[i]);
                     blaze::subtensor(result, page_indices.projected_start_,
                         row_indices.projected_start_,
                         col_indices.projected_start_,
                         page_indices.intersection_size_,
                         row_indices.intersection_size_,
-                        col_indices.intersection_size_) =
-                        t_data
-                            .fetch(loc, page_indices.local_start_,
-                                row_indices.local_start_,
-                                col_indices.local_start_,
-                                page_indices.local_start_ +
-                                    page_indices.intersection_size_,
-                                row_indices.local_start_ +
-                                    row_indices.intersection_size_,
-                                col_indices.local_start_ +
-                                    col_indices.intersection_size_)
-                            .get();
-                }
-            }
+                        col_indices.intersection_size_) = data;
+                });
         }
         else // the new array is a subset of the original array
         {
@@ -950,6 +1012,7 @@ namespace phylanx { namespace dist_matrixops { namespace primitives
                 tiling_type, intersection, numtiles, std::move(new_tiling),
                 std::move(arr_localities));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return retile3d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -9,3 +9,21 @@
 
 PHYLANX_REGISTER_PLUGIN_MODULE();
 
+PHYLANX_REGISTER_PLUGIN_FACTORY(all_d_operation_plugin,
+    phylanx::execution_tree::primitives::all_d_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(any_d_operation_plugin,
+    phylanx::execution_tree::primitives::any_d_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(max_d_operation_plugin,
+    phylanx::execution_tree::primitives::max_d_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(mean_d_operation_plugin,
+    phylanx::execution_tree::primitives::mean_d_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(min_d_operation_plugin,
+    phylanx::execution_tree::primitives::min_d_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(prod_d_operation_plugin,
+    phylanx::execution_tree::primitives::prod_d_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(std_d_operation_plugin,
+    phylanx::execution_tree::primitives::std_d_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(sum_d_operation_plugin,
+    phylanx::execution_tree::primitives::sum_d_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(var_d_operation_plugin,
+    phylanx::execution_tree::primitives::var_d_operation::match_data);
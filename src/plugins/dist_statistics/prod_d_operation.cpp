@@ -0,0 +1,52 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/plugins/dist_statistics/dist_statistics_base_impl.hpp>
+#include <phylanx/plugins/dist_statistics/prod_d_operation.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const prod_d_operation::match_data = {
+        match_pattern_type{"prod_d",
+            std::vector<std::string>{
+                "prod_d(_1, __arg(_2_axis, nil), __arg(_3_keepdims, nil), "
+                    "__arg(_4_initial, nil), __arg(_5_dtype, nil))"},
+            &create_prod_d_operation, &create_primitive<prod_d_operation>, R"(
+            a, axis, keepdims, initial, dtype
+            Args:
+
+                a (array): a scalar or a (distributed) vector, matrix, or
+                   tensor
+                axis (optional, integer or list of integers):
+                   the axis to calculate the product along, either a single axis
+                   or all axes.
+                   By default, the flattened input is used.
+                keepdims (optional, bool): If this is set to True, the axes
+                   which are reduced are left in the result as dimensions
+                   with size one. False by default
+                initial (optional, scalar): The starting value for the product.
+                dtype (optional, string) : the data-type of the returned
+                   array, defaults to dtype of input array.
+
+            Returns:
+
+            Returns the product of an array or the product along an axis. The
+            result is replicated on all localities.)"}};
+
+    ///////////////////////////////////////////////////////////////////////////
+    prod_d_operation::prod_d_operation(primitive_arguments_type&& operands,
+        std::string const& name, std::string const& codename)
+      : base_type(std::move(operands), name, codename)
+    {
+    }
+}}}    // namespace phylanx::execution_tree::primitives
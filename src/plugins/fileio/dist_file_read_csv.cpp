@@ -17,12 +17,17 @@
 #include <phylanx/plugins/fileio/dist_file_read_csv.hpp>
 #include <phylanx/plugins/fileio/file_read_csv_impl.hpp>
 #include <phylanx/util/detail/range_dimension.hpp>
+#include <phylanx/util/distributed_matrix.hpp>
+#include <phylanx/util/overlapped_fetch.hpp>
 
+#include <hpx/collectives/all_gather.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/errors/throw_exception.hpp>
+#include <hpx/serialization/vector.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -32,12 +37,15 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include <blaze/Math.h>
 #include <blaze_tensor/Math.h>
 
+REGISTER_DISTRIBUTED_MATRIX_DECLARATION(double);
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives
 {
@@ -109,6 +117,195 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
             return std::move(given_name);
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Each locality parses only the lines starting in its share of the
+        // bytes of the csv file. The rows of each tile are then fetched from
+        // the localities that have parsed them.
+        class csv_chunks
+        {
+            static blaze::DynamicMatrix<double> read_chunk(
+                std::ifstream& infile, std::string const& filename,
+                std::uint32_t tile_idx, std::uint32_t numtiles)
+            {
+                infile.seekg(0, std::ios::end);
+                std::int64_t const size = infile.tellg();
+                infile.seekg(0);
+
+                // the first line (which could be a header) is always read by
+                // the first locality
+                std::string first_line;
+                std::getline(infile, first_line);
+                std::int64_t const first_stop = (std::min)(
+                    size, static_cast<std::int64_t>(first_line.size()) + 1);
+
+                auto boundary = [&](std::uint32_t idx) -> std::int64_t {
+                    return idx == 0 ? 0 :
+                                      (std::max)(first_stop,
+                                          size * std::int64_t(idx) / numtiles);
+                };
+
+                infile.clear();
+                infile.seekg(0);
+
+                std::vector<double> data;
+                std::size_t n_rows, n_cols;
+                std::tie(data, n_rows, n_cols) = read_range_helper(infile,
+                    filename, boundary(tile_idx), boundary(tile_idx + 1));
+
+                return blaze::DynamicMatrix<double>(
+                    n_rows, n_cols, data.data());
+            }
+
+        public:
+            csv_chunks(std::ifstream&& infile, std::string const& filename,
+                std::string const& name, std::uint32_t tile_idx,
+                std::uint32_t numtiles)
+              : name_("csv_chunks_" + name)
+              , tile_idx_(tile_idx)
+              , numtiles_(numtiles)
+              , data_(name_, read_chunk(infile, filename, tile_idx, numtiles),
+                    numtiles, tile_idx)
+              , row_offsets_(numtiles + 1, 0)
+              , n_cols_(0)
+            {
+                // exchange the number of rows and columns read by each
+                // locality to determine the global row index of each row
+                std::vector<std::vector<std::int64_t>> sizes =
+                    hpx::all_gather(("all_gather_" + name_).c_str(),
+                        std::vector<std::int64_t>{
+                            std::int64_t(data_->rows()),
+                            std::int64_t(data_->columns())},
+                        numtiles_, std::size_t(-1), tile_idx_)
+                        .get();
+
+                for (std::uint32_t i = 0; i != numtiles_; ++i)
+                {
+                    row_offsets_[i + 1] = row_offsets_[i] + sizes[i][0];
+                    if (sizes[i][0] == 0)
+                    {
+                        continue;
+                    }
+
+                    if (n_cols_ == 0)
+                    {
+                        n_cols_ = sizes[i][1];
+                    }
+                    else if (n_cols_ != std::size_t(sizes[i][1]))
+                    {
+                        throw std::runtime_error(util::generate_error_message(
+                            "wrong data format, different number of elements "
+                            "in the rows of " + filename));
+                    }
+                }
+            }
+
+            std::size_t rows() const
+            {
+                return std::size_t(row_offsets_.back());
+            }
+            std::size_t columns() const
+            {
+                return n_cols_;
+            }
+
+            // collect the given (sorted) ranges of rows, restricted to the
+            // given columns
+            blaze::DynamicMatrix<double> get_rows(
+                std::vector<tiling_span> const& row_ranges,
+                std::size_t column_start, std::size_t column_size) const
+            {
+                struct part
+                {
+                    std::uint32_t loc_;
+                    std::int64_t start_;    // local row indices on loc_
+                    std::int64_t stop_;
+                    std::size_t dest_;      // row index in result
+                };
+
+                // split the ranges at the boundaries of the rows read by the
+                // localities
+                std::vector<part> local_parts, remote_parts;
+                std::size_t dest = 0;
+                for (auto const& range : row_ranges)
+                {
+                    std::uint32_t loc = std::uint32_t(
+                        std::upper_bound(row_offsets_.begin(),
+                            row_offsets_.end(), range.start_) -
+                        row_offsets_.begin() - 1);
+
+                    for (/**/;
+                         loc < numtiles_ && row_offsets_[loc] < range.stop_;
+                         ++loc)
+                    {
+                        tiling_span intersection;
+                        if (!intersect(range,
+                                tiling_span(
+                                    row_offsets_[loc], row_offsets_[loc + 1]),
+                                intersection) ||
+                            !intersection.is_valid())
+                        {
+                            continue;
+                        }
+
+                        part p{loc, intersection.start_ - row_offsets_[loc],
+                            intersection.stop_ - row_offsets_[loc],
+                            dest + (intersection.start_ - range.start_)};
+
+                        if (loc == tile_idx_)
+                        {
+                            local_parts.push_back(p);
+                        }
+                        else
+                        {
+                            remote_parts.push_back(p);
+                        }
+                    }
+                    dest += range.size();
+                }
+
+                blaze::DynamicMatrix<double> result(dest, column_size);
+
+                util::overlapped_fetch(remote_parts.size(),
+                    [&](std::size_t i) {
+                        auto const& p = remote_parts[i];
+                        return data_.fetch(p.loc_, p.start_, column_start,
+                            p.stop_, column_start + column_size);
+                    },
+                    [&]() {
+                        for (auto const& p : local_parts)
+                        {
+                            blaze::submatrix(result, p.dest_, 0,
+                                p.stop_ - p.start_, column_size) =
+                                blaze::submatrix(*data_, p.start_,
+                                    column_start, p.stop_ - p.start_,
+                                    column_size);
+                        }
+                    },
+                    [&](std::size_t i, blaze::DynamicMatrix<double>&& rows) {
+                        auto const& p = remote_parts[i];
+                        blaze::submatrix(result, p.dest_, 0, rows.rows(),
+                            column_size) = rows;
+                    });
+
+                return result;
+            }
+
+            // make sure no other locality still needs the local rows
+            void wait_for_all() const
+            {
+                hpx::lcos::barrier b("barrier_" + name_, numtiles_, tile_idx_);
+                b.wait();
+            }
+
+        private:
+            std::string name_;
+            std::uint32_t tile_idx_;
+            std::uint32_t numtiles_;
+            util::distributed_matrix<double> data_;
+            std::vector<std::int64_t> row_offsets_;
+            std::size_t n_cols_;
+        };
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -118,14 +315,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& intersections,
         std::string&& given_name, std::uint32_t numtiles) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        std::uint32_t tile_idx = hpx::get_locality_id();
+
+        std::string base_name =
+            detail::generate_csv_name(std::move(given_name));
+
+        detail::csv_chunks chunks(
+            std::move(infile), filename, base_name, tile_idx, numtiles);
+
+        std::size_t n_rows = chunks.rows();
+        std::size_t n_cols = chunks.columns();
 
         std::int64_t row_start, column_start;
         std::size_t row_size, column_size;
-        std::uint32_t tile_idx = hpx::get_locality_id();
 
         std::tie(row_start, column_start, row_size, column_size) =
             tile_calculation::tile_calculation_2d(
@@ -153,9 +355,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
         locality_information locality_info(tile_idx, numtiles);
         annotation locality_ann = locality_info.as_annotation();
 
-        std::string base_name =
-            detail::generate_csv_name(std::move(given_name));
-
         annotation_information ann_info(
             std::move(base_name), 0);    //generation 0
 
@@ -164,10 +363,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 tile_info.as_annotation(name_, codename_), ann_info, name_,
                 codename_));
 
-        blaze::DynamicMatrix<double> whole_data(n_rows, n_cols, data.data());
-        blaze::DynamicMatrix<double> result =
-            blaze::submatrix(std::move(whole_data), row_start, column_start,
-                row_size, column_size);
+        blaze::DynamicMatrix<double> result = chunks.get_rows(
+            {tiling_span(row_start, row_start + row_size)}, column_start,
+            column_size);
+
+        chunks.wait_for_all();
 
         return primitive_argument_type(result, attached_annotation);
     }
@@ -179,10 +379,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& intersections,
         std::string&& given_name, std::uint32_t numtiles) const
     {
-        std::vector<double> data;
-        std::size_t n_rows, n_cols;
-        std::tie(data, n_rows, n_cols) =
-            read_helper(std::move(infile), filename);
+        std::uint32_t tile_idx = hpx::get_locality_id();
+
+        std::string base_name =
+            detail::generate_csv_name(std::move(given_name));
+
+        detail::csv_chunks chunks(
+            std::move(infile), filename, base_name, tile_idx, numtiles);
+
+        std::size_t n_rows = chunks.rows();
+        std::size_t n_cols = chunks.columns();
         std::size_t n_pages = static_cast<std::size_t>(n_rows / given_nrows);
 
         if (n_rows % given_nrows != 0)
@@ -195,7 +401,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         std::int64_t page_start, row_start, column_start;
         std::size_t page_size, row_size, column_size;
-        std::uint32_t tile_idx = hpx::get_locality_id();
 
         std::tie(page_start, row_start, column_start, page_size, row_size,
             column_size) = tile_calculation::tile_calculation_3d(tile_idx,
@@ -230,9 +435,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
         locality_information locality_info(tile_idx, numtiles);
         annotation locality_ann = locality_info.as_annotation();
 
-        std::string base_name =
-            detail::generate_csv_name(std::move(given_name));
-
         annotation_information ann_info(
             std::move(base_name), 0);    //generation 0
 
@@ -241,11 +443,33 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 tile_info.as_annotation(name_, codename_), ann_info, name_,
                 codename_));
 
-        blaze::DynamicTensor<double> whole_data(
-            n_pages, given_nrows, n_cols, data.data());
-        blaze::DynamicTensor<double> result =
-            blaze::subtensor(std::move(whole_data), page_start, row_start,
-                column_start, page_size, row_size, column_size);
+        // the rows of the tile in each of the pages, adjacent ranges are
+        // merged
+        std::vector<tiling_span> row_ranges;
+        for (std::size_t k = 0; k != page_size; ++k)
+        {
+            std::int64_t start = (page_start + k) * given_nrows + row_start;
+            if (!row_ranges.empty() && row_ranges.back().stop_ == start)
+            {
+                row_ranges.back().stop_ += row_size;
+            }
+            else
+            {
+                row_ranges.emplace_back(start, start + row_size);
+            }
+        }
+
+        blaze::DynamicMatrix<double> rows =
+            chunks.get_rows(row_ranges, column_start, column_size);
+
+        chunks.wait_for_all();
+
+        blaze::DynamicTensor<double> result(page_size, row_size, column_size);
+        for (std::size_t k = 0; k != page_size; ++k)
+        {
+            blaze::pageslice(result, k) =
+                blaze::submatrix(rows, k * row_size, 0, row_size, column_size);
+        }
 
         return primitive_argument_type(result, attached_annotation);
     }
@@ -384,7 +608,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             std::move(args[6]), this_->name_, this_->codename_);
                     }
 
-                    std::ifstream infile(filename.c_str(), std::ios::in);
+                    // the file is read in binary mode, each locality
+                    // directly seeks to the part it has to parse
+                    std::ifstream infile(
+                        filename.c_str(), std::ios::in | std::ios::binary);
 
                     if (!infile.is_open())
                     {
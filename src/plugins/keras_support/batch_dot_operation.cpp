@@ -576,6 +576,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32:
                     case node_data_type_double:
                         return this_->batch_dot_nd(
                             extract_numeric_value(
@@ -637,6 +638,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32:
                     case node_data_type_double:
                         return this_->batch_dot_nd(
                             extract_numeric_value(
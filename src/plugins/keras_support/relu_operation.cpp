@@ -251,6 +251,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 }
                 case node_data_type_unknown:
                     HPX_FALLTHROUGH;
+                case node_data_type_float32:
                 case node_data_type_double:
                 {
                     double max_value = 0.0;
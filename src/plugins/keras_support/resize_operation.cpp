@@ -237,6 +237,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                         case node_data_type_unknown:
                             HPX_FALLTHROUGH;
+                        case node_data_type_float32:
                         case node_data_type_double:
                             return this_->nearest(
                                 extract_numeric_value(std::move(arg),
@@ -82,12 +82,15 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort_flatten2d(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        auto mat = in_array.matrix();
-        auto flatten = blaze::ravel(mat);
-        blaze::DynamicVector<std::int64_t> idx(mat.rows() * mat.columns());
+        // sort indices into a contiguous copy of the data
+        blaze::DynamicVector<T> flatten(in_array.size());
+        in_array.copy_to(flatten.data());
+        T const* data = flatten.data();
+
+        blaze::DynamicVector<std::int64_t> idx(flatten.size());
         std::iota(idx.begin(), idx.end(), 0);
         std::sort(idx.begin(), idx.end(),
-            [&flatten](size_t a, size_t b) { return flatten[a] < flatten[b]; });
+            [data](size_t a, size_t b) { return data[a] < data[b]; });
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -95,13 +98,15 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
     primitive_argument_type argsort::argsort_flatten3d(
         ir::node_data<T>&& in_array, std::string kind, std::string order) const
     {
-        auto tensor = in_array.tensor();
-        auto flatten = blaze::ravel(tensor);
-        blaze::DynamicVector<std::int64_t> idx(
-            tensor.pages() * tensor.rows() * tensor.columns());
+        // sort indices into a contiguous copy of the data
+        blaze::DynamicVector<T> flatten(in_array.size());
+        in_array.copy_to(flatten.data());
+        T const* data = flatten.data();
+
+        blaze::DynamicVector<std::int64_t> idx(flatten.size());
         std::iota(idx.begin(), idx.end(), 0);
         std::sort(idx.begin(), idx.end(),
-            [&flatten](size_t a, size_t b) { return flatten[a] < flatten[b]; });
+            [data](size_t a, size_t b) { return data[a] < data[b]; });
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -150,6 +155,7 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                 extract_integer_value_strict(
                     std::move(in_array), name_, codename_),
                 axis, kind, order);
+        case node_data_type_float32:
         case node_data_type_double:
             return argsort_flatten_helper(
                 extract_numeric_value_strict(
@@ -478,6 +484,7 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                                     this_->name_, this_->codename_),
                                 axis, kind, order);
 
+                        case node_data_type_float32:
                         case node_data_type_double:
                             return this_->argsort_helper(
                                 extract_numeric_value_strict(std::move(args[0]),
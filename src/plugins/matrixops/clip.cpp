@@ -181,6 +181,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     return this_->clip_helper<std::uint8_t>(std::move(args));
                 case node_data_type_unknown:
                     HPX_FALLTHROUGH;
+                case node_data_type_float32:
                 case node_data_type_double:
                     return this_->clip_helper<double>(std::move(args));
 
@@ -137,6 +137,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return concatenate1d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return concatenate1d_helper<double>(std::move(args));
 
@@ -334,6 +335,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return concatenate2d_helper<std::int64_t>(std::move(args), axis);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return concatenate2d_helper<double>(std::move(args), axis);
 
@@ -418,6 +420,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return concatenate_flatten_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return concatenate_flatten_helper<double>(std::move(args));
 
@@ -715,6 +718,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return concatenate3d_helper<std::int64_t>(std::move(args), axis);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return concatenate3d_helper<double>(std::move(args), axis);
 
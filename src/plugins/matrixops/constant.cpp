@@ -195,6 +195,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return constant0d_helper<std::int64_t>(std::move(op));
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return constant0d_helper<double>(std::move(op));
         default:
@@ -242,6 +243,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return constant1d_helper<double>(std::move(op), dim);
 
@@ -292,6 +294,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return constant2d_helper<double>(std::move(op), dim);
 
@@ -344,6 +347,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return constant3d_helper<double>(std::move(op), dim);
 
@@ -402,6 +406,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return constant4d_helper<double>(std::move(op), dim);
 
@@ -69,6 +69,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return determinant0d(
                 extract_integer_value_strict(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return determinant0d(
                 extract_numeric_value_strict(std::move(op), name_, codename_));
@@ -102,6 +103,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         switch (extract_common_type(op))
         {
+        case node_data_type_float32:
         case node_data_type_double:
             return determinant2d(
                 extract_numeric_value_strict(std::move(op), name_, codename_));
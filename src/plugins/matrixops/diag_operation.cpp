@@ -90,6 +90,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return diag1d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -125,6 +126,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return diag2d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -143,6 +143,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return outer1d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -176,6 +177,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return outer2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -209,6 +211,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return outer3d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -242,6 +245,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return contraction2d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -275,6 +279,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return contraction3d(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -311,6 +316,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return tensordot_range_of_scalars(
                 extract_numeric_value(std::move(lhs), name_, codename_),
@@ -345,6 +351,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return outer_nd_helper(
                 extract_numeric_value(std::move(lhs), name_, codename_),
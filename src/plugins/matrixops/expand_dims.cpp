@@ -99,6 +99,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_0d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return expand_dims_0d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -216,6 +217,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                           std::move(args[0]), name_, codename_),
                     axis, std::move(arr_localities));
 
+            case node_data_type_float32:
             case node_data_type_double:
                 return expand_dims_1d(extract_numeric_value_strict(
                                           std::move(args[0]), name_, codename_),
@@ -248,6 +250,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_1d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return expand_dims_1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -322,6 +325,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_2d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return expand_dims_2d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -421,6 +425,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return expand_dims_3d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return expand_dims_3d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -91,6 +91,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return eye_n_helper<std::int64_t>(n);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return eye_n_helper<double>(n);
 
@@ -143,6 +144,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return eye_nmk_helper<std::int64_t>(n, m, k);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return eye_nmk_helper<double>(n, m, k);
 
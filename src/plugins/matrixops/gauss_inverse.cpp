@@ -194,6 +194,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
     {
         switch (extract_common_type(op))
         {
+        case node_data_type_float32:
         case node_data_type_double:
             return gaussInverse2d(
                 extract_numeric_value_strict(std::move(op), name_, codename_));
@@ -166,6 +166,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return gradient1d(
                 extract_integer_value(std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return gradient1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -206,6 +207,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(args[0]), name_, codename_),
                 axis);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return gradient2d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -785,6 +785,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         axis);
 
                 case node_data_type_unknown: HPX_FALLTHROUGH;
+                case node_data_type_float32:
                 case node_data_type_double:
                     return this_->insert_nd(
                         extract_numeric_value(std::move(args[0]),
@@ -128,6 +128,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return inverse0d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return inverse0d(extract_numeric_value_strict(
                 std::move(op), name_, codename_));
@@ -152,6 +153,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         switch (extract_common_type(op))
         {
+        case node_data_type_float32:
         case node_data_type_double:
             return inverse2d(extract_numeric_value_strict(
                 std::move(op), name_, codename_));
@@ -178,6 +180,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         switch (extract_common_type(op))
         {
+        case node_data_type_float32:
         case node_data_type_double:
             return inverse3d(extract_numeric_value_strict(
                 std::move(op), name_, codename_));
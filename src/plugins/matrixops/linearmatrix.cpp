@@ -112,6 +112,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_scalar_integer_value(std::move(dy), name_, codename_));
 
         case node_data_type_bool:   HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return linmatrix(nx, ny,
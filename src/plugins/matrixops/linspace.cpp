@@ -101,6 +101,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 nelements);
 
         case node_data_type_bool:   HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double: HPX_FALLTHROUGH;
         case node_data_type_unknown:
             return linspace1d(
@@ -126,6 +126,10 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(stack_operation_plugin,
     phylanx::execution_tree::primitives::stack_operation::match_data[2]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(tensordot_operation_plugin,
     phylanx::execution_tree::primitives::dot_operation::match_data[2]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(todense_plugin,
+    phylanx::execution_tree::primitives::sparse_conversion::match_data[1]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(tosparse_plugin,
+    phylanx::execution_tree::primitives::sparse_conversion::match_data[0]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(tile_operation_plugin,
     phylanx::execution_tree::primitives::tile_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(transpose_operation_plugin,
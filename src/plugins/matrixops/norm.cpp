@@ -286,6 +286,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 type, std::move(ord), std::move(axis), keepdims,
                 std::move(ctx));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return norm_helper(
                 extract_numeric_value_strict(std::move(data), name_, codename_),
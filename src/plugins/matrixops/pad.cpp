@@ -463,6 +463,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                                 this_->codename_));
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32:
                     case node_data_type_double:
                         return this_->pad_helper(
                             extract_numeric_value_strict(std::move(args[0]),
@@ -493,6 +494,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                             ir::node_data<std::uint8_t>{0});
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32:
                     case node_data_type_double:
                         return this_->pad_helper(
                             extract_numeric_value_strict(std::move(args[0]),
@@ -128,6 +128,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:    HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return power0d(extract_numeric_value(std::move(lhs)),
                 extract_numeric_value(std::move(rhs)));
@@ -159,6 +160,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:    HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return power1d(extract_numeric_value(std::move(lhs)),
                 extract_numeric_value(std::move(rhs)));
@@ -190,6 +192,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:    HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return power2d(extract_numeric_value(std::move(lhs)),
                 extract_numeric_value(std::move(rhs)));
@@ -221,6 +224,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:    HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return power3d(extract_numeric_value(std::move(lhs)),
                 extract_numeric_value(std::move(rhs)));
@@ -520,6 +520,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return convert_to<std::int64_t>(std::move(result));
 
             case node_data_type_unknown: HPX_FALLTHROUGH;
+            case node_data_type_float32:
             case node_data_type_double:
                 return convert_to<double>(std::move(result));
 
@@ -203,6 +203,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return reshape0d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -324,6 +325,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return reshape1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -467,6 +469,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return reshape2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -604,6 +607,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return reshape3d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -790,6 +794,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         return this_->flatten_nd(extract_integer_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
 
+                    case node_data_type_float32:
                     case node_data_type_double:
                         return this_->flatten_nd(extract_numeric_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
@@ -900,6 +905,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(arr), this_->name_, this_->codename_),
                             std::move(order));
 
+                    case node_data_type_float32:
                     case node_data_type_double:
                         return this_->flatten_nd(
                             extract_numeric_value_strict(
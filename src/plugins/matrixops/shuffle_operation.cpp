@@ -92,6 +92,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return shuffle_1d(extract_integer_value_strict(std::move(arg)));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return shuffle_1d(extract_numeric_value(std::move(arg)));
 
@@ -118,6 +119,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return shuffle_2d(extract_integer_value_strict(std::move(arg)));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return shuffle_2d(extract_numeric_value(std::move(arg)));
 
@@ -60,12 +60,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type sort::sort_flatten2d(
         ir::node_data<T>&& arg, std::string kind) const
     {
-        auto m = arg.matrix();
-        auto r = blaze::ravel(m);
-        blaze::DynamicVector<T> result(m.rows() * m.columns());
+        blaze::DynamicVector<T> result(arg.size());
 
-        std::copy(r.begin(), r.end(), result.begin());
-        std::sort(result.begin(), result.begin() + result.size());
+        arg.copy_to(result.data());
+        std::sort(result.data(), result.data() + result.size());
         return primitive_argument_type{std::move(result)};
     }
 
@@ -73,12 +71,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type sort::sort_flatten3d(ir::node_data<T>&& arg,
         std::string kind) const
     {
-        auto t = arg.tensor();
-        auto r = blaze::ravel(t);
-        blaze::DynamicVector<T> result(t.pages() * t.rows() * t.columns());
+        blaze::DynamicVector<T> result(arg.size());
 
-        std::copy(r.begin(), r.end(), result.begin());
-        std::sort(result.begin(), result.begin() + result.size());
+        arg.copy_to(result.data());
+        std::sort(result.data(), result.data() + result.size());
         return primitive_argument_type{std::move(result)};
     }
 
@@ -126,6 +122,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 kind);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return sort_flatten_helper(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -389,6 +386,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             std::move(args[0]), this_->name_, this_->codename_),
                         axis, kind);
 
+                case node_data_type_float32:
                 case node_data_type_double:
                     return this_->sort_helper(
                         extract_numeric_value_strict(
@@ -0,0 +1,181 @@
+//   Copyright (c) 2020 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/matrixops/sparse_conversion.hpp>
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/errors/throw_exception.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<match_pattern_type> const sparse_conversion::match_data =
+    {
+        match_pattern_type{"tosparse",
+            std::vector<std::string>{"tosparse(_1)"},
+            &create_tosparse, &create_primitive<sparse_conversion>, R"(
+            x
+            Args:
+
+                x (matrix) : the matrix to convert
+
+            Returns:
+
+            The given matrix stored in compressed (sparse) row format. Only
+            the non-zero elements are stored, which is beneficial for data
+            that consists mostly of zeros.)"
+        },
+
+        match_pattern_type{"todense",
+            std::vector<std::string>{"todense(_1)"},
+            &create_todense, &create_primitive<sparse_conversion>, R"(
+            x
+            Args:
+
+                x (matrix) : the matrix to convert
+
+            Returns:
+
+            The given matrix stored in dense format. Dense data is returned
+            unchanged.)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        sparse_conversion::conversion_mode extract_conversion_mode(
+            std::string const& name)
+        {
+            sparse_conversion::conversion_mode result =
+                sparse_conversion::to_sparse_mode;
+            if (name.find("todense") != std::string::npos)
+            {
+                result = sparse_conversion::to_dense_mode;
+            }
+            return result;
+        }
+    }
+
+    sparse_conversion::sparse_conversion(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , mode_(detail::extract_conversion_mode(name_))
+    {
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type sparse_conversion::convert(
+        ir::node_data<T>&& arg) const
+    {
+        if (mode_ == to_dense_mode)
+        {
+            if (arg.is_sparse())
+            {
+                return primitive_argument_type{
+                    ir::node_data<T>{arg.matrix_copy()}};
+            }
+            return primitive_argument_type{std::move(arg)};
+        }
+
+        if (arg.num_dimensions() != 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "sparse_conversion::convert",
+                generate_error_message(
+                    "the tosparse primitive requires for its argument to "
+                        "be a matrix"));
+        }
+
+        if (arg.is_sparse())
+        {
+            return primitive_argument_type{std::move(arg)};
+        }
+
+        return primitive_argument_type{ir::node_data<T>{
+            typename ir::node_data<T>::sparse_storage2d_type{arg.matrix()}}};
+    }
+
+    primitive_argument_type sparse_conversion::convert_nd(
+        primitive_argument_type&& arg) const
+    {
+        switch (extract_common_type(arg))
+        {
+        case node_data_type_bool:
+            return convert(extract_boolean_value_strict(
+                std::move(arg), name_, codename_));
+
+        case node_data_type_int64:
+            return convert(extract_integer_value_strict(
+                std::move(arg), name_, codename_));
+
+        case node_data_type_float32:
+            return convert(extract_float32_value_strict(
+                std::move(arg), name_, codename_));
+
+        case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_double:
+            return convert(
+                extract_numeric_value(std::move(arg), name_, codename_));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "sparse_conversion::convert_nd",
+            generate_error_message(
+                "the sparse conversion primitives require for their "
+                    "argument to be a numeric data type"));
+    }
+
+    hpx::future<primitive_argument_type> sparse_conversion::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "sparse_conversion::eval",
+                generate_error_message(
+                    "the sparse conversion primitives require exactly one "
+                        "operand"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "sparse_conversion::eval",
+                generate_error_message(
+                    "the sparse conversion primitives require that the "
+                        "argument given by the operands array is valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync,
+            hpx::util::unwrapping(
+                [this_ = std::move(this_)](primitive_argument_type&& op)
+                -> primitive_argument_type
+                {
+                    return this_->convert_nd(std::move(op));
+                }),
+            value_operand(operands[0], args, name_, codename_, std::move(ctx)));
+    }
+}}}
@@ -100,6 +100,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return squeeze1d(
                 extract_integer_value_strict(std::move(arg), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return squeeze1d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_));
@@ -210,6 +211,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return squeeze2d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -374,6 +376,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return squeeze3d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -632,6 +635,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 axis);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return squeeze4d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
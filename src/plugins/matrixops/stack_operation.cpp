@@ -301,6 +301,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return hstack0d1d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return hstack0d1d_helper<double>(std::move(args));
 
@@ -405,6 +406,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return hstack2d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return hstack2d_helper<double>(std::move(args));
 
@@ -523,6 +525,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return hstack3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return hstack3d_helper<double>(std::move(args));
 
@@ -598,6 +601,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return vstack0d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return vstack0d_helper<double>(std::move(args));
 
@@ -736,6 +740,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return vstack1d2d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return vstack1d2d_helper<double>(std::move(args));
 
@@ -854,6 +859,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return vstack3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return vstack3d_helper<double>(std::move(args));
 
@@ -929,6 +935,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return dstack0d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dstack0d_helper<double>(std::move(args));
 
@@ -1034,6 +1041,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return dstack1d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dstack1d_helper<double>(std::move(args));
 
@@ -1171,6 +1179,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return dstack2d3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return dstack2d3d_helper<double>(std::move(args));
 
@@ -1314,6 +1323,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return stack1d_axis1_helper<double>(std::move(args));
 
@@ -1469,6 +1479,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return stack2d_axis0_helper<double>(std::move(args));
 
@@ -1594,6 +1605,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return stack2d_axis1_helper<double>(std::move(args));
 
@@ -1728,6 +1740,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return stack3d_axis1_helper<double>(std::move(args));
 
@@ -1815,6 +1828,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32:
         case node_data_type_double:
             return stack3d_axis2_helper<double>(std::move(args));
 
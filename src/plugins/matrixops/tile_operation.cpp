@@ -161,6 +161,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return tile0d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -289,6 +290,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return tile1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -417,6 +419,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return tile2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -543,6 +546,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return tile3d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -80,6 +80,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return unique0d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return unique0d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -144,6 +145,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return unique1d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32:
         case node_data_type_double:
             return unique1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -168,19 +170,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type unique::unique2d_flatten(
         ir::node_data<T>&& arg) const
     {
-        using phylanx::util::matrix_row_iterator;
-        auto a = arg.matrix();
-
-        const matrix_row_iterator<decltype(a)> a_begin(a);
-        const matrix_row_iterator<decltype(a)> a_end(a, a.rows());
-
-        blaze::DynamicVector<double> result(a.rows() * a.columns());
-        auto d = result.data();
-
-        for (auto it = a_begin; it != a_end; ++it)
-        {
-            d = std::copy(it->begin(), it->end(), d);
-        }
+        blaze::DynamicVector<double> result(arg.size());
+        arg.copy_to(result.data());
 
         // Sorting the vector
         std::sort(result.begin(), result.end());
@@ -319,6 +310,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     std::move(args[0]), name_, codename_),
                 axis);
 
+        case node_data_type_float32:
         case node_data_type_double:
             return unique2d(numargs,
                 extract_numeric_value_strict(
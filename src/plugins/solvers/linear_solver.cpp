@@ -266,7 +266,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             {"linear_solver_lu",
                 // Linear solver based on LU decomposition of a general square matrix
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{blaze::trans(args[0].matrix())};
+                    storage2d_type A{blaze::trans(args[0].matrix_copy())};
                     storage1d_type b{args[1].vector()};
                     const std::unique_ptr<int[]> ipiv(new int[b.size()]);
                     blaze::gesv(A, b, ipiv.get());
@@ -276,7 +276,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Linear solver based on LDLT decomposition of a square
                 // symmetric indefinite matrix
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{blaze::trans(args[0].matrix())};
+                    storage2d_type A{blaze::trans(args[0].matrix_copy())};
                     storage1d_type b{args[1].vector()};
                     const std::unique_ptr<int[]> ipiv(new int[b.size()]);
                     blaze::sysv(A, b, 'U', ipiv.get());
@@ -286,7 +286,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Linear solver based on cholesky(LLH) decomposition of a
                 // square positive definite matrix
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{blaze::trans(args[0].matrix())};
+                    storage2d_type A{blaze::trans(args[0].matrix_copy())};
                     storage1d_type b{args[1].vector()};
                     blaze::posv(A, b, 'U');
                     return arg_type{std::move(b)};
@@ -297,9 +297,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::ConjugateGradientTag tag;
+                    if (args[0].is_sparse())
+                    {
+                        // the solver only needs matrix-vector products,
+                        // which preserves the benefit of compressed storage
+                        auto const& A = args[0].sparse_matrix();
+                        b = blaze::iterative::solve(A, b, tag);
+                        return arg_type{std::move(b)};
+                    }
+                    storage2d_type A{args[0].matrix_copy()};
                     b = blaze::iterative::solve(A, b, tag);
                     return arg_type{std::move(b)};
                 }},
@@ -308,9 +316,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::BiCGSTABTag tag;
+                    if (args[0].is_sparse())
+                    {
+                        // the solver only needs matrix-vector products,
+                        // which preserves the benefit of compressed storage
+                        auto const& A = args[0].sparse_matrix();
+                        b = blaze::iterative::solve(A, b, tag);
+                        return arg_type{std::move(b)};
+                    }
+                    storage2d_type A{args[0].matrix_copy()};
                     b = blaze::iterative::solve(A, b, tag);
                     return arg_type{std::move(b)};
                 }},
@@ -319,7 +335,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
+                    storage2d_type A{args[0].matrix_copy()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::PreconditionBiCGSTABTag tag;
                     b = blaze::iterative::solve(A, b, tag, "LU");
@@ -330,7 +346,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
+                    storage2d_type A{args[0].matrix_copy()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::PreconditionBiCGSTABTag tag;
                     b = blaze::iterative::solve(A, b, tag, "RQ");
@@ -341,7 +357,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
+                    storage2d_type A{args[0].matrix_copy()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::PreconditionBiCGSTABTag tag;
                     b = blaze::iterative::solve(A, b, tag, "QR");
@@ -352,7 +368,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
+                    storage2d_type A{args[0].matrix_copy()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::PreconditionBiCGSTABTag tag;
                     b = blaze::iterative::solve(A, b, tag, "Cholesky");
@@ -363,7 +379,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
+                    storage2d_type A{args[0].matrix_copy()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::PreconditionCGTag tag;
                     b = blaze::iterative::solve(A, b, tag, "Jacobi");
@@ -374,7 +390,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
+                    storage2d_type A{args[0].matrix_copy()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::PreconditionCGTag tag;
                     b = blaze::iterative::solve(A, b, tag, "SSOR");
@@ -385,7 +401,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
+                    storage2d_type A{args[0].matrix_copy()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::PreconditionCGTag tag;
                     b = blaze::iterative::solve(
@@ -398,7 +414,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 // Note: Relies on BlazeIterative library and
                 // need to be explicitly enabled
                 [](args_type&& args) -> arg_type {
-                    storage2d_type A{args[0].matrix()};
+                    storage2d_type A{args[0].matrix_copy()};
                     storage1d_type b{args[1].vector()};
                     blaze::iterative::PreconditionCGTag tag;
                     b = blaze::iterative::solve(
@@ -428,7 +444,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 "the linear_solver primitive requires for "
                                 "the third argument to be either 'L' or 'U'"));
                     }
-                    storage2d_type A{blaze::trans(arg_0.matrix())};
+                    storage2d_type A{blaze::trans(arg_0.matrix_copy())};
                     storage1d_type b{arg_1.vector()};
                     const std::unique_ptr<int[]> ipiv(new int[b.size()]);
                     blaze::sysv(A, b, ul == "L" ? 'L' : 'U', ipiv.get());
@@ -449,7 +465,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 "the linear_solver primitive requires for "
                                 "the third argument to be either 'L' or 'U'"));
                     }
-                    storage2d_type A{blaze::trans(arg_0.matrix())};
+                    storage2d_type A{blaze::trans(arg_0.matrix_copy())};
                     storage1d_type b{arg_1.vector()};
                     blaze::posv(A, b, ul == "L" ? 'L' : 'U');
                     return arg_type{std::move(b)};
@@ -463,7 +479,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     primitive_argument_type&& arg_2) -> arg_type {
                     std::int64_t n =
                         extract_scalar_integer_value_strict(std::move(arg_2));
-                    storage2d_type A{arg_0.matrix()};
+                    storage2d_type A{arg_0.matrix_copy()};
                     storage1d_type b{arg_1.vector()};
                     storage1d_type x;
                     blaze::iterative::LanczosTag tag;
@@ -478,7 +494,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     primitive_argument_type&& arg_2) -> arg_type {
                     std::int64_t n =
                         extract_scalar_integer_value_strict(std::move(arg_2));
-                    storage2d_type A{arg_0.matrix()};
+                    storage2d_type A{arg_0.matrix_copy()};
                     storage1d_type b{arg_1.vector()};
                     storage1d_type x;
                     blaze::iterative::ArnoldiTag tag;
@@ -493,7 +509,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     primitive_argument_type&& arg_2) -> arg_type {
                     std::int64_t n =
                         extract_scalar_integer_value_strict(std::move(arg_2));
-                    storage2d_type A{arg_0.matrix()};
+                    storage2d_type A{arg_0.matrix_copy()};
                     storage1d_type b{arg_1.vector()};
                     storage1d_type x;
                     blaze::iterative::GMRESTag tag;
@@ -0,0 +1,166 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/adaptive_execution.hpp>
+
+#include <hpx/include/apply.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        std::int64_t get_int_config(char const* key, char const* default_value)
+        {
+            return std::stoll(hpx::get_config_entry(key, default_value));
+        }
+
+        double get_double_config(char const* key, char const* default_value)
+        {
+            return std::stod(hpx::get_config_entry(key, default_value));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The task overhead is measured as the average time it takes for a
+        // freshly spawned HPX thread to start running. This includes the
+        // thread creation and the scheduling latency under the current load.
+        constexpr std::size_t num_calibration_tasks = 16;
+
+        std::atomic<std::int64_t> task_overhead(5000);
+        std::atomic<std::uint64_t> calibrated_at(0);
+        std::atomic<bool> calibrating(false);
+
+        struct calibration_data
+        {
+            std::atomic<std::int64_t> elapsed_{0};
+            std::atomic<std::size_t> remaining_{num_calibration_tasks};
+        };
+
+        void calibrate_task_overhead()
+        {
+            auto data = std::make_shared<calibration_data>();
+            for (std::size_t i = 0; i != num_calibration_tasks; ++i)
+            {
+                std::uint64_t const spawned =
+                    hpx::chrono::high_resolution_clock::now();
+
+                hpx::apply([data, spawned]() {
+                    std::uint64_t const now =
+                        hpx::chrono::high_resolution_clock::now();
+                    data->elapsed_ += static_cast<std::int64_t>(now - spawned);
+
+                    if (--data->remaining_ == 0)
+                    {
+                        task_overhead = data->elapsed_ /
+                            std::int64_t(num_calibration_tasks);
+                        calibrated_at =
+                            hpx::chrono::high_resolution_clock::now();
+                        calibrating = false;
+                    }
+                });
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool adaptive_execution::enabled()
+    {
+        static bool enabled =
+            hpx::get_config_entry("phylanx.adaptive_execution", "0") == "1";
+        return enabled;
+    }
+
+    std::int64_t adaptive_execution::task_overhead()
+    {
+        static std::uint64_t const recalibration_interval = 1000000ull *
+            detail::get_int_config(
+                "phylanx.adaptive_recalibration_interval", "1000");
+
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+        if (now - detail::calibrated_at > recalibration_interval &&
+            !detail::calibrating.exchange(true))
+        {
+            detail::calibrate_task_overhead();
+        }
+
+        return detail::task_overhead;
+    }
+
+    bool adaptive_execution::sample()
+    {
+        static std::int64_t const sampling_interval = detail::get_int_config(
+            "phylanx.adaptive_sampling_interval", "16");
+
+        return active_ && (++calls_ % sampling_interval) == 0;
+    }
+
+    std::int64_t adaptive_execution::update(std::int64_t eval_count,
+        std::int64_t eval_duration, std::int64_t min_samples,
+        std::int64_t execute_directly)
+    {
+        static double const smoothing =
+            detail::get_double_config("phylanx.adaptive_smoothing", "0.25");
+        static double const lower_factor =
+            detail::get_double_config("phylanx.adaptive_lower_factor", "70");
+        static double const upper_factor =
+            detail::get_double_config("phylanx.adaptive_upper_factor", "100");
+
+        if (!active_)
+        {
+            return execute_directly;
+        }
+
+        // the counters may have been reset in the meantime
+        if (eval_count < last_count_ || eval_duration < last_duration_)
+        {
+            last_count_ = eval_count;
+            last_duration_ = eval_duration;
+            return execute_directly;
+        }
+
+        std::int64_t const count = eval_count - last_count_;
+        if (count == 0)
+        {
+            return execute_directly;
+        }
+
+        double const duration =
+            double(eval_duration - last_duration_) / double(count);
+
+        last_count_ = eval_count;
+        last_duration_ = eval_duration;
+
+        average_ = (samples_ == 0) ?
+            duration :
+            smoothing * duration + (1.0 - smoothing) * average_;
+        samples_ += count;
+
+        if (samples_ < min_samples)
+        {
+            return execute_directly;
+        }
+
+        // decide with some hysteresis
+        double const overhead = double(task_overhead());
+        if (average_ > upper_factor * overhead)
+        {
+            return 0;
+        }
+        if (average_ < lower_factor * overhead)
+        {
+            return 1;
+        }
+        return execute_directly;
+    }
+}}
@@ -0,0 +1,279 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/buffer_pool.hpp>
+
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#include <blaze_tensor/Math.h>
+
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // size classes are the powers of two of the container capacities
+        constexpr std::size_t num_size_classes = 64;
+
+        inline std::size_t size_class(std::size_t n)
+        {
+            std::size_t k = 0;
+            while (n >>= 1)
+            {
+                ++k;
+            }
+            return k;
+        }
+
+        template <typename Container>
+        std::size_t container_bytes(Container const& c)
+        {
+            return c.capacity() * sizeof(typename Container::ElementType);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::atomic<std::size_t>& max_bytes()
+        {
+            static std::atomic<std::size_t> max_bytes(std::stoull(
+                hpx::get_config_entry("phylanx.buffer_pool_size", "67108864")));
+            return max_bytes;
+        }
+
+        // number of bytes pooled by the calling thread for all container types
+        std::size_t& pooled_bytes()
+        {
+            static thread_local std::size_t bytes = 0;
+            return bytes;
+        }
+
+        template <typename Container>
+        struct buffer_pool_data
+        {
+            std::array<std::vector<Container>, num_size_classes> buckets_;
+            buffer_pool_statistics statistics_ = {0, 0, 0, 0};
+        };
+
+        // The pool is accessed through a (trivially destructible) thread
+        // local pointer. This allows for containers destroyed during thread
+        // exit (after the pool itself was destroyed) to simply skip pooling.
+        template <typename Container>
+        buffer_pool_data<Container>* get_buffer_pool()
+        {
+            static thread_local buffer_pool_data<Container>* pool = nullptr;
+            static thread_local bool destroyed = false;
+
+            struct pool_deleter
+            {
+                ~pool_deleter()
+                {
+                    pooled_bytes() -= std::size_t(pool->statistics_.bytes_);
+                    delete pool;
+                    pool = nullptr;
+                    destroyed = true;
+                }
+            };
+
+            if (pool == nullptr && !destroyed)
+            {
+                static thread_local pool_deleter deleter;
+                pool = new buffer_pool_data<Container>;
+            }
+            return pool;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t buffer_pool_max_bytes()
+    {
+        return detail::max_bytes().load(std::memory_order_relaxed);
+    }
+
+    void set_buffer_pool_max_bytes(std::size_t bytes)
+    {
+        detail::max_bytes().store(bytes, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Container>
+    void buffer_pool<Container>::recycle(Container& c)
+    {
+        std::size_t const capacity = c.capacity();
+        if (capacity < min_capacity)
+        {
+            return;
+        }
+
+        std::size_t const bytes = detail::container_bytes(c);
+        auto* pool = detail::get_buffer_pool<Container>();
+        if (pool == nullptr ||
+            detail::pooled_bytes() + bytes > buffer_pool_max_bytes())
+        {
+            return;
+        }
+
+        auto& bucket = pool->buckets_[detail::size_class(capacity)];
+        if (bucket.size() == max_per_size_class)
+        {
+            return;
+        }
+
+        bucket.reserve(max_per_size_class);
+        bucket.push_back(std::move(c));
+
+        detail::pooled_bytes() += bytes;
+        pool->statistics_.bytes_ += bytes;
+        ++pool->statistics_.pooled_;
+    }
+
+    template <typename Container>
+    Container buffer_pool<Container>::acquire(std::size_t capacity)
+    {
+        if (capacity < min_capacity)
+        {
+            return Container{};
+        }
+
+        auto* pool = detail::get_buffer_pool<Container>();
+        if (pool == nullptr)
+        {
+            return Container{};
+        }
+
+        // all containers in the next larger size class are large enough,
+        // the ones in the size class of the requested capacity might be
+        std::size_t const first = detail::size_class(capacity);
+        for (std::size_t k = first;
+             k != first + 2 && k != detail::num_size_classes; ++k)
+        {
+            auto& bucket = pool->buckets_[k];
+            for (auto it = bucket.rbegin(); it != bucket.rend(); ++it)
+            {
+                if (it->capacity() >= capacity)
+                {
+                    Container result = std::move(*it);
+                    bucket.erase(std::next(it).base());
+
+                    std::size_t const bytes = detail::container_bytes(result);
+                    detail::pooled_bytes() -= bytes;
+                    pool->statistics_.bytes_ -= bytes;
+                    --pool->statistics_.pooled_;
+                    ++pool->statistics_.hits_;
+                    return result;
+                }
+            }
+        }
+
+        ++pool->statistics_.misses_;
+        return Container{};
+    }
+
+    template <typename Container>
+    std::size_t buffer_pool<Container>::trim(std::size_t bytes)
+    {
+        auto* pool = detail::get_buffer_pool<Container>();
+        if (pool == nullptr)
+        {
+            return detail::pooled_bytes();
+        }
+
+        // release the largest containers first
+        for (std::size_t k = detail::num_size_classes;
+             k != 0 && detail::pooled_bytes() > bytes; --k)
+        {
+            auto& bucket = pool->buckets_[k - 1];
+            while (!bucket.empty() && detail::pooled_bytes() > bytes)
+            {
+                std::size_t const released =
+                    detail::container_bytes(bucket.back());
+                bucket.pop_back();
+
+                detail::pooled_bytes() -= released;
+                pool->statistics_.bytes_ -= released;
+                --pool->statistics_.pooled_;
+            }
+        }
+        return detail::pooled_bytes();
+    }
+
+    template <typename Container>
+    buffer_pool_statistics buffer_pool<Container>::statistics(bool reset)
+    {
+        auto* pool = detail::get_buffer_pool<Container>();
+        if (pool == nullptr)
+        {
+            return buffer_pool_statistics{0, 0, 0, 0};
+        }
+
+        buffer_pool_statistics result = pool->statistics_;
+        if (reset)
+        {
+            pool->statistics_.hits_ = 0;
+            pool->statistics_.misses_ = 0;
+        }
+        return result;
+    }
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicVector<double>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicVector<float>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicVector<std::uint8_t>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicVector<std::int64_t>>;
+
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicMatrix<double>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicMatrix<float>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicMatrix<std::uint8_t>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicMatrix<std::int64_t>>;
+
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicTensor<double>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicTensor<float>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicTensor<std::uint8_t>>;
+template class PHYLANX_EXPORT
+    phylanx::util::buffer_pool<blaze::DynamicTensor<std::int64_t>>;
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        template <typename T>
+        std::size_t trim_buffer_pools(std::size_t bytes)
+        {
+            buffer_pool<blaze::DynamicTensor<T>>::trim(bytes);
+            buffer_pool<blaze::DynamicMatrix<T>>::trim(bytes);
+            return buffer_pool<blaze::DynamicVector<T>>::trim(bytes);
+        }
+    }
+
+    std::size_t trim_buffer_pools(std::size_t bytes)
+    {
+        detail::trim_buffer_pools<double>(bytes);
+        detail::trim_buffer_pools<float>(bytes);
+        detail::trim_buffer_pools<std::int64_t>(bytes);
+        return detail::trim_buffer_pools<std::uint8_t>(bytes);
+    }
+}}
@@ -0,0 +1,390 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/execution_trace.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Each thread records its events into its own ring buffer, only the
+        // owning thread ever writes to it. Readers use the head to find the
+        // events that are valid, the tail marks the events that were
+        // discarded by clear_execution_trace.
+        //
+        // Every slot is protected by a sequence number (seqlock) which is
+        // odd while the owner writes the slot and 2 * (n + 1) once it holds
+        // the event number n. Readers accept an event only if the sequence
+        // number matches before and after copying it, this discards events
+        // that were overwritten or are being overwritten concurrently.
+        struct execution_trace_buffer
+        {
+            struct slot
+            {
+                std::atomic<std::uint64_t> seq_{0};
+                execution_trace_event event_;
+            };
+
+            explicit execution_trace_buffer(std::size_t capacity)
+              : slots_(capacity)
+              , head_(0)
+              , tail_(0)
+            {
+            }
+
+            void push(execution_trace_event const& event)
+            {
+                std::uint64_t head = head_.load(std::memory_order_relaxed);
+                slot& s = slots_[head % slots_.size()];
+
+                s.seq_.store(2 * head + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                s.event_ = event;
+                s.seq_.store(2 * head + 2, std::memory_order_release);
+
+                head_.store(head + 1, std::memory_order_release);
+            }
+
+            void collect(std::vector<execution_trace_event>& events) const
+            {
+                std::uint64_t const capacity = slots_.size();
+                std::uint64_t head = head_.load(std::memory_order_acquire);
+                std::uint64_t first = (std::max)(
+                    tail_.load(std::memory_order_relaxed),
+                    head > capacity ? head - capacity : 0);
+
+                for (std::uint64_t i = first; i != head; ++i)
+                {
+                    slot const& s = slots_[i % capacity];
+
+                    std::uint64_t const seq =
+                        s.seq_.load(std::memory_order_acquire);
+                    if (seq != 2 * i + 2)
+                    {
+                        continue;       // overwritten in the meantime
+                    }
+
+                    execution_trace_event event = s.event_;
+                    std::atomic_thread_fence(std::memory_order_acquire);
+
+                    if (s.seq_.load(std::memory_order_relaxed) == seq)
+                    {
+                        events.push_back(event);
+                    }
+                }
+            }
+
+            void clear()
+            {
+                tail_.store(head_.load(std::memory_order_acquire),
+                    std::memory_order_relaxed);
+            }
+
+            std::vector<slot> slots_;
+            std::atomic<std::uint64_t> head_;
+            std::atomic<std::uint64_t> tail_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct execution_trace_names
+        {
+            std::string name_;          // name of the event
+            std::string primitive_;     // full name of the primitive
+            std::string codename_;
+        };
+
+        class execution_trace
+        {
+        public:
+            execution_trace()
+              : enabled_(hpx::get_config_entry(
+                             "phylanx.execution_trace", "0") == "1")
+              , capacity_((std::max)(std::size_t(1),
+                    std::size_t(std::stoull(hpx::get_config_entry(
+                        "phylanx.execution_trace_size", "65536")))))
+            {
+            }
+
+            execution_trace_buffer& get_buffer()
+            {
+                thread_local execution_trace_buffer* buffer = nullptr;
+                if (buffer == nullptr)
+                {
+                    auto b =
+                        std::make_shared<execution_trace_buffer>(capacity_);
+                    buffer = b.get();
+
+                    std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                    buffers_.push_back(std::move(b));
+                }
+                return *buffer;
+            }
+
+            std::uint32_t name(std::string const& name,
+                std::string const& primitive, std::string const& codename)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                auto p = name_ids_.emplace(
+                    primitive + '\0' + codename, std::uint32_t(names_.size()));
+                if (p.second)
+                {
+                    names_.push_back(
+                        execution_trace_names{name, primitive, codename});
+                }
+                return p.first->second;
+            }
+
+            std::vector<execution_trace_event> collect() const
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                std::vector<execution_trace_event> events;
+                for (auto const& buffer : buffers_)
+                {
+                    buffer->collect(events);
+                }
+                return events;
+            }
+
+            void clear()
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                for (auto const& buffer : buffers_)
+                {
+                    buffer->clear();
+                }
+            }
+
+            execution_trace_names get_names(std::uint32_t id) const
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                return names_[id];
+            }
+
+            std::atomic<bool> enabled_;
+
+        private:
+            std::size_t capacity_;
+
+            mutable hpx::lcos::local::spinlock mtx_;
+            std::vector<std::shared_ptr<execution_trace_buffer>> buffers_;
+            std::map<std::string, std::uint32_t> name_ids_;
+            std::vector<execution_trace_names> names_;
+        };
+
+        execution_trace& get_execution_trace()
+        {
+            static execution_trace trace;
+            return trace;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void write_json_string(std::ostream& os, std::string const& str)
+        {
+            os << '"';
+            for (char c : str)
+            {
+                switch (c)
+                {
+                case '"':
+                    os << "\\\"";
+                    break;
+
+                case '\\':
+                    os << "\\\\";
+                    break;
+
+                case '\n':
+                    os << "\\n";
+                    break;
+
+                case '\t':
+                    os << "\\t";
+                    break;
+
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        os << "\\u" << std::hex << std::setw(4)
+                           << std::setfill('0') << int(c) << std::dec
+                           << std::setfill(' ');
+                    }
+                    else
+                    {
+                        os << c;
+                    }
+                    break;
+                }
+            }
+            os << '"';
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_execution_trace(bool enable)
+    {
+        detail::get_execution_trace().enabled_ = enable;
+    }
+
+    bool execution_trace_enabled()
+    {
+        return detail::get_execution_trace().enabled_.load(
+            std::memory_order_relaxed);
+    }
+
+    std::uint32_t execution_trace_name(std::string const& name,
+        std::string const& primitive, std::string const& codename)
+    {
+        return detail::get_execution_trace().name(name, primitive, codename);
+    }
+
+    std::uint32_t execution_trace_worker()
+    {
+        std::size_t worker = hpx::get_worker_thread_num();
+        if (worker == std::size_t(-1))
+        {
+            return execution_trace_no_worker;
+        }
+        return std::uint32_t(worker);
+    }
+
+    void record_execution_trace_event(execution_trace_event const& event)
+    {
+        detail::get_execution_trace().get_buffer().push(event);
+    }
+
+    void clear_execution_trace()
+    {
+        detail::get_execution_trace().clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::string execution_trace_json()
+    {
+        auto& trace = detail::get_execution_trace();
+        std::vector<execution_trace_event> events = trace.collect();
+
+        std::sort(events.begin(), events.end(),
+            [](execution_trace_event const& lhs,
+                execution_trace_event const& rhs) {
+                return lhs.begin_ < rhs.begin_;
+            });
+
+        std::uint32_t const locality = hpx::get_locality_id();
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(3);
+        os << "{\"traceEvents\":[\n";
+        os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << locality
+           << ",\"args\":{\"name\":\"locality#" << locality << "\"}}";
+
+        std::set<std::uint32_t> workers;
+        for (auto const& event : events)
+        {
+            if (workers.insert(event.worker_).second)
+            {
+                os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":"
+                   << locality << ",\"tid\":" << event.worker_
+                   << ",\"args\":{\"name\":\"";
+                if (event.worker_ == execution_trace_no_worker)
+                {
+                    os << "non-hpx-thread";
+                }
+                else
+                {
+                    os << "worker-thread#" << event.worker_;
+                }
+                os << "\"}}";
+            }
+        }
+
+        // Evaluations running concurrently on the same worker thread (one
+        // of them suspended) overlap without being nested. They are emitted
+        // as async events ("b"/"e" pairs) each evaluation having its own id.
+        std::map<std::uint32_t, detail::execution_trace_names> names;
+        std::uint64_t id = std::uint64_t(locality) << 32;
+        for (auto const& event : events)
+        {
+            auto it = names.find(event.name_);
+            if (it == names.end())
+            {
+                it = names.emplace(event.name_, trace.get_names(event.name_))
+                         .first;
+            }
+
+            ++id;
+
+            os << ",\n{\"name\":";
+            detail::write_json_string(os, it->second.name_);
+            os << ",\"cat\":\"primitive\",\"ph\":\"b\",\"id\":" << id
+               << ",\"ts\":" << double(event.begin_) / 1000.0
+               << ",\"pid\":" << locality << ",\"tid\":" << event.worker_
+               << ",\"args\":{\"primitive\":";
+            detail::write_json_string(os, it->second.primitive_);
+            os << ",\"codename\":";
+            detail::write_json_string(os, it->second.codename_);
+
+            if (event.ndim_ >= 0)
+            {
+                os << ",\"shape\":[";
+                for (std::int32_t i = 0; i != event.ndim_; ++i)
+                {
+                    if (i != 0)
+                    {
+                        os << ',';
+                    }
+                    os << event.shape_[i];
+                }
+                os << ']';
+            }
+            os << "}}";
+
+            os << ",\n{\"name\":";
+            detail::write_json_string(os, it->second.name_);
+            os << ",\"cat\":\"primitive\",\"ph\":\"e\",\"id\":" << id
+               << ",\"ts\":" << double(event.end_) / 1000.0
+               << ",\"pid\":" << locality << ",\"tid\":" << event.worker_
+               << "}";
+        }
+
+        os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return os.str();
+    }
+
+    void dump_execution_trace(std::string const& filename)
+    {
+        std::ofstream os(filename);
+        if (!os)
+        {
+            HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                "phylanx::util::dump_execution_trace",
+                "could not open file '" + filename + "' for writing");
+        }
+        os << execution_trace_json();
+    }
+}}
@@ -0,0 +1,104 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/localities_annotation.hpp>
+#include <phylanx/execution_tree/tiling_annotations.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/halo_exchange.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    std::vector<halo_part> halo_parts(
+        execution_tree::localities_information const& localities,
+        std::size_t dim, std::int64_t size,
+        execution_tree::tiling_span const& halo, std::string const& name,
+        std::string const& codename)
+    {
+        std::uint32_t const loc_id = localities.locality_.locality_id_;
+        auto const& local_tile = localities.tiles_[loc_id];
+
+        // the part of the halo inside the array
+        execution_tree::tiling_span needed(
+            (std::max)(halo.start_, std::int64_t(0)),
+            (std::min)(halo.stop_, size));
+
+        // collect the intersections of all other tiles with the halo
+        std::vector<halo_part> candidates;
+        std::uint32_t loc = 0;
+        for (auto const& tile : localities.tiles_)
+        {
+            execution_tree::tiling_span intersection;
+            if (loc == loc_id || !needed.is_valid() ||
+                !intersect(tile.spans_[dim], needed, intersection))
+            {
+                ++loc;
+                continue;
+            }
+
+            for (std::size_t d = 0; d != tile.spans_.size(); ++d)
+            {
+                if (d != dim &&
+                    (tile.spans_[d].start_ != local_tile.spans_[d].start_ ||
+                        tile.spans_[d].stop_ != local_tile.spans_[d].stop_))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::util::halo_parts",
+                        util::generate_error_message(
+                            "the halo exchange requires for the array to be "
+                            "tiled along a single dimension",
+                            name, codename));
+                }
+            }
+
+            candidates.push_back(halo_part{loc, intersection, {}});
+            ++loc;
+        }
+
+        // select the tiles covering the halo, each element is fetched once
+        // even if the tiles overlap
+        std::vector<halo_part> result;
+        std::int64_t current = needed.start_;
+        while (current < needed.stop_)
+        {
+            auto best = candidates.end();
+            for (auto it = candidates.begin(); it != candidates.end(); ++it)
+            {
+                if (it->span_.start_ <= current &&
+                    it->span_.stop_ > current &&
+                    (best == candidates.end() ||
+                        it->span_.stop_ > best->span_.stop_))
+                {
+                    best = it;
+                }
+            }
+
+            if (best == candidates.end())
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::util::halo_parts",
+                    util::generate_error_message(
+                        "the tiles of the array do not cover the requested "
+                        "halo",
+                        name, codename));
+            }
+
+            execution_tree::tiling_span span(current, best->span_.stop_);
+            result.push_back(halo_part{best->loc_, span,
+                localities.project_coords(best->loc_, dim, span)});
+
+            current = span.stop_;
+        }
+        return result;
+    }
+}}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/memory_counters.hpp>
+
+#include <hpx/include/util.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    static std::atomic<std::int64_t> allocated_bytes_;
+    static std::atomic<std::int64_t> copied_bytes_;
+    static std::atomic<std::int64_t> live_bytes_;
+
+    // The counters of the primitive currently being evaluated are associated
+    // with the HPX thread executing the evaluation, this makes sure the
+    // association survives the suspension of the thread.
+    memory_counters* current_memory_counters()
+    {
+        auto id = hpx::threads::get_self_id();
+        if (id == hpx::threads::invalid_thread_id)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<memory_counters*>(
+            hpx::threads::get_thread_data(id));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    scoped_memory_counters::scoped_memory_counters(
+            memory_counters& counters, bool enabled)
+      : id_(enabled ? hpx::threads::get_self_id() :
+                      hpx::threads::invalid_thread_id)
+      , previous_(0)
+    {
+        if (id_ != hpx::threads::invalid_thread_id)
+        {
+            previous_ = hpx::threads::set_thread_data(
+                id_, reinterpret_cast<std::size_t>(&counters));
+        }
+    }
+
+    scoped_memory_counters::~scoped_memory_counters()
+    {
+        if (id_ != hpx::threads::invalid_thread_id)
+        {
+            hpx::threads::set_thread_data(id_, previous_);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    memory_counters* track_allocation(std::int64_t bytes, bool copied)
+    {
+        allocated_bytes_ += bytes;
+        if (copied)
+        {
+            copied_bytes_ += bytes;
+        }
+        live_bytes_ += bytes;
+
+        memory_counters* counters = current_memory_counters();
+        if (counters == nullptr)
+        {
+            return nullptr;
+        }
+
+        counters->allocated_bytes_ += bytes;
+        if (copied)
+        {
+            counters->copied_bytes_ += bytes;
+        }
+
+        // the memory is accounted to the counters until it is released
+        std::int64_t const live = (counters->live_bytes_ += bytes);
+        std::int64_t peak = counters->peak_bytes_.load();
+        while (live > peak &&
+            !counters->peak_bytes_.compare_exchange_weak(peak, live))
+        {
+        }
+
+        intrusive_ptr_add_ref(counters);
+        return counters;
+    }
+
+    void track_deallocation(std::int64_t bytes, memory_counters* counters)
+    {
+        live_bytes_ -= bytes;
+        if (counters != nullptr)
+        {
+            counters->live_bytes_ -= bytes;
+            intrusive_ptr_release(counters);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t allocated_bytes(bool reset)
+    {
+        return hpx::util::get_and_reset_value(allocated_bytes_, reset);
+    }
+
+    std::int64_t copied_bytes(bool reset)
+    {
+        return hpx::util::get_and_reset_value(copied_bytes_, reset);
+    }
+
+    // the number of live bytes is not affected by resetting the counters
+    std::int64_t live_bytes(bool)
+    {
+        return live_bytes_.load(std::memory_order_relaxed);
+    }
+}}
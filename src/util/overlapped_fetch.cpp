@@ -0,0 +1,22 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/overlapped_fetch.hpp>
+
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace phylanx { namespace util
+{
+    std::size_t fetch_window()
+    {
+        static std::size_t const window =
+            std::stoul(hpx::get_config_entry("phylanx.fetch_window", "16"));
+        return window;
+    }
+}}
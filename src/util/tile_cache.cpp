@@ -0,0 +1,253 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/tile_cache.hpp>
+
+#include <hpx/include/util.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        bool operator<(tile_cache_key const& lhs, tile_cache_key const& rhs)
+        {
+            return std::tie(lhs.name_, lhs.type_, lhs.version_,
+                       lhs.locality_, lhs.box_) <
+                std::tie(rhs.name_, rhs.type_, rhs.version_, rhs.locality_,
+                    rhs.box_);
+        }
+
+        // the performance counters are reset independently of the
+        // statistics
+        static std::atomic<std::int64_t> hits_counter(0);
+        static std::atomic<std::int64_t> misses_counter(0);
+
+        struct tile_cache_entry
+        {
+            std::shared_ptr<void const> tile_;
+            std::size_t bytes_;
+        };
+
+        // The cache keeps the least recently used entries at the end of the
+        // list, the map refers to the list elements. For each object only
+        // the tiles of the most recent version seen are kept.
+        class tile_cache
+        {
+            using list_type =
+                std::list<std::pair<tile_cache_key, tile_cache_entry>>;
+            using map_type = std::map<tile_cache_key, list_type::iterator>;
+
+        public:
+            tile_cache()
+              : enabled_(hpx::get_config_entry("phylanx.tile_cache", "0") ==
+                    "1")
+              , max_bytes_(std::stoull(hpx::get_config_entry(
+                    "phylanx.tile_cache_size", "268435456")))
+              , bytes_(0)
+              , hits_(0)
+              , misses_(0)
+            {
+            }
+
+            std::shared_ptr<void const> find(tile_cache_key const& key)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                auto it = map_.end();
+                if (is_current_version(key))
+                {
+                    it = map_.find(key);
+                }
+
+                if (it == map_.end())
+                {
+                    ++misses_;
+                    ++misses_counter;
+                    return {};
+                }
+
+                // move the entry to the front of the list
+                entries_.splice(entries_.begin(), entries_, it->second);
+
+                ++hits_;
+                ++hits_counter;
+                return it->second->second.tile_;
+            }
+
+            void add(tile_cache_key&& key, std::shared_ptr<void const>&& tile,
+                std::size_t bytes)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                if (bytes > max_bytes_ || !is_current_version(key) ||
+                    map_.find(key) != map_.end())
+                {
+                    return;
+                }
+
+                while (bytes_ + bytes > max_bytes_)
+                {
+                    bytes_ -= entries_.back().second.bytes_;
+                    map_.erase(entries_.back().first);
+                    entries_.pop_back();
+                }
+
+                entries_.emplace_front(
+                    std::move(key), tile_cache_entry{std::move(tile), bytes});
+                map_.emplace(entries_.front().first, entries_.begin());
+                bytes_ += bytes;
+            }
+
+            void invalidate(std::string const& name)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                versions_.erase(name);
+                evict(name);
+            }
+
+            void clear()
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+                map_.clear();
+                entries_.clear();
+                versions_.clear();
+                bytes_ = 0;
+            }
+
+            tile_cache_statistics statistics(bool reset)
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+
+                tile_cache_statistics result{hits_, misses_,
+                    std::int64_t(map_.size()), std::int64_t(bytes_)};
+                if (reset)
+                {
+                    hits_ = 0;
+                    misses_ = 0;
+                }
+                return result;
+            }
+
+            std::atomic<bool> enabled_;
+
+        private:
+            // Keys referring to a newer version of an object than seen
+            // before evict all tiles of the object, keys referring to an
+            // older version can't be served.
+            bool is_current_version(tile_cache_key const& key)
+            {
+                auto it = versions_.find(key.name_);
+                if (it == versions_.end())
+                {
+                    versions_.emplace(key.name_, key.version_);
+                    return true;
+                }
+
+                if (key.version_ > it->second)
+                {
+                    it->second = key.version_;
+                    evict(key.name_);
+                }
+                return key.version_ == it->second;
+            }
+
+            void evict(std::string const& name)
+            {
+                for (auto it = entries_.begin(); it != entries_.end(); /**/)
+                {
+                    if (it->first.name_ == name)
+                    {
+                        bytes_ -= it->second.bytes_;
+                        map_.erase(it->first);
+                        it = entries_.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+
+            hpx::lcos::local::spinlock mtx_;
+            list_type entries_;
+            map_type map_;
+            std::map<std::string, std::int64_t> versions_;
+            std::size_t max_bytes_;
+            std::size_t bytes_;
+            std::int64_t hits_;
+            std::int64_t misses_;
+        };
+
+        tile_cache& get_tile_cache()
+        {
+            static tile_cache cache;
+            return cache;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::shared_ptr<void const> find_tile(tile_cache_key const& key)
+        {
+            return get_tile_cache().find(key);
+        }
+
+        void add_tile(tile_cache_key&& key, std::shared_ptr<void const> tile,
+            std::size_t bytes)
+        {
+            get_tile_cache().add(std::move(key), std::move(tile), bytes);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_tile_cache(bool enable)
+    {
+        detail::get_tile_cache().enabled_ = enable;
+    }
+
+    bool tile_cache_enabled()
+    {
+        return detail::get_tile_cache().enabled_;
+    }
+
+    void clear_tile_cache()
+    {
+        detail::get_tile_cache().clear();
+    }
+
+    void invalidate_cached_tiles(std::string const& name)
+    {
+        detail::get_tile_cache().invalidate(name);
+    }
+
+    tile_cache_statistics get_tile_cache_statistics(bool reset)
+    {
+        return detail::get_tile_cache().statistics(reset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t tile_cache_hits(bool reset)
+    {
+        return hpx::util::get_and_reset_value(detail::hits_counter, reset);
+    }
+
+    std::int64_t tile_cache_misses(bool reset)
+    {
+        return hpx::util::get_and_reset_value(detail::misses_counter, reset);
+    }
+}}
@@ -0,0 +1,197 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/transfer_codec.hpp>
+
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    transfer_codec transfer_codec_from_string(std::string const& codec)
+    {
+        if (codec == "none")
+        {
+            return transfer_codec::none;
+        }
+        if (codec == "shuffle")
+        {
+            return transfer_codec::shuffle;
+        }
+        if (codec == "float32")
+        {
+            return transfer_codec::float32;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::util::transfer_codec_from_string",
+            "unknown transfer codec '" + codec +
+                "', expected one of 'none', 'shuffle', or 'float32'");
+    }
+
+    transfer_codec default_transfer_codec()
+    {
+        static transfer_codec const codec = transfer_codec_from_string(
+            hpx::get_config_entry("phylanx.transfer_codec", "none"));
+        return codec;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The shuffled bytes are encoded as a sequence of runs, each starting
+    // with a control byte c:
+    //
+    // - c < 128: c + 1 literal bytes follow,
+    // - c >= 128: the next byte is repeated c - 125 times (3 to 130 times).
+    namespace detail
+    {
+        constexpr std::size_t max_literals = 128;
+        constexpr std::size_t min_repeat = 3;
+        constexpr std::size_t max_repeat = 130;
+
+        void flush_literals(std::vector<char>& encoded,
+            char const* literals, std::size_t count)
+        {
+            if (count != 0)
+            {
+                encoded.push_back(static_cast<char>(count - 1));
+                encoded.insert(encoded.end(), literals, literals + count);
+            }
+        }
+    }
+
+    std::vector<char> shuffle_encode(
+        char const* data, std::size_t count, std::size_t element_size)
+    {
+        std::size_t const size = count * element_size;
+
+        // group the bytes of the same significance of all elements
+        std::vector<char> shuffled(size);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            for (std::size_t b = 0; b != element_size; ++b)
+            {
+                shuffled[b * count + i] = data[i * element_size + b];
+            }
+        }
+
+        std::vector<char> encoded;
+        encoded.reserve(size / 2);
+
+        std::size_t literal_start = 0;
+        std::size_t i = 0;
+        while (i != size)
+        {
+            std::size_t run = 1;
+            while (i + run != size && run != detail::max_repeat &&
+                shuffled[i + run] == shuffled[i])
+            {
+                ++run;
+            }
+
+            if (run >= detail::min_repeat)
+            {
+                detail::flush_literals(
+                    encoded, &shuffled[literal_start], i - literal_start);
+                encoded.push_back(
+                    static_cast<char>(128 + run - detail::min_repeat));
+                encoded.push_back(shuffled[i]);
+                i += run;
+                literal_start = i;
+            }
+            else
+            {
+                ++i;
+                if (i - literal_start == detail::max_literals)
+                {
+                    detail::flush_literals(encoded, &shuffled[literal_start],
+                        detail::max_literals);
+                    literal_start = i;
+                }
+            }
+        }
+        detail::flush_literals(
+            encoded, shuffled.data() + literal_start, size - literal_start);
+
+        return encoded;
+    }
+
+    void shuffle_decode(std::vector<char> const& encoded, char* data,
+        std::size_t count, std::size_t element_size)
+    {
+        std::size_t const size = count * element_size;
+
+        std::vector<char> shuffled;
+        shuffled.reserve(size);
+
+        std::size_t i = 0;
+        while (i != encoded.size())
+        {
+            std::size_t const c = static_cast<unsigned char>(encoded[i++]);
+            if (c < 128)
+            {
+                if (i + c + 1 > encoded.size())
+                {
+                    break;
+                }
+                shuffled.insert(shuffled.end(), &encoded[i],
+                    &encoded[i] + c + 1);
+                i += c + 1;
+            }
+            else
+            {
+                if (i == encoded.size())
+                {
+                    break;
+                }
+                shuffled.insert(shuffled.end(),
+                    c - 128 + detail::min_repeat, encoded[i++]);
+            }
+        }
+
+        if (i != encoded.size() || shuffled.size() != size)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_data,
+                "phylanx::util::shuffle_decode",
+                "the encoded data is corrupt");
+        }
+
+        for (std::size_t j = 0; j != count; ++j)
+        {
+            for (std::size_t b = 0; b != element_size; ++b)
+            {
+                data[j * element_size + b] = shuffled[b * count + j];
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    static std::atomic<std::int64_t> transfer_raw_bytes_;
+    static std::atomic<std::int64_t> transfer_encoded_bytes_;
+
+    void track_transfer(std::int64_t raw_bytes, std::int64_t encoded_bytes)
+    {
+        transfer_raw_bytes_ += raw_bytes;
+        transfer_encoded_bytes_ += encoded_bytes;
+    }
+
+    std::int64_t transfer_raw_bytes(bool reset)
+    {
+        return hpx::util::get_and_reset_value(transfer_raw_bytes_, reset);
+    }
+
+    std::int64_t transfer_encoded_bytes(bool reset)
+    {
+        return hpx::util::get_and_reset_value(transfer_encoded_bytes_, reset);
+    }
+}}
@@ -0,0 +1,160 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_kmeans_d_operation(std::string const& name,
+    std::string const& code, std::string const& expected_str)
+{
+    // the order in which the partial sums are combined may differ
+    HPX_TEST(allclose(
+        phylanx::execution_tree::extract_numeric_value(
+            compile_and_run(name, code)),
+        phylanx::execution_tree::extract_numeric_value(
+            compile_and_run(name, expected_str))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const points_0 = R"(
+    [[ 2.  ,  1.  ], [ 2.5 ,  1.  ], [ 0.  ,  1.  ], [ 2.25,  0.5 ],
+     [ 1.25,  0.  ], [ 1.5 ,  2.75], [ 0.  ,  1.75], [ 3.  ,  1.  ],
+     [ 3.  ,  2.75], [ 2.5 ,  1.5 ], [13.75,  7.25], [14.25,  2.25],
+     [ 9.5 ,  1.  ], [10.75,  5.75], [11.  ,  5.5 ]]
+)";
+
+char const* const points_1 = R"(
+    [[13.  ,  2.25], [ 8.25,  4.25], [14.  ,  2.75], [13.5 ,  1.  ],
+     [12.25,  1.5 ], [ 3.5 ,  9.  ], [ 1.75, 12.75], [ 1.5 , 11.25],
+     [-2.5 , 13.75], [ 1.5 , 13.5 ], [ 2.  , 15.25], [ 1.25, 15.  ],
+     [ 1.5 , 11.25], [ 0.25,  9.  ], [ 5.  , 16.  ]]
+)";
+
+std::string const points = std::string("vstack(list(") + points_0 + ", " +
+    points_1 + "))";
+
+void test_kmeans_d_0()
+{
+    std::string const expected = "kmeans(" + points +
+        ", 3, 5, false, nil, [[10.75, 5.75], [3., 2.75], [0.25, 9.]])";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_kmeans_d_operation("test_kmeans_d_0",
+            std::string("kmeans_d(annotate_d(") + points_0 +
+                R"(, "points_0", list("tile", list("rows", 0, 15),
+                    list("columns", 0, 2))),
+                3, 5, false, nil, [[10.75, 5.75], [3., 2.75], [0.25, 9.]]))",
+            expected);
+    }
+    else
+    {
+        test_kmeans_d_operation("test_kmeans_d_0",
+            std::string("kmeans_d(annotate_d(") + points_1 +
+                R"(, "points_0", list("tile", list("rows", 15, 30),
+                    list("columns", 0, 2))),
+                3, 5, false, nil, [[10.75, 5.75], [3., 2.75], [0.25, 9.]]))",
+            expected);
+    }
+}
+
+void test_kmeans_d_1()
+{
+    // the initial centroids are chosen like the ones of kmeans
+    std::string const expected = "kmeans(" + points + ", 3, 5, false, 7)";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_kmeans_d_operation("test_kmeans_d_1",
+            std::string("kmeans_d(annotate_d(") + points_0 +
+                R"(, "points_1", list("tile", list("rows", 0, 15),
+                    list("columns", 0, 2))), 3, 5, false, 7))",
+            expected);
+    }
+    else
+    {
+        test_kmeans_d_operation("test_kmeans_d_1",
+            std::string("kmeans_d(annotate_d(") + points_1 +
+                R"(, "points_1", list("tile", list("rows", 15, 30),
+                    list("columns", 0, 2))), 3, 5, false, 7))",
+            expected);
+    }
+}
+
+void test_kmeans_d_2()
+{
+    // points with three features, compared with the result of running
+    // kmeans_d on a single locality
+    std::string const expected = R"(
+        kmeans_d([[ 1.,  1.,  0.], [ 2.,  1.,  1.], [ 9.,  8., 10.],
+                  [ 1.,  9.,  9.], [10.,  9.,  9.], [ 0.,  8., 10.],
+                  [ 1.,  0.,  1.]],
+            3, 4, false, nil, [[1., 1., 1.], [9., 9., 9.], [1., 9., 9.]])
+    )";
+
+    if (hpx::get_locality_id() == 0)
+    {
+        test_kmeans_d_operation("test_kmeans_d_2", R"(
+            kmeans_d(
+                annotate_d(
+                    [[ 1.,  1.,  0.], [ 2.,  1.,  1.], [ 9.,  8., 10.]],
+                    "points_2",
+                    list("tile", list("rows", 0, 3), list("columns", 0, 3))),
+                3, 4, false, nil, [[1., 1., 1.], [9., 9., 9.], [1., 9., 9.]])
+        )", expected);
+    }
+    else
+    {
+        test_kmeans_d_operation("test_kmeans_d_2", R"(
+            kmeans_d(
+                annotate_d(
+                    [[ 1.,  9.,  9.], [10.,  9.,  9.], [ 0.,  8., 10.],
+                     [ 1.,  0.,  1.]],
+                    "points_2",
+                    list("tile", list("rows", 3, 7), list("columns", 0, 3))),
+                3, 4, false, nil, [[1., 1., 1.], [9., 9., 9.], [1., 9., 9.]])
+        )", expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_kmeans_d_0();
+    test_kmeans_d_1();
+    test_kmeans_d_2();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(argc, argv, cfg);
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+
+void test_compile_cache_hit()
+{
+    phylanx::execution_tree::clear_compile_cache();
+    phylanx::execution_tree::get_compile_cache_statistics(true);
+
+    std::string const code = "block(define(x, 41.0), x + 1.0)";
+
+    phylanx::execution_tree::compiler::function_list snippets1;
+    auto const& f1 =
+        phylanx::execution_tree::compile("test", code, snippets1);
+
+    phylanx::execution_tree::compiler::function_list snippets2;
+    auto const& f2 =
+        phylanx::execution_tree::compile("test", code, snippets2);
+
+    auto stats = phylanx::execution_tree::get_compile_cache_statistics();
+    HPX_TEST_EQ(stats.hits_, 1);
+    HPX_TEST_EQ(stats.misses_, 1);
+    HPX_TEST_EQ(stats.entries_, 1);
+
+    HPX_TEST_EQ(42.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(f1.run()()));
+    HPX_TEST_EQ(42.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(f2.run()()));
+
+    // the name doesn't participate in the lookup
+    auto const& f3 =
+        phylanx::execution_tree::compile("other", code, snippets2);
+
+    stats = phylanx::execution_tree::get_compile_cache_statistics();
+    HPX_TEST_EQ(stats.hits_, 2);
+    HPX_TEST_EQ(stats.misses_, 1);
+    HPX_TEST_EQ(stats.entries_, 1);
+
+    HPX_TEST_EQ(42.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(f3.run()()));
+
+    // different source code results in a different entry
+    phylanx::execution_tree::compile("test", "41.0 + 1.0", snippets2);
+
+    stats = phylanx::execution_tree::get_compile_cache_statistics();
+    HPX_TEST_EQ(stats.misses_, 2);
+    HPX_TEST_EQ(stats.entries_, 2);
+}
+
+void test_compile_cache_environment()
+{
+    phylanx::execution_tree::clear_compile_cache();
+    phylanx::execution_tree::get_compile_cache_statistics(true);
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    phylanx::execution_tree::eval_context ctx;
+
+    std::string const code = "define(f, a, a * 2.0)";
+    phylanx::execution_tree::compile(code, snippets, env).run(ctx);
+    phylanx::execution_tree::compile(code, snippets, env).run(ctx);
+
+    auto stats = phylanx::execution_tree::get_compile_cache_statistics();
+    HPX_TEST_EQ(stats.hits_, 1);
+    HPX_TEST_EQ(stats.misses_, 1);
+
+    // the function defined by the cached code has to be visible
+    auto r = phylanx::execution_tree::compile("f(21.0)", snippets, env)
+                 .run(ctx);
+    HPX_TEST_EQ(
+        42.0, phylanx::execution_tree::extract_scalar_numeric_value(r()));
+
+    // the parsed code is shared between environments, the definitions are
+    // not
+    phylanx::execution_tree::compiler::environment env_other =
+        phylanx::execution_tree::compiler::default_environment();
+    phylanx::execution_tree::eval_context ctx_other;
+
+    phylanx::execution_tree::compile(
+        "define(f, a, a * 3.0)", snippets, env_other).run(ctx_other);
+    r = phylanx::execution_tree::compile("f(21.0)", snippets, env_other)
+            .run(ctx_other);
+    HPX_TEST_EQ(
+        63.0, phylanx::execution_tree::extract_scalar_numeric_value(r()));
+
+    stats = phylanx::execution_tree::get_compile_cache_statistics();
+    HPX_TEST_EQ(stats.hits_, 2);
+    HPX_TEST_EQ(stats.misses_, 3);
+}
+
+// entry points reused from the cache bind to the current definitions of the
+// variables they refer to and don't share primitive components
+void test_compile_cache_redefinition()
+{
+    phylanx::execution_tree::clear_compile_cache();
+    phylanx::execution_tree::get_compile_cache_statistics(true);
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    phylanx::execution_tree::eval_context ctx;
+
+    phylanx::execution_tree::compile("define(g, a, a + 1.0)", snippets, env)
+        .run(ctx);
+    auto const& f1 = phylanx::execution_tree::compile("g(1.0)", snippets, env);
+    HPX_TEST_EQ(2.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(f1.run(ctx)()));
+
+    phylanx::execution_tree::compile("define(g, a, a + 2.0)", snippets, env)
+        .run(ctx);
+    auto const& f2 = phylanx::execution_tree::compile("g(1.0)", snippets, env);
+    HPX_TEST_EQ(3.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(f2.run(ctx)()));
+
+    auto stats = phylanx::execution_tree::get_compile_cache_statistics();
+    HPX_TEST_EQ(stats.hits_, 1);
+
+    using phylanx::execution_tree::primitive;
+    auto const* p1 = phylanx::util::get_if<primitive>(
+        &f1.functions().back().arg_);
+    auto const* p2 = phylanx::util::get_if<primitive>(
+        &f2.functions().back().arg_);
+    HPX_TEST(p1 != nullptr && p2 != nullptr);
+    if (p1 != nullptr && p2 != nullptr)
+    {
+        HPX_TEST_NEQ(p1->get_id(), p2->get_id());
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    phylanx::execution_tree::enable_compile_cache(true);
+
+    test_compile_cache_hit();
+    test_compile_cache_environment();
+    test_compile_cache_redefinition();
+
+    phylanx::execution_tree::enable_compile_cache(false);
+
+    return hpx::util::report_errors();
+}
@@ -11,6 +11,8 @@
 
 #include <cstdint>
 #include <list>
+#include <map>
+#include <string>
 #include <utility>
 
 #include <blaze/Math.h>
@@ -855,6 +857,101 @@ void test_define_call_block_function_noarg()
         ));
 }
 
+// the pattern index has to find the same first matching pattern as trying
+// all patterns in sequence
+void test_pattern_index(std::string const& code)
+{
+    using placeholder_map_type =
+        std::multimap<std::string, phylanx::ast::expression>;
+
+    auto const& patterns =
+        phylanx::execution_tree::compiler::generate_patterns();
+    auto expr = phylanx::ast::generate_ast(code)[0];
+
+    std::string expected;
+    for (auto const& pattern : patterns)
+    {
+        placeholder_map_type placeholders;
+        if (phylanx::ast::match_ast(expr, pattern.second.pattern_ast_,
+                phylanx::ast::detail::on_placeholder_match{placeholders}))
+        {
+            expected = pattern.second.pattern_;
+            break;
+        }
+    }
+
+    std::string found;
+    for (auto it : patterns.index()->find(expr))
+    {
+        placeholder_map_type placeholders;
+        if (phylanx::ast::match_ast(expr, it->second.pattern_ast_,
+                phylanx::ast::detail::on_placeholder_match{placeholders}))
+        {
+            found = it->second.pattern_;
+            break;
+        }
+    }
+
+    HPX_TEST_EQ(expected, found);
+}
+
+void test_pattern_index()
+{
+    test_pattern_index("1 + 2 * 3");
+    test_pattern_index("-x");
+    test_pattern_index("!x && y");
+    test_pattern_index("x");
+    test_pattern_index("42");
+    test_pattern_index("[1, 2, 3]");
+    test_pattern_index("(a + b)");
+    test_pattern_index("sum(x)");
+    test_pattern_index("sum(x, 0)");
+    test_pattern_index("sum(x, 0, true)");
+    test_pattern_index("block(a, b, c, d)");
+    test_pattern_index("unknown_function(a, b)");
+}
+
+// the index has to be rebuilt whenever the pattern list changes
+void test_pattern_index_update()
+{
+    using phylanx::execution_tree::compiler::expression_pattern_list;
+
+    auto expr = phylanx::ast::generate_ast("sum(x)")[0];
+
+    expression_pattern_list patterns =
+        phylanx::execution_tree::compiler::generate_patterns();
+    auto index = patterns.index();
+
+    // assigning a list of the same size must not keep the old index
+    expression_pattern_list other =
+        phylanx::execution_tree::compiler::generate_patterns();
+    patterns = other;
+    HPX_TEST(patterns.index() != index);
+
+    auto candidates = patterns.index()->find(expr);
+    HPX_TEST(!candidates.empty());
+    for (auto it : candidates)
+    {
+        bool found = false;
+        for (auto pit = patterns.begin(); pit != patterns.end(); ++pit)
+        {
+            if (pit == it)
+            {
+                found = true;
+                break;
+            }
+        }
+        HPX_TEST(found);
+    }
+
+    // removed patterns are not found anymore
+    patterns.erase("sum");
+    for (auto it : patterns.index()->find(expr))
+    {
+        HPX_TEST_NEQ(it->first, std::string("sum"));
+    }
+}
+
 int main(int argc, char* argv[])
 {
     test_builtin_environment();
@@ -898,6 +995,9 @@ int main(int argc, char* argv[])
     test_define_call_block_function_noarg();
     test_define_function_default_arguments();
 
+    test_pattern_index();
+    test_pattern_index_update();
+
     return hpx::util::report_errors();
 }
 
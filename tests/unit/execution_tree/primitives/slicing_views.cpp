@@ -0,0 +1,152 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+phylanx::execution_tree::primitive_argument_type make_slice(
+    std::int64_t start, std::int64_t stop, std::int64_t step = 1)
+{
+    return phylanx::execution_tree::primitive_argument_type{
+        phylanx::ir::range(phylanx::execution_tree::primitive_arguments_type{
+            phylanx::execution_tree::primitive_argument_type{start},
+            phylanx::execution_tree::primitive_argument_type{stop},
+            phylanx::execution_tree::primitive_argument_type{step}})};
+}
+
+blaze::DynamicMatrix<double> make_matrix()
+{
+    blaze::DynamicMatrix<double> m(5, 3);
+    for (std::size_t i = 0; i != m.rows(); ++i)
+    {
+        for (std::size_t j = 0; j != m.columns(); ++j)
+        {
+            m(i, j) = double(i * m.columns() + j);
+        }
+    }
+    return m;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// slicing windows of rows of referenced data does not copy the data
+void test_row_window_ref()
+{
+    using phylanx::execution_tree::primitive_argument_type;
+
+    blaze::DynamicMatrix<double> m = make_matrix();
+    phylanx::ir::node_data<double> data{
+        phylanx::ir::node_data<double>::custom_storage2d_type{
+            m.data(), m.rows(), m.columns(), m.spacing()}};
+    HPX_TEST(data.is_ref());
+
+    auto window = phylanx::execution_tree::slice_extract(
+        data, make_slice(1, 4), primitive_argument_type{});
+    HPX_TEST(window.is_ref());
+    HPX_TEST(window.matrix().data() == m.data() + m.spacing());
+    HPX_TEST(window.matrix() == blaze::submatrix(m, 1, 0, 3, 3));
+
+    window = phylanx::execution_tree::slice_extract(data, make_slice(-2, 5));
+    HPX_TEST(window.is_ref());
+    HPX_TEST(window.matrix() == blaze::submatrix(m, 3, 0, 2, 3));
+
+    auto row = phylanx::execution_tree::slice_extract(
+        data, primitive_argument_type{std::int64_t(-1)});
+    HPX_TEST(row.is_ref());
+    HPX_TEST(row.vector() == blaze::trans(blaze::row(m, 4)));
+
+    // changes to the referenced data are visible through the window
+    window = phylanx::execution_tree::slice_extract(
+        data, make_slice(1, 4), primitive_argument_type{});
+    m(2, 1) = 42.0;
+    HPX_TEST_EQ(window.matrix()(1, 1), 42.0);
+}
+
+// other forms of slicing, or slicing data that is not referenced, copy
+void test_copied_slices()
+{
+    using phylanx::execution_tree::primitive_argument_type;
+
+    blaze::DynamicMatrix<double> m = make_matrix();
+    phylanx::ir::node_data<double> data{
+        phylanx::ir::node_data<double>::custom_storage2d_type{
+            m.data(), m.rows(), m.columns(), m.spacing()}};
+
+    auto columns = phylanx::execution_tree::slice_extract(
+        data, make_slice(1, 4), make_slice(0, 2));
+    HPX_TEST(!columns.is_ref());
+    HPX_TEST(columns.matrix() == blaze::submatrix(m, 1, 0, 3, 2));
+
+    auto strided = phylanx::execution_tree::slice_extract(
+        data, make_slice(0, 5, 2), primitive_argument_type{});
+    HPX_TEST(!strided.is_ref());
+    HPX_TEST_EQ(strided.dimension(0), std::size_t(3));
+
+    phylanx::ir::node_data<double> owned{make_matrix()};
+    auto window = phylanx::execution_tree::slice_extract(
+        owned, make_slice(1, 4), primitive_argument_type{});
+    HPX_TEST(!window.is_ref());
+    HPX_TEST(window.matrix() == blaze::submatrix(m, 1, 0, 3, 3));
+}
+
+// storing a window of a variable into an overlapping window of the same
+// variable must read all source rows before any of them are overwritten
+void test_overlapping_store()
+{
+    std::string const code = R"(block(
+        define(x, [[0.0, 1.0], [2.0, 3.0], [4.0, 5.0], [6.0, 7.0]]),
+        store(slice(x, list(1, 3), nil), slice(x, list(0, 2), nil)),
+        x
+    ))";
+
+    auto result = phylanx::execution_tree::extract_numeric_value(
+        compile_and_run(code));
+
+    blaze::DynamicMatrix<double> expected{
+        {0.0, 1.0}, {0.0, 1.0}, {2.0, 3.0}, {6.0, 7.0}};
+    HPX_TEST_EQ(result, phylanx::ir::node_data<double>(std::move(expected)));
+
+    std::string const code1d = R"(block(
+        define(y, [0.0, 1.0, 2.0, 3.0, 4.0]),
+        store(slice(y, list(1, 5)), slice(y, list(0, 4))),
+        y
+    ))";
+
+    auto result1d = phylanx::execution_tree::extract_numeric_value(
+        compile_and_run(code1d));
+
+    blaze::DynamicVector<double> expected1d{0.0, 0.0, 1.0, 2.0, 3.0};
+    HPX_TEST_EQ(
+        result1d, phylanx::ir::node_data<double>(std::move(expected1d)));
+}
+
+int main(int argc, char* argv[])
+{
+    test_row_window_ref();
+    test_copied_slices();
+    test_overlapping_store();
+
+    return hpx::util::report_errors();
+}
@@ -10,6 +10,8 @@
 
 #include <string>
 
+#include <blaze/Math.h>
+
 void test_define_global_variable()
 {
     phylanx::execution_tree::compiler::function_list snippets;
@@ -155,6 +157,80 @@ void test_local_variable_repeated_call()
         0, phylanx::execution_tree::extract_scalar_integer_value(result()));
 }
 
+// the same variable access has to find the innermost definition even if it
+// previously resolved to a variable defined in an outer frame
+void test_conditionally_hidden_global_variable()
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    phylanx::execution_tree::eval_context ctx;
+
+    std::string code = R"(
+        define(x, 1.0)
+        define(f, n, block(
+            if(n == 1, define(x, 2.0)),
+            x
+        ))
+        f(0) + 10 * f(1) + 100 * f(0)
+    )";
+
+    auto const& def = phylanx::execution_tree::compile(code, snippets, env);
+    auto result = def.run(ctx);
+
+    HPX_TEST_EQ(
+        121.0, phylanx::execution_tree::extract_scalar_numeric_value(result()));
+}
+
+// references to variables handed out by a frame have to stay valid while
+// more variables are being added to the same frame
+void test_variable_references_stay_valid()
+{
+    phylanx::execution_tree::eval_context ctx;
+
+    blaze::DynamicVector<double> v{1.0, 2.0, 3.0};
+    auto& first = ctx.set_var(phylanx::util::hashed_string("x0"),
+        phylanx::execution_tree::primitive_argument_type{v});
+    auto ref = phylanx::execution_tree::extract_ref_value(first);
+
+    for (int i = 1; i != 1000; ++i)
+    {
+        ctx.set_var(phylanx::util::hashed_string("x" + std::to_string(i)),
+            phylanx::execution_tree::primitive_argument_type{double(i)});
+    }
+
+    HPX_TEST(ctx.get_var(phylanx::util::hashed_string("x0")) == &first);
+    HPX_TEST(phylanx::execution_tree::extract_numeric_value(ref) ==
+        phylanx::ir::node_data<double>(v));
+    HPX_TEST_EQ(999.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(
+            *ctx.get_var(phylanx::util::hashed_string("x999"))));
+}
+
+void test_define_many_variables()
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    phylanx::execution_tree::eval_context ctx;
+
+    std::string code = "define(f, n, block(define(x, n)";
+    for (int i = 0; i != 100; ++i)
+    {
+        code += ", define(y" + std::to_string(i) + ", x + " +
+            std::to_string(i) + ")";
+    }
+    code += ", store(x, y99), x))\nf(1.0)";
+
+    auto const& def = phylanx::execution_tree::compile(code, snippets, env);
+    auto result = def.run(ctx);
+
+    HPX_TEST_EQ(
+        100.0, phylanx::execution_tree::extract_scalar_numeric_value(result()));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
@@ -165,9 +241,13 @@ int main(int argc, char* argv[])
 
     test_define_local_global_variable();
     test_define_local_hidden_global_variable();
+    test_conditionally_hidden_global_variable();
 
     test_local_variable_repeated_call();
 
+    test_variable_references_stay_valid();
+    test_define_many_variables();
+
     return hpx::util::report_errors();
 }
 
@@ -28,6 +28,30 @@ void test_serialization(phylanx::ir::node_data<double> const& array_value1)
     HPX_TEST_EQ(array_value1, array_value2);
 }
 
+// iterating over the node_data has to produce the elements in row-major
+// order while skipping the padding Blaze may add at the end of each row
+void test_iterators(phylanx::ir::node_data<double> const& array_value,
+    std::vector<double> const& expected)
+{
+    HPX_TEST_EQ(std::size_t(std::distance(
+        array_value.begin(), array_value.end())), array_value.size());
+
+    std::vector<double> values(array_value.begin(), array_value.end());
+    HPX_TEST(values == expected);
+
+    std::vector<double> copied(array_value.size());
+    array_value.copy_to(copied.begin());
+    HPX_TEST(copied == expected);
+
+    std::vector<double> reversed;
+    for (auto it = array_value.end(); it != array_value.begin(); /**/)
+    {
+        reversed.push_back(*--it);
+    }
+    std::reverse(reversed.begin(), reversed.end());
+    HPX_TEST(reversed == expected);
+}
+
 int main(int argc, char* argv[])
 {
     {
@@ -241,5 +265,41 @@ int main(int argc, char* argv[])
         test_serialization(array_value);
     }
 
+    {
+        // 5 columns are padded by Blaze for vectorizable element types
+        blaze::DynamicMatrix<double> m(3UL, 5UL);
+        blaze::DynamicTensor<double> t(2UL, 3UL, 5UL);
+        std::vector<double> expected_m, expected_t;
+
+        double value = 0.0;
+        for (std::size_t i = 0; i != m.rows(); ++i)
+        {
+            for (std::size_t j = 0; j != m.columns(); ++j)
+            {
+                m(i, j) = value;
+                expected_m.push_back(value);
+                value += 1.0;
+            }
+        }
+        for (std::size_t k = 0; k != t.pages(); ++k)
+        {
+            for (std::size_t i = 0; i != t.rows(); ++i)
+            {
+                for (std::size_t j = 0; j != t.columns(); ++j)
+                {
+                    t(k, i, j) = value;
+                    expected_t.push_back(value);
+                    value += 1.0;
+                }
+            }
+        }
+
+        test_iterators(phylanx::ir::node_data<double>(m), expected_m);
+        test_iterators(phylanx::ir::node_data<double>(t), expected_t);
+        test_iterators(phylanx::ir::node_data<double>(
+            blaze::DynamicVector<double>{1.0, 2.0, 3.0}), {1.0, 2.0, 3.0});
+        test_iterators(phylanx::ir::node_data<double>(42.0), {42.0});
+    }
+
     return hpx::util::report_errors();
 }
@@ -0,0 +1,113 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/memory_counters.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstdint>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t expected_bytes(blaze::DynamicVector<double> const& v)
+{
+    return std::int64_t(v.capacity() * sizeof(double));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_allocation()
+{
+    hpx::intrusive_ptr<phylanx::util::memory_counters> counters(
+        new phylanx::util::memory_counters);
+
+    blaze::DynamicVector<double> v(1000, 1.0);
+    blaze::DynamicVector<double> const w(500, 2.0);
+
+    std::int64_t const moved = expected_bytes(v);
+    std::int64_t const copied =
+        expected_bytes(blaze::DynamicVector<double>(w));
+
+    {
+        phylanx::ir::node_data<double> moved_data;
+        phylanx::ir::node_data<double> copied_data;
+        {
+            phylanx::util::scoped_memory_counters scope(*counters);
+
+            moved_data = phylanx::ir::node_data<double>{std::move(v)};
+            HPX_TEST_EQ(counters->allocated_bytes_.load(), moved);
+            HPX_TEST_EQ(counters->copied_bytes_.load(), 0);
+            HPX_TEST_EQ(counters->live_bytes_.load(), moved);
+
+            copied_data = phylanx::ir::node_data<double>{w};
+        }
+
+        HPX_TEST_EQ(counters->allocated_bytes_.load(), moved + copied);
+        HPX_TEST_EQ(counters->copied_bytes_.load(), copied);
+        HPX_TEST_EQ(counters->live_bytes_.load(), moved + copied);
+
+        // memory released outside of the scope is still accounted for
+        moved_data = phylanx::ir::node_data<double>{};
+        HPX_TEST_EQ(counters->live_bytes_.load(), copied);
+    }
+
+    HPX_TEST_EQ(counters->live_bytes_.load(), 0);
+    HPX_TEST_EQ(counters->peak_bytes_.load(), moved + copied);
+
+    // allocations outside of the scope are not accounted for
+    phylanx::ir::node_data<double> data{w};
+    HPX_TEST_EQ(counters->allocated_bytes_.load(), moved + copied);
+    HPX_TEST_EQ(counters->live_bytes_.load(), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_continuation()
+{
+    hpx::intrusive_ptr<phylanx::util::memory_counters> counters(
+        new phylanx::util::memory_counters);
+
+    blaze::DynamicVector<double> const v(100, 1.0);
+    std::int64_t const expected =
+        expected_bytes(blaze::DynamicVector<double>(v));
+
+    hpx::lcos::local::promise<int> p;
+    hpx::future<int> f;
+    {
+        phylanx::util::scoped_memory_counters scope(*counters);
+        f = phylanx::util::attribute_continuations(p.get_future());
+    }
+
+    // the continuation runs on the thread making the promise ready, it is
+    // still attributed to the counters active when the future was wrapped
+    hpx::future<phylanx::ir::node_data<double>> result = f.then(
+        hpx::launch::sync, [&](hpx::future<int>&& f)
+        {
+            f.get();
+            return phylanx::ir::node_data<double>{v};
+        });
+
+    HPX_TEST_EQ(counters->allocated_bytes_.load(), 0);
+
+    p.set_value(42);
+    auto data = result.get();
+
+    HPX_TEST_EQ(counters->allocated_bytes_.load(), expected);
+    HPX_TEST_EQ(counters->copied_bytes_.load(), expected);
+    HPX_TEST_EQ(counters->live_bytes_.load(), expected);
+}
+
+int main()
+{
+    phylanx::ir::node_data<double>::enable_counts(true);
+
+    test_allocation();
+    test_continuation();
+
+    return hpx::util::report_errors();
+}
@@ -61,17 +61,16 @@ std::map<std::string, std::size_t> expected_counts =
     { "function", 1 },
     { "lambda", 1 },
     { "variable", 6 },
-    { "__add", 2 },
+    { "__add", 1 },
     { "block", 3 },
     { "constant", 4 },
-    { "__div", 1 },
     { "dot", 2 },
     { "shape", 4 },
     { "exp", 1 },
+    { "__fused", 2 },
     { "__lt", 1 },
-    { "__mul", 1 },
     { "parallel_block", 1 },
-    { "__sub", 2 },
+    { "__sub", 1 },
     { "transpose", 1 },
     { "__minus", 1 },
     { "while", 1 },
@@ -189,6 +188,41 @@ int main()
                     values.values_[i] == 1);
             }
         }
+
+        // Memory performance counters
+        {
+            std::string const allocated_pc_name(
+                "/phylanx{locality#0/total}/primitives/" + name +
+                "/memory/allocated");
+            hpx::performance_counters::performance_counter allocated_pc(
+                allocated_pc_name);
+
+            std::string const copied_pc_name(
+                "/phylanx{locality#0/total}/primitives/" + name +
+                "/memory/copied");
+            hpx::performance_counters::performance_counter copied_pc(
+                copied_pc_name);
+
+            auto const info = allocated_pc.get_info(hpx::launch::sync);
+            HPX_TEST_EQ(info.fullname_, allocated_pc_name);
+            HPX_TEST_EQ(
+                info.type_, hpx::performance_counters::counter_raw_values);
+
+            auto const allocated =
+                allocated_pc.get_counter_values_array(hpx::launch::sync, false);
+            auto const copied =
+                copied_pc.get_counter_values_array(hpx::launch::sync, false);
+
+            HPX_TEST_EQ(allocated.values_.size(), entries.size());
+            HPX_TEST_EQ(copied.values_.size(), entries.size());
+
+            // copied memory is always accounted for as allocated memory
+            for (std::size_t i = 0; i != allocated.values_.size(); ++i)
+            {
+                HPX_TEST(allocated.values_[i] >= copied.values_[i]);
+                HPX_TEST(copied.values_[i] >= 0);
+            }
+        }
     }
 
     return hpx::util::report_errors();
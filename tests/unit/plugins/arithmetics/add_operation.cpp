@@ -379,6 +379,37 @@ void test_add_operation_2d_lit()
         phylanx::execution_tree::extract_numeric_value(f.get()));
 }
 
+void test_add_operation_2d_float32()
+{
+    blaze::Rand<blaze::DynamicMatrix<float>> gen{};
+    blaze::DynamicMatrix<float> m1 = gen.generate(101UL, 101UL);
+    blaze::DynamicMatrix<float> m2 = gen.generate(101UL, 101UL);
+
+    phylanx::execution_tree::primitive lhs =
+        phylanx::execution_tree::primitives::create_variable(
+            hpx::find_here(), phylanx::ir::node_data<float>(m1));
+
+    phylanx::execution_tree::primitive rhs =
+        phylanx::execution_tree::primitives::create_variable(
+            hpx::find_here(), phylanx::ir::node_data<float>(m2));
+
+    phylanx::execution_tree::primitive add =
+        phylanx::execution_tree::primitives::create_add_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                std::move(lhs), std::move(rhs)});
+
+    hpx::future<phylanx::execution_tree::primitive_argument_type> f = add.eval();
+    phylanx::execution_tree::primitive_argument_type result = f.get();
+
+    // single precision operands are not widened to double
+    HPX_TEST(phylanx::execution_tree::is_float32_operand_strict(result));
+
+    blaze::DynamicMatrix<float> expected = m1 + m2;
+    HPX_TEST_EQ(phylanx::ir::node_data<float>(std::move(expected)),
+        phylanx::execution_tree::extract_float32_value_strict(result));
+}
+
 void test_add_operation_2d0d()
 {
     blaze::Rand<blaze::DynamicMatrix<double>> gen{};
@@ -517,6 +548,7 @@ int main(int argc, char* argv[])
 
     test_add_operation_2d();
     test_add_operation_2d_lit();
+    test_add_operation_2d_float32();
 
     test_add_operation_2d0d();
     test_add_operation_2d0d_lit();
@@ -0,0 +1,98 @@
+//   Copyright (c) 2020 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_fused_operation(std::string const& code,
+    std::string const& expected_str)
+{
+    HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_fused_program()
+{
+    phylanx::execution_tree::primitive p =
+        phylanx::execution_tree::primitives::create_fused_elementwise(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                phylanx::execution_tree::primitive_argument_type{
+                    std::string("0 1 2 * -")},
+                phylanx::execution_tree::primitive_argument_type{
+                    phylanx::ir::node_data<double>{
+                        blaze::DynamicVector<double>{1.0, 2.0, 3.0}}},
+                phylanx::execution_tree::primitive_argument_type{
+                    phylanx::ir::node_data<double>{2.0}},
+                phylanx::execution_tree::primitive_argument_type{
+                    phylanx::ir::node_data<double>{
+                        blaze::DynamicVector<double>{3.0, 2.0, 1.0}}}
+            });
+
+    phylanx::execution_tree::primitive_argument_type result =
+        p.eval(hpx::launch::sync);
+
+    HPX_TEST_EQ(phylanx::ir::node_data<double>(
+                    blaze::DynamicVector<double>{-5.0, -2.0, 1.0}),
+        phylanx::execution_tree::extract_numeric_value(result));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_fused_program();
+
+    // scalars
+    test_fused_operation("1 + 2 * 3", "7");
+    test_fused_operation("(7 - 1) / 2 / 3", "1");
+    test_fused_operation("1.5 * 2 - 1", "2.0");
+
+    // vectors, matrices, and tensors
+    test_fused_operation(
+        "[1.0, 2.0, 3.0] * 2.0 + [1.0, 1.0, 1.0]", "[3.0, 5.0, 7.0]");
+    test_fused_operation(
+        "[[1, 2], [3, 4]] - [[1, 1], [1, 1]] * 2", "[[-1, 0], [1, 2]]");
+    test_fused_operation(
+        "[[[1, 2]], [[3, 4]]] * 2 + 1", "[[[3, 5]], [[7, 9]]]");
+
+    // more elements than fit into a single block
+    test_fused_operation(
+        "linspace(0, 999, 1000) * 2.0 + 1.0 - linspace(0, 999, 1000)",
+        "linspace(1, 1000, 1000)");
+
+    // variables must not be modified
+    test_fused_operation(R"(block(
+            define(x, [1, 2, 3]),
+            define(y, x * x + x),
+            list(x, y)
+        ))",
+        "list([1, 2, 3], [2, 6, 12])");
+
+    // broadcasting and lists are handled by the non-fused operations
+    test_fused_operation(
+        "[[1, 2], [3, 4]] + [10, 20] * 2", "[[21, 42], [23, 44]]");
+    test_fused_operation("list(1, 2) + list(3) + list(4)", "list(1, 2, 3, 4)");
+
+    return hpx::util::report_errors();
+}
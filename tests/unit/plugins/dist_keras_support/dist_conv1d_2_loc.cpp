@@ -333,6 +333,176 @@ void test_conv1d_d_5()
         )");
     }
 }
+
+// spatial parallelization with valid padding, local kernel. The array is tiled
+// on its rows without overlaps, the boundary rows are fetched from the
+// neighbouring tile
+void test_conv1d_d_6()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_conv1d_d_d_operation(
+            "test_conv1d_d__6", R"(
+                conv1d_d(
+                    annotate_d(
+                        [[[1,2],[3, 4]],
+                         [[7,8],[9,10]]], "arg_6",
+                        list("tile", list("pages", 0, 2), list("rows", 0, 2),
+                            list("columns", 0, 2))
+                    ),
+                    [[[ 2, 3,-3,-2], [ 0, 1,-1, 0]],
+                     [[ 1, 1, 2, 1], [-1, 1, 1, 1]]],
+                    "valid"
+                )
+             )" , R"(
+                annotate_d([[[ 1., 12.,  5.,  5.],
+                             [ 5., 24.,  3.,  5.]],
+                            [[13., 48., -1.,  5.],
+                             [17., 60., -3.,  5.]]],
+                    "arg_6/1", list("tile", list("pages", 0, 2),
+                        list("rows", 0, 2), list("columns", 0, 4))
+                )
+        )");
+    }
+    else
+    {
+        test_conv1d_d_d_operation(
+            "test_conv1d_d__6", R"(
+                conv1d_d(
+                    annotate_d(
+                        [[[5, 6], [7,8]],
+                         [[11,12],[1,2]]], "arg_6",
+                        list("tile", list("pages", 0, 2), list("rows", 2, 4),
+                            list("columns", 0, 2))
+                    ),
+                    [[[ 2, 3,-3,-2], [ 0, 1,-1, 0]],
+                     [[ 1, 1, 2, 1], [-1, 1, 1, 1]]],
+                    "valid"
+                )
+             )" , R"(
+                annotate_d([[[  9.,  36.,   1.,   5.]],
+                            [[ 21.,  48., -41., -19.]]],
+                    "arg_6/1", list("tile", list("pages", 0, 2),
+                        list("rows", 2, 3), list("columns", 0, 4))
+                )
+        )");
+    }
+}
+
+// spatial parallelization with same padding, local kernel. The array is tiled
+// on its rows without overlaps, the boundary rows are fetched from the
+// neighbouring tile
+void test_conv1d_d_7()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_conv1d_d_d_operation(
+            "test_conv1d_d__7", R"(
+                conv1d_d(
+                    annotate_d(
+                        [[[1,2],[3, 4]],
+                         [[7,8],[9,10]]], "arg_7",
+                        list("tile", list("pages", 0, 2), list("rows", 0, 2),
+                            list("columns", 0, 2))
+                    ),
+                    [[[ 2, 3,-3,-2], [ 0, 1,-1, 0]],
+                     [[ 1, 1, 2, 1], [-1, 1, 1, 1]]],
+                    "same"
+                )
+             )" , R"(
+                annotate_d([[[  1.,  12.,   5.,   5.],
+                             [  5.,  24.,   3.,   5.]],
+                            [[ 13.,  48.,  -1.,   5.],
+                             [ 17.,  60.,  -3.,   5.]]],
+                    "arg_7/1", list("tile", list("pages", 0, 2),
+                        list("rows", 0, 2), list("columns", 0, 4))
+                )
+        )");
+    }
+    else
+    {
+        test_conv1d_d_d_operation(
+            "test_conv1d_d__7", R"(
+                conv1d_d(
+                    annotate_d(
+                        [[[5, 6], [7,8]],
+                         [[11,12],[1,2]]], "arg_7",
+                        list("tile", list("pages", 0, 2), list("rows", 2, 4),
+                            list("columns", 0, 2))
+                    ),
+                    [[[ 2, 3,-3,-2], [ 0, 1,-1, 0]],
+                     [[ 1, 1, 2, 1], [-1, 1, 1, 1]]],
+                    "same"
+                )
+             )" , R"(
+                annotate_d([[[  9.,  36.,   1.,   5.],
+                             [ 14.,  29., -29., -14.]],
+                            [[ 21.,  48., -41., -19.],
+                             [  2.,   5.,  -5.,  -2.]]],
+                    "arg_7/1", list("tile", list("pages", 0, 2),
+                        list("rows", 2, 4), list("columns", 0, 4))
+                )
+        )");
+    }
+}
+
+// spatial parallelization with causal padding, local kernel. The array is tiled
+// on its rows without overlaps, the boundary rows are fetched from the
+// neighbouring tile
+void test_conv1d_d_8()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_conv1d_d_d_operation(
+            "test_conv1d_d__8", R"(
+                conv1d_d(
+                    annotate_d(
+                        [[[1,2],[3, 4]],
+                         [[7,8],[9,10]]], "arg_8",
+                        list("tile", list("pages", 0, 2), list("rows", 0, 2),
+                            list("columns", 0, 2))
+                    ),
+                    [[[ 2, 3,-3,-2], [ 0, 1,-1, 0]],
+                     [[ 1, 1, 2, 1], [-1, 1, 1, 1]]],
+                    "causal"
+                )
+             )" , R"(
+                annotate_d([[[ -1.,   3.,   4.,   3.],
+                             [  1.,  12.,   5.,   5.]],
+                            [[ -1.,  15.,  22.,  15.],
+                             [ 13.,  48.,  -1.,   5.]]],
+                    "arg_8/1", list("tile", list("pages", 0, 2),
+                        list("rows", 0, 2), list("columns", 0, 4))
+                )
+        )");
+    }
+    else
+    {
+        test_conv1d_d_d_operation(
+            "test_conv1d_d__8", R"(
+                conv1d_d(
+                    annotate_d(
+                        [[[5, 6], [7,8]],
+                         [[11,12],[1,2]]], "arg_8",
+                        list("tile", list("pages", 0, 2), list("rows", 2, 4),
+                            list("columns", 0, 2))
+                    ),
+                    [[[ 2, 3,-3,-2], [ 0, 1,-1, 0]],
+                     [[ 1, 1, 2, 1], [-1, 1, 1, 1]]],
+                    "causal"
+                )
+             )" , R"(
+                annotate_d([[[  5.,  24.,   3.,   5.],
+                             [  9.,  36.,   1.,   5.]],
+                            [[ 17.,  60.,  -3.,   5.],
+                             [ 21.,  48., -41., -19.]]],
+                    "arg_8/1", list("tile", list("pages", 0, 2),
+                        list("rows", 2, 4), list("columns", 0, 4))
+                )
+        )");
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -343,6 +513,9 @@ int hpx_main(int argc, char* argv[])
     test_conv1d_d_3();
     test_conv1d_d_4();
     test_conv1d_d_5();
+    test_conv1d_d_6();
+    test_conv1d_d_7();
+    test_conv1d_d_8();
 
     hpx::finalize();
     return hpx::util::report_errors();
@@ -6,16 +6,20 @@
 //   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/phylanx.hpp>
+#include <phylanx/util/tile_cache.hpp>
 
 #include <hpx/hpx_init.hpp>
 #include <hpx/iostream.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <blaze/Math.h>
+
 ///////////////////////////////////////////////////////////////////////////////
 phylanx::execution_tree::primitive_argument_type compile_and_run(
     std::string const& name, std::string const& codestr)
@@ -558,6 +562,73 @@ void test_dot_2d2d_5()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Re-annotating an array with the same name but different data must not
+// serve the remote tiles fetched for the previous data from the tile cache
+void test_dot_1d_cached_reannotated()
+{
+    phylanx::util::enable_tile_cache(true);
+
+    std::string code;
+    if (hpx::get_locality_id() == 0)
+    {
+        code = R"(
+            define(f, v, dot_d(
+                annotate_d([1, 2, 3], "test1d_cached_1",
+                    list("tile", list("columns", 0, 3))),
+                annotate_d(v, "test1d_cached_2",
+                    list("tile", list("columns", 3, 6)))
+            ))
+            f
+        )";
+    }
+    else
+    {
+        code = R"(
+            define(f, v, dot_d(
+                annotate_d([4, 5, 6], "test1d_cached_1",
+                    list("tile", list("columns", 3, 6))),
+                annotate_d(v, "test1d_cached_2",
+                    list("tile", list("columns", 0, 3)))
+            ))
+            f
+        )";
+    }
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& compiled = phylanx::execution_tree::compile(
+        "test1d_cached_reannotated", code, snippets, env);
+    auto f = compiled.run();
+
+    hpx::lcos::barrier b("test1d_cached_reannotated", 2,
+        hpx::get_locality_id());
+
+    using phylanx::execution_tree::primitive_argument_type;
+
+    blaze::DynamicVector<std::int64_t> v1 = hpx::get_locality_id() == 0 ?
+        blaze::DynamicVector<std::int64_t>{4, 5, 6} :
+        blaze::DynamicVector<std::int64_t>{1, 2, 3};
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(
+                    f(primitive_argument_type{v1})),
+        std::int64_t(91));
+
+    b.wait();
+
+    blaze::DynamicVector<std::int64_t> v2 = hpx::get_locality_id() == 0 ?
+        blaze::DynamicVector<std::int64_t>{40, 50, 60} :
+        blaze::DynamicVector<std::int64_t>{10, 20, 30};
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(
+                    f(primitive_argument_type{v2})),
+        std::int64_t(910));
+
+    b.wait();
+
+    phylanx::util::enable_tile_cache(false);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -584,6 +655,8 @@ int hpx_main(int argc, char* argv[])
     test_dot_2d2d_4();
     test_dot_2d2d_5();
 
+    test_dot_1d_cached_reannotated();
+
     hpx::finalize();
     return hpx::util::report_errors();
 }
@@ -0,0 +1,219 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_elementwise_d_operation(std::string const& name,
+    std::string const& code, std::string const& expected_str)
+{
+    HPX_TEST_EQ(
+        compile_and_run(name, code), compile_and_run(name, expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_add_1d_aligned()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_elementwise_d_operation("test_add_1d_aligned", R"(
+            __add_d(
+                annotate_d([1, 2, 3], "add_1d_aligned_1",
+                    list("tile", list("columns", 0, 3))),
+                annotate_d([10, 20, 30], "add_1d_aligned_2",
+                    list("tile", list("columns", 0, 3)))
+            )
+        )", "[11, 22, 33]");
+    }
+    else
+    {
+        test_elementwise_d_operation("test_add_1d_aligned", R"(
+            __add_d(
+                annotate_d([4, 5, 6], "add_1d_aligned_1",
+                    list("tile", list("columns", 3, 6))),
+                annotate_d([40, 50, 60], "add_1d_aligned_2",
+                    list("tile", list("columns", 3, 6)))
+            )
+        )", "[44, 55, 66]");
+    }
+}
+
+void test_add_1d_mismatched()
+{
+    // both realignments move the same amount of data, the result is tiled
+    // like the left hand side operand
+    if (hpx::get_locality_id() == 0)
+    {
+        test_elementwise_d_operation("test_add_1d_mismatched", R"(
+            __add_d(
+                annotate_d([1, 2, 3], "add_1d_mismatched_1",
+                    list("tile", list("columns", 0, 3))),
+                annotate_d([10, 20, 30, 40], "add_1d_mismatched_2",
+                    list("tile", list("columns", 0, 4)))
+            )
+        )", "[11, 22, 33]");
+    }
+    else
+    {
+        test_elementwise_d_operation("test_add_1d_mismatched", R"(
+            __add_d(
+                annotate_d([4, 5, 6], "add_1d_mismatched_1",
+                    list("tile", list("columns", 3, 6))),
+                annotate_d([50, 60], "add_1d_mismatched_2",
+                    list("tile", list("columns", 4, 6)))
+            )
+        )", "[44, 55, 66]");
+    }
+}
+
+void test_div_1d_replicated()
+{
+    // the left hand side operand is available on both localities, the
+    // result is tiled like the right hand side operand
+    if (hpx::get_locality_id() == 0)
+    {
+        test_elementwise_d_operation("test_div_1d_replicated", R"(
+            __div_d(
+                annotate_d([2., 4., 6., 8., 10., 12.], "div_1d_replicated_1",
+                    list("tile", list("columns", 0, 6))),
+                annotate_d([1., 2., 3.], "div_1d_replicated_2",
+                    list("tile", list("columns", 0, 3)))
+            )
+        )", "[2., 2., 2.]");
+    }
+    else
+    {
+        test_elementwise_d_operation("test_div_1d_replicated", R"(
+            __div_d(
+                annotate_d([2., 4., 6., 8., 10., 12.], "div_1d_replicated_1",
+                    list("tile", list("columns", 0, 6))),
+                annotate_d([4., 5., 6.], "div_1d_replicated_2",
+                    list("tile", list("columns", 3, 6)))
+            )
+        )", "[2., 2., 2.]");
+    }
+}
+
+void test_sub_1d_scalar()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_elementwise_d_operation("test_sub_1d_scalar", R"(
+            __sub_d(
+                annotate_d([1, 2, 3], "sub_1d_scalar_1",
+                    list("tile", list("rows", 0, 3))),
+                1
+            )
+        )", "[0, 1, 2]");
+    }
+    else
+    {
+        test_elementwise_d_operation("test_sub_1d_scalar", R"(
+            __sub_d(
+                annotate_d([4, 5], "sub_1d_scalar_1",
+                    list("tile", list("rows", 3, 5))),
+                1
+            )
+        )", "[3, 4]");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_mul_2d_mismatched()
+{
+    // the left hand side operand is tiled by rows, the right hand side
+    // operand by columns
+    if (hpx::get_locality_id() == 0)
+    {
+        test_elementwise_d_operation("test_mul_2d_mismatched", R"(
+            __mul_d(
+                annotate_d([[1, 2, 3, 4]], "mul_2d_mismatched_1",
+                    list("tile", list("columns", 0, 4), list("rows", 0, 1))),
+                annotate_d([[1, 2], [5, 6]], "mul_2d_mismatched_2",
+                    list("tile", list("columns", 0, 2), list("rows", 0, 2)))
+            )
+        )", "[[1, 4, 9, 16]]");
+    }
+    else
+    {
+        test_elementwise_d_operation("test_mul_2d_mismatched", R"(
+            __mul_d(
+                annotate_d([[5, 6, 7, 8]], "mul_2d_mismatched_1",
+                    list("tile", list("columns", 0, 4), list("rows", 1, 2))),
+                annotate_d([[3, 4], [7, 8]], "mul_2d_mismatched_2",
+                    list("tile", list("columns", 2, 4), list("rows", 0, 2)))
+            )
+        )", "[[25, 36, 49, 64]]");
+    }
+}
+
+void test_gt_2d_local()
+{
+    // the right hand side operand is not distributed
+    if (hpx::get_locality_id() == 0)
+    {
+        test_elementwise_d_operation("test_gt_2d_local", R"(
+            __gt_d(
+                annotate_d([[1, 5], [7, 2]], "gt_2d_local_1",
+                    list("tile", list("columns", 0, 2), list("rows", 0, 2))),
+                [[2, 2, 2], [6, 6, 6]]
+            )
+        )", "__gt([[1, 5], [7, 2]], [[2, 2], [6, 6]])");
+    }
+    else
+    {
+        test_elementwise_d_operation("test_gt_2d_local", R"(
+            __gt_d(
+                annotate_d([[3], [4]], "gt_2d_local_1",
+                    list("tile", list("columns", 2, 3), list("rows", 0, 2))),
+                [[2, 2, 2], [6, 6, 6]]
+            )
+        )", "__gt([[3], [4]], [[2], [6]])");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_add_1d_aligned();
+    test_add_1d_mismatched();
+    test_div_1d_replicated();
+    test_sub_1d_scalar();
+
+    test_mul_2d_mismatched();
+    test_gt_2d_local();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(argc, argv, cfg);
+}
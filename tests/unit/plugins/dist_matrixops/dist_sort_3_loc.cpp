@@ -0,0 +1,105 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_sort_d_operation(std::string const& name, std::string const& code,
+    std::string const& expected_str)
+{
+    HPX_TEST_EQ(
+        compile_and_run(name, code), compile_and_run(name, expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sort_d_0()
+{
+    // the new partitioning is determined by the splitters (3, 1) and (7, 2)
+    if (hpx::get_locality_id() == 0)
+    {
+        test_sort_d_operation("test_sort_d_0", R"(
+            sort_d(annotate_d([9, 3, 7], "sort_array_0",
+                list("tile", list("columns", 0, 3))))
+        )", "[0, 1, 2]");
+    }
+    else if (hpx::get_locality_id() == 1)
+    {
+        test_sort_d_operation("test_sort_d_0", R"(
+            sort_d(annotate_d([1, 8, 2], "sort_array_0",
+                list("tile", list("columns", 3, 6))))
+        )", "[3, 4, 5, 6]");
+    }
+    else
+    {
+        test_sort_d_operation("test_sort_d_0", R"(
+            sort_d(annotate_d([6, 4, 5, 0], "sort_array_0",
+                list("tile", list("columns", 6, 10))))
+        )", "[7, 8, 9]");
+    }
+}
+
+void test_argsort_d_0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_sort_d_operation("test_argsort_d_0", R"(
+            argsort_d(annotate_d([9., 3., 7.], "argsort_array_0",
+                list("tile", list("columns", 0, 3))))
+        )", "[9, 3, 5]");
+    }
+    else if (hpx::get_locality_id() == 1)
+    {
+        test_sort_d_operation("test_argsort_d_0", R"(
+            argsort_d(annotate_d([1., 8., 2.], "argsort_array_0",
+                list("tile", list("columns", 3, 6))))
+        )", "[1, 7, 8, 6]");
+    }
+    else
+    {
+        test_sort_d_operation("test_argsort_d_0", R"(
+            argsort_d(annotate_d([6., 4., 5., 0.], "argsort_array_0",
+                list("tile", list("columns", 6, 10))))
+        )", "[2, 4, 0]");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_sort_d_0();
+    test_argsort_d_0();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(argc, argv, cfg);
+}
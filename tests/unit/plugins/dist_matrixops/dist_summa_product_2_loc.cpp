@@ -0,0 +1,153 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_summa_product(std::string const& name,
+    std::string const& code, std::string const& expected_str)
+{
+    HPX_TEST_EQ(
+        compile_and_run(name, code), compile_and_run(name, expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_summa_product_row_tiled()
+{
+    // the left hand side operand is tiled by rows, the right hand side
+    // operand along the inner dimension
+    if (hpx::get_locality_id() == 0)
+    {
+        test_summa_product("test_summa_product_row_tiled", R"(
+            summa_product_d(
+                annotate_d([[1, 2, 3, 4]], "summa_row_tiled_1",
+                    list("tile", list("columns", 0, 4), list("rows", 0, 1))),
+                annotate_d([[1, 0, 1], [0, 1, 1]], "summa_row_tiled_2",
+                    list("tile", list("columns", 0, 3), list("rows", 0, 2)))
+            )
+        )", "[[12, 5, 7]]");
+    }
+    else
+    {
+        test_summa_product("test_summa_product_row_tiled", R"(
+            summa_product_d(
+                annotate_d([[5, 6, 7, 8]], "summa_row_tiled_1",
+                    list("tile", list("columns", 0, 4), list("rows", 1, 2))),
+                annotate_d([[1, 1, 0], [2, 0, 1]], "summa_row_tiled_2",
+                    list("tile", list("columns", 0, 3), list("rows", 2, 4)))
+            )
+        )", "[[28, 13, 19]]");
+    }
+}
+
+void test_summa_product_uneven()
+{
+    // the inner dimension is split unevenly and differently for both
+    // operands
+    if (hpx::get_locality_id() == 0)
+    {
+        test_summa_product("test_summa_product_uneven", R"(
+            summa_product_d(
+                annotate_d([[1., 2., 3.]], "summa_uneven_1",
+                    list("tile", list("columns", 0, 3), list("rows", 0, 1))),
+                annotate_d([[1., 2.]], "summa_uneven_2",
+                    list("tile", list("columns", 0, 2), list("rows", 0, 1)))
+            )
+        )", "[[14., 20.]]");
+    }
+    else
+    {
+        test_summa_product("test_summa_product_uneven", R"(
+            summa_product_d(
+                annotate_d([[4., 5., 6.]], "summa_uneven_1",
+                    list("tile", list("columns", 0, 3), list("rows", 1, 2))),
+                annotate_d([[2., 3.], [3., 4.]], "summa_uneven_2",
+                    list("tile", list("columns", 0, 2), list("rows", 1, 3)))
+            )
+        )", "[[32., 47.]]");
+    }
+}
+
+void test_summa_product_uncovered()
+{
+    // a row tiled left hand side times a column tiled right hand side: the
+    // localities would calculate the diagonal blocks of the result only
+    bool caught_exception = false;
+    try
+    {
+        if (hpx::get_locality_id() == 0)
+        {
+            compile_and_run("test_summa_product_uncovered", R"(
+                summa_product_d(
+                    annotate_d([[1, 2]], "summa_uncovered_1",
+                        list("tile", list("columns", 0, 2),
+                            list("rows", 0, 1))),
+                    annotate_d([[1], [2]], "summa_uncovered_2",
+                        list("tile", list("columns", 0, 1),
+                            list("rows", 0, 2)))
+                )
+            )");
+        }
+        else
+        {
+            compile_and_run("test_summa_product_uncovered", R"(
+                summa_product_d(
+                    annotate_d([[3, 4]], "summa_uncovered_1",
+                        list("tile", list("columns", 0, 2),
+                            list("rows", 1, 2))),
+                    annotate_d([[3], [4]], "summa_uncovered_2",
+                        list("tile", list("columns", 1, 2),
+                            list("rows", 0, 2)))
+                )
+            )");
+        }
+    }
+    catch (std::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_summa_product_row_tiled();
+    test_summa_product_uneven();
+    test_summa_product_uncovered();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(argc, argv, cfg);
+}
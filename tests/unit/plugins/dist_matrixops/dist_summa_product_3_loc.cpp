@@ -0,0 +1,92 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_summa_product(std::string const& name,
+    std::string const& code, std::string const& expected_str)
+{
+    HPX_TEST_EQ(
+        compile_and_run(name, code), compile_and_run(name, expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_summa_product_1x3_grid()
+{
+    // the localities form a 1x3 grid, each of them calculates one column of
+    // the result from all panels of the left hand side operand
+    if (hpx::get_locality_id() == 0)
+    {
+        test_summa_product("test_summa_product_1x3_grid", R"(
+            summa_product_d(
+                annotate_d([[1], [4]], "summa_1x3_grid_1",
+                    list("tile", list("columns", 0, 1), list("rows", 0, 2))),
+                annotate_d([[1], [4], [7]], "summa_1x3_grid_2",
+                    list("tile", list("columns", 0, 1), list("rows", 0, 3)))
+            )
+        )", "[[30], [66]]");
+    }
+    else if (hpx::get_locality_id() == 1)
+    {
+        test_summa_product("test_summa_product_1x3_grid", R"(
+            summa_product_d(
+                annotate_d([[2], [5]], "summa_1x3_grid_1",
+                    list("tile", list("columns", 1, 2), list("rows", 0, 2))),
+                annotate_d([[2], [5], [8]], "summa_1x3_grid_2",
+                    list("tile", list("columns", 1, 2), list("rows", 0, 3)))
+            )
+        )", "[[36], [81]]");
+    }
+    else
+    {
+        test_summa_product("test_summa_product_1x3_grid", R"(
+            summa_product_d(
+                annotate_d([[3], [6]], "summa_1x3_grid_1",
+                    list("tile", list("columns", 2, 3), list("rows", 0, 2))),
+                annotate_d([[3], [6], [9]], "summa_1x3_grid_2",
+                    list("tile", list("columns", 2, 3), list("rows", 0, 3)))
+            )
+        )", "[[42], [96]]");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_summa_product_1x3_grid();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(argc, argv, cfg);
+}
@@ -0,0 +1,211 @@
+// Copyright (c) 2020 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& name, std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code =
+        phylanx::execution_tree::compile(name, codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_statistics_d_operation(std::string const& name,
+    std::string const& code, std::string const& expected_str)
+{
+    HPX_TEST_EQ(
+        compile_and_run(name, code), compile_and_run(name, expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sum_2d_all()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_sum_2d_all", R"(
+            sum_d(annotate_d([[1, 2, 3]], "sum_2d_all",
+                list("tile", list("columns", 0, 3), list("rows", 0, 1))))
+        )", "21");
+    }
+    else
+    {
+        test_statistics_d_operation("test_sum_2d_all", R"(
+            sum_d(annotate_d([[4, 5, 6]], "sum_2d_all",
+                list("tile", list("columns", 0, 3), list("rows", 1, 2))))
+        )", "21");
+    }
+}
+
+void test_sum_2d_axis0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_sum_2d_axis0", R"(
+            sum_d(annotate_d([[1, 2, 3]], "sum_2d_axis0",
+                list("tile", list("columns", 0, 3), list("rows", 0, 1))), 0)
+        )", "[5, 7, 9]");
+    }
+    else
+    {
+        test_statistics_d_operation("test_sum_2d_axis0", R"(
+            sum_d(annotate_d([[4, 5, 6]], "sum_2d_axis0",
+                list("tile", list("columns", 0, 3), list("rows", 1, 2))), 0)
+        )", "[5, 7, 9]");
+    }
+}
+
+void test_sum_2d_axis1_keepdims()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_sum_2d_axis1_keepdims", R"(
+            sum_d(annotate_d([[1, 2], [4, 5]], "sum_2d_axis1_keepdims",
+                list("tile", list("columns", 0, 2), list("rows", 0, 2))),
+                1, true)
+        )", "[[6], [15]]");
+    }
+    else
+    {
+        test_statistics_d_operation("test_sum_2d_axis1_keepdims", R"(
+            sum_d(annotate_d([[3], [6]], "sum_2d_axis1_keepdims",
+                list("tile", list("columns", 2, 3), list("rows", 0, 2))),
+                1, true)
+        )", "[[6], [15]]");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_mean_1d()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_mean_1d", R"(
+            mean_d(annotate_d([1., 2., 3.], "mean_1d",
+                list("tile", list("columns", 0, 3))))
+        )", "3.");
+    }
+    else
+    {
+        test_statistics_d_operation("test_mean_1d", R"(
+            mean_d(annotate_d([4., 5.], "mean_1d",
+                list("tile", list("columns", 3, 5))))
+        )", "3.");
+    }
+}
+
+void test_var_1d()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_var_1d", R"(
+            var_d(annotate_d([1., 2., 3.], "var_1d",
+                list("tile", list("columns", 0, 3))))
+        )", "2.");
+    }
+    else
+    {
+        test_statistics_d_operation("test_var_1d", R"(
+            var_d(annotate_d([4., 5.], "var_1d",
+                list("tile", list("columns", 3, 5))))
+        )", "2.");
+    }
+}
+
+void test_var_2d_axis0()
+{
+    // the values of each column are split across both localities
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_var_2d_axis0", R"(
+            var_d(annotate_d([[1., 5., 3.]], "var_2d_axis0",
+                list("tile", list("columns", 0, 3), list("rows", 0, 1))), 0)
+        )", "[9., 2.25, 0.25]");
+    }
+    else
+    {
+        test_statistics_d_operation("test_var_2d_axis0", R"(
+            var_d(annotate_d([[7., 2., 4.]], "var_2d_axis0",
+                list("tile", list("columns", 0, 3), list("rows", 1, 2))), 0)
+        )", "[9., 2.25, 0.25]");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_amax_2d_axis0()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_amax_2d_axis0", R"(
+            amax_d(annotate_d([[1, 5], [7, 2]], "amax_2d_axis0",
+                list("tile", list("columns", 0, 2), list("rows", 0, 2))), 0)
+        )", "[7, 5, 4]");
+    }
+    else
+    {
+        test_statistics_d_operation("test_amax_2d_axis0", R"(
+            amax_d(annotate_d([[3], [4]], "amax_2d_axis0",
+                list("tile", list("columns", 2, 3), list("rows", 0, 2))), 0)
+        )", "[7, 5, 4]");
+    }
+}
+
+void test_any_1d()
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        test_statistics_d_operation("test_any_1d", R"(
+            any_d(annotate_d([0, 0], "any_1d",
+                list("tile", list("columns", 0, 2))))
+        )", "true");
+    }
+    else
+    {
+        test_statistics_d_operation("test_any_1d", R"(
+            any_d(annotate_d([0, 1], "any_1d",
+                list("tile", list("columns", 2, 4))))
+        )", "true");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_sum_2d_all();
+    test_sum_2d_axis0();
+    test_sum_2d_axis1_keepdims();
+
+    test_mean_1d();
+    test_var_1d();
+    test_var_2d_axis0();
+
+    test_amax_2d_axis0();
+    test_any_1d();
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(argc, argv, cfg);
+}
@@ -0,0 +1,210 @@
+//   Copyright (c) 2020 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <exception>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+bool is_sparse(phylanx::execution_tree::primitive_argument_type const& val)
+{
+    return phylanx::execution_tree::is_sparse_operand(val);
+}
+
+// the result is expected to be sparse and to compare equal to the dense
+// expected value
+void test_sparse(std::string const& code, std::string const& expected_str)
+{
+    auto result = compile_and_run(code);
+    HPX_TEST(is_sparse(result));
+    HPX_TEST_EQ(result, compile_and_run(expected_str));
+}
+
+// the result is expected to be dense
+void test_dense(std::string const& code, std::string const& expected_str)
+{
+    auto result = compile_and_run(code);
+    HPX_TEST(!is_sparse(result));
+    HPX_TEST_EQ(result, compile_and_run(expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_conversion()
+{
+    test_sparse("tosparse([[1., 0., 0.], [0., 0., 2.]])",
+        "[[1., 0., 0.], [0., 0., 2.]]");
+    test_sparse("tosparse([[1, 0, 0], [0, 0, 2]])",
+        "[[1, 0, 0], [0, 0, 2]]");
+    test_dense("todense(tosparse([[1., 0., 0.], [0., 0., 2.]]))",
+        "[[1., 0., 0.], [0., 0., 2.]]");
+    test_dense("todense([[1., 0.], [0., 2.]])", "[[1., 0.], [0., 2.]]");
+
+    bool caught_exception = false;
+    try
+    {
+        compile_and_run("tosparse([1., 0., 2.])");
+    }
+    catch (std::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_dot()
+{
+    test_sparse(
+        "dot(tosparse([[1., 0.], [0., 2.]]), tosparse([[0., 3.], [4., 0.]]))",
+        "[[0., 3.], [8., 0.]]");
+    test_dense("dot(tosparse([[1., 0.], [0., 2.]]), [[0., 3.], [4., 0.]])",
+        "[[0., 3.], [8., 0.]]");
+    test_dense("dot([[1., 0.], [0., 2.]], tosparse([[0., 3.], [4., 0.]]))",
+        "[[0., 3.], [8., 0.]]");
+    test_dense("dot(tosparse([[1., 0.], [0., 2.]]), [3., 4.])", "[3., 8.]");
+    test_dense("dot([3., 4.], tosparse([[1., 0.], [0., 2.]]))", "[3., 8.]");
+    test_sparse("dot(tosparse([[1., 0.], [0., 2.]]), 2.)",
+        "[[2., 0.], [0., 4.]]");
+}
+
+void test_elementwise()
+{
+    test_sparse(
+        "tosparse([[1., 0.], [0., 2.]]) + tosparse([[0., 3.], [0., 1.]])",
+        "[[1., 3.], [0., 3.]]");
+    test_sparse(
+        "tosparse([[1., 0.], [0., 2.]]) - tosparse([[0., 3.], [0., 1.]])",
+        "[[1., -3.], [0., 1.]]");
+    test_sparse("tosparse([[1., 0.], [0., 2.]]) * [[5., 3.], [7., 2.]]",
+        "[[5., 0.], [0., 4.]]");
+    test_dense("tosparse([[1., 0.], [0., 2.]]) + [[5., 3.], [7., 2.]]",
+        "[[6., 3.], [7., 4.]]");
+    test_dense("tosparse([[1., 0.], [0., 2.]]) / [[5., 3.], [7., 2.]]",
+        "[[0.2, 0.], [0., 1.]]");
+}
+
+void test_transpose()
+{
+    test_sparse("transpose(tosparse([[1., 0., 0.], [0., 0., 2.]]))",
+        "[[1., 0.], [0., 0.], [0., 2.]]");
+}
+
+void test_reductions()
+{
+    test_dense("sum(tosparse([[1., 0., 0.], [0., 0., 2.]]))", "3.");
+    test_dense("sum(tosparse([[1., 0., 0.], [0., 0., 2.]]), 0)",
+        "[1., 0., 2.]");
+    test_dense("sum(tosparse([[1., 0., 0.], [0., 0., 2.]]), 1)", "[1., 2.]");
+    test_dense("mean(tosparse([[1., 0., 0.], [0., 0., 2.]]))", "0.5");
+    test_dense("mean(tosparse([[1., 0., 2.], [0., 0., 3.]]), 1)", "[1., 1.]");
+    test_dense("amax(tosparse([[-1., 0., 0.], [0., 0., -2.]]))", "0.");
+    test_dense("mean(tosparse([[1., 0., 2.], [0., 0., 3.]]), 0)",
+        "[0.5, 0., 2.5]");
+    test_dense("sum(tosparse([[1., 0., 2.], [0., 0., 3.]]), 0, true)",
+        "[[1., 0., 5.]]");
+}
+
+void test_slicing()
+{
+    test_sparse("slice(tosparse([[1., 0., 0.], [0., 0., 2.]]), list(1, 2), "
+                "list(1, 3))",
+        "[[0., 2.]]");
+    test_sparse("slice(tosparse([[1., 0., 0.], [0., 0., 2.]]), list(0, 2))",
+        "[[1., 0., 0.], [0., 0., 2.]]");
+    test_dense("slice(tosparse([[1., 0., 0.], [0., 0., 2.]]), 1)",
+        "[0., 0., 2.]");
+    test_dense("slice(tosparse([[1., 0., 0.], [0., 0., 2.]]), list(0, 2), "
+               "list(0, 3, 2))",
+        "[[1., 0.], [0., 2.]]");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// scalars and vectors broadcast against sparse matrices operate on a dense
+// copy of the sparse operand
+void test_broadcast()
+{
+    test_dense("tosparse([[1., 0.], [0., 2.]]) + 1.",
+        "[[2., 1.], [1., 3.]]");
+    test_dense("3. - tosparse([[1., 0.], [0., 2.]])",
+        "[[2., 3.], [3., 1.]]");
+    test_dense("tosparse([[1., 0.], [0., 2.]]) * 2.",
+        "[[2., 0.], [0., 4.]]");
+    test_dense("tosparse([[1., 0.], [0., 2.]]) + [10., 20.]",
+        "[[11., 20.], [10., 22.]]");
+    test_dense("[10., 20.] - tosparse([[1., 0.], [0., 2.]])",
+        "[[9., 20.], [10., 18.]]");
+    test_dense("tosparse([[1, 0], [0, 2]]) + 1", "[[2, 1], [1, 3]]");
+}
+
+void test_unary()
+{
+    test_dense("-tosparse([[1., 0.], [0., 2.]])", "[[-1., 0.], [0., -2.]]");
+    test_dense("-tosparse([[1, 0], [0, 2]])", "[[-1, 0], [0, -2]]");
+    test_dense("sqrt(tosparse([[4., 0.], [0., 9.]]))", "[[2., 0.], [0., 3.]]");
+    test_dense("exp(tosparse([[0., 0.], [0., 0.]]))", "[[1., 1.], [1., 1.]]");
+    test_dense("!tosparse([[1., 0.], [0., 2.]])",
+        R"(astype([[0, 1], [1, 0]], "bool"))");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// primitives without dedicated support for compressed data operate on a
+// dense copy
+void test_densified()
+{
+    test_dense("tosparse([[1., 0.], [0., 2.]]) == [[1., 0.], [0., 2.]]",
+        R"(astype([[1, 1], [1, 1]], "bool"))");
+    test_dense("tosparse([[1., 0.], [0., 2.]]) < [[2., 0.], [0., 1.]]",
+        R"(astype([[1, 0], [0, 0]], "bool"))");
+    test_dense("power(tosparse([[1., 0.], [0., 2.]]), 2.)",
+        "[[1., 0.], [0., 4.]]");
+    test_dense("argmax(tosparse([[1., 0., 0.], [0., 0., 2.]]))", "5");
+    test_dense("reshape(tosparse([[1., 0.], [0., 2.]]), make_list(4))",
+        "[1., 0., 0., 2.]");
+}
+
+// compressed data is shared between references and copied before it is
+// modified
+void test_shared()
+{
+    test_sparse("block(define(s, tosparse([[1., 0.], [0., 2.]])), s + s)",
+        "[[2., 0.], [0., 4.]]");
+    test_dense("block(define(s, tosparse([[1., 0.], [0., 2.]])), s == s)",
+        R"(astype([[1, 1], [1, 1]], "bool"))");
+    test_sparse("block(define(s, tosparse([[1., 0.], [0., 2.]])), "
+                "define(t, dot(s, 2.)), s)",
+        "[[1., 0.], [0., 2.]]");
+}
+
+int main(int argc, char* argv[])
+{
+    test_conversion();
+    test_dot();
+    test_elementwise();
+    test_transpose();
+    test_reductions();
+    test_slicing();
+    test_broadcast();
+    test_unary();
+    test_densified();
+    test_shared();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,75 @@
+#  Copyright (c) 2020 Hartmut Kaiser
+#
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Operations on variables in lazy mode are recorded and compiled into a
+# single function once their value is needed
+
+import numpy as np
+from phylanx import PhylanxSession, execution_tree
+
+PhylanxSession.init(1)
+
+state = execution_tree.global_compiler_state()
+state.lazy_variables = True
+
+a_np = np.array([1.0, 2.0, 3.0])
+b_np = np.array([4.0, 5.0, 6.0])
+c_np = np.array([7.0, 8.0, 9.0])
+
+a = execution_tree.variable(a_np)
+b = execution_tree.variable(b_np)
+c = execution_tree.variable(c_np)
+
+d = a * b + c - a
+assert (d.eval() == a_np * b_np + c_np - a_np).all()
+
+# materialized expressions are used as values
+e = -d * 2.0
+assert (e.eval() == -(a_np * b_np + c_np - a_np) * 2.0).all()
+
+f = 2.0 - a * b + 1.0
+assert (f.eval() == 2.0 - a_np * b_np + 1.0).all()
+
+# the same expression is compiled only once
+for i in range(3):
+    g = a * b + c
+    assert (g.eval() == a_np * b_np + c_np).all()
+
+# in-place operations
+h = execution_tree.variable(a_np)
+h += b
+h -= c
+assert (h.eval() == a_np + b_np - c_np).all()
+
+m = execution_tree.variable(a_np)
+m.update_moving_average(b, 0.5)
+assert np.allclose(m.eval(), a_np * 0.5 + b_np * 0.5)
+
+# shared sub-expressions are evaluated once, repeated squaring does not
+# generate exponentially large code
+s_np = np.array([1.0, -1.0, 0.5])
+s = execution_tree.variable(s_np)
+for i in range(40):
+    s = s * s
+expected = s_np
+for i in range(40):
+    expected = expected * expected
+assert (s.eval() == expected).all()
+
+# long chains of operations are materialized in pieces
+t = execution_tree.variable(a_np)
+for i in range(1000):
+    t += b
+assert (t.eval() == a_np + 1000 * b_np).all()
+
+u = execution_tree.variable(a_np)
+for i in range(1000):
+    u = u + 1.0
+assert (u.eval() == a_np + 1000.0).all()
+
+state.lazy_variables = False
+
+k = a * b
+assert (k.eval() == a_np * b_np).all()
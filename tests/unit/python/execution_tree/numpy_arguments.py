@@ -0,0 +1,47 @@
+#  Copyright (c) 2020 Hartmut Kaiser
+#
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# numpy arguments may be referenced instead of being copied, make sure the
+# results don't depend on that
+
+from phylanx import Phylanx
+import numpy as np
+
+
+@Phylanx
+def identity(a):
+    return a
+
+
+@Phylanx
+def add(a, b):
+    return a + b
+
+
+shapes = [(16,), (5,), (4, 16), (3, 5), (2, 3, 16), (2, 3, 5)]
+for shape in shapes:
+    a = np.arange(np.prod(shape), dtype=np.float64).reshape(shape)
+
+    # returned arguments must not refer to the argument's data
+    r = identity(a)
+    assert (r == a).all()
+    a += 1
+    assert (r == a - 1).all()
+
+    assert (add(a, a) == 2 * a).all()
+
+    # non-contiguous arrays are converted
+    assert (add(a.T, a.T) == 2 * a.T).all()
+
+    i = np.arange(np.prod(shape), dtype=np.int64).reshape(shape)
+    assert (add(i, i) == 2 * i).all()
+
+    b = i % 2 == 0
+    assert (identity(b) == b).all()
+
+# the arguments are left unchanged
+v = np.ones(16)
+assert (add(v, v) == 2).all()
+assert (v == 1).all()
@@ -0,0 +1,46 @@
+#  Copyright (c) 2020 Hartmut Kaiser
+#
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+import phylanx
+from phylanx import Phylanx, PhylanxSession
+import numpy as np
+
+PhylanxSession.init(1)
+
+et = phylanx.execution_tree
+cs = et.compiler_state('global', __name__)
+
+et.compile(cs, __name__, "add", """
+define(add, a, b, a + b)
+""")
+
+add = et.prepare(cs, __name__, "add")
+assert add.name == "add"
+
+for i in range(10):
+    assert add(i, 1) == i + 1
+
+assert add(2, b=3) == 5
+assert add(a=4, b=3) == 7
+
+v = np.array([1.0, 2.0, 3.0])
+assert (add(v, v) == 2 * v).all()
+
+try:
+    add(1, c=2)
+    assert False, "expected an exception for an unknown named argument"
+except RuntimeError:
+    pass
+
+
+@Phylanx
+def scale(x, factor):
+    return x * factor
+
+
+for i in range(10):
+    assert (scale(v, i) == v * i).all()
+
+assert (scale(v, factor=2) == v * 2).all()
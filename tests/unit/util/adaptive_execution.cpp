@@ -0,0 +1,75 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/adaptive_execution.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_cheap_evaluations()
+{
+    phylanx::util::adaptive_execution tuner;
+
+    // not enough samples yet
+    HPX_TEST_EQ(tuner.update(2, 20, 5, -1), std::int64_t(-1));
+
+    // 10ns per evaluation is always cheaper than spawning a thread
+    HPX_TEST_EQ(tuner.update(10, 100, 5, -1), std::int64_t(1));
+    HPX_TEST_EQ(tuner.average_duration(), 10.0);
+}
+
+void test_expensive_evaluations()
+{
+    phylanx::util::adaptive_execution tuner;
+
+    // 10s per evaluation justifies running asynchronously
+    std::int64_t const duration = 10000000000ll;
+    HPX_TEST_EQ(tuner.update(10, 10 * duration, 5, -1), std::int64_t(0));
+
+    // the moving average follows changes of the evaluation time
+    std::int64_t count = 10;
+    std::int64_t total = 10 * duration;
+    std::int64_t mode = 0;
+    for (int i = 0; i != 100; ++i)
+    {
+        count += 10;
+        total += 100;
+        mode = tuner.update(count, total, 5, mode);
+    }
+    HPX_TEST_EQ(mode, std::int64_t(1));
+}
+
+void test_inactive()
+{
+    phylanx::util::adaptive_execution tuner(false);
+
+    HPX_TEST(!tuner.sample());
+    HPX_TEST_EQ(tuner.update(10, 100, 5, 1), std::int64_t(1));
+    HPX_TEST_EQ(tuner.update(20, 200, 5, -1), std::int64_t(-1));
+}
+
+void test_counter_reset()
+{
+    phylanx::util::adaptive_execution tuner;
+
+    HPX_TEST_EQ(tuner.update(10, 100, 5, -1), std::int64_t(1));
+
+    // the accumulated values were reset, the decision stays unchanged
+    HPX_TEST_EQ(tuner.update(1, 10000000000ll, 5, 1), std::int64_t(1));
+}
+
+int main(int argc, char* argv[])
+{
+    test_cheap_evaluations();
+    test_expensive_evaluations();
+    test_inactive();
+    test_counter_reset();
+
+    return hpx::util::report_errors();
+}
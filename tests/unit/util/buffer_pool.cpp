@@ -0,0 +1,160 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/buffer_pool.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_recycle_vector()
+{
+    using pool = phylanx::util::buffer_pool<blaze::DynamicVector<double>>;
+    pool::statistics(true);
+
+    double const* data = nullptr;
+    {
+        blaze::DynamicVector<double> v(1000, 1.0);
+        data = v.data();
+
+        phylanx::ir::node_data<double> nd(std::move(v));
+    }
+
+    // the memory is handed out again for a result of the same size
+    blaze::DynamicVector<double> v =
+        phylanx::util::pooled_vector<double>(1000);
+    HPX_TEST_EQ(v.size(), std::size_t(1000));
+    HPX_TEST(v.data() == data);
+
+    auto stats = pool::statistics(true);
+    HPX_TEST_EQ(stats.hits_, 1);
+    HPX_TEST_EQ(stats.misses_, 0);
+
+    // the pool is empty now
+    blaze::DynamicVector<double> v1 =
+        phylanx::util::pooled_vector<double>(1000);
+    HPX_TEST(v1.data() != data);
+
+    stats = pool::statistics(true);
+    HPX_TEST_EQ(stats.hits_, 0);
+    HPX_TEST_EQ(stats.misses_, 1);
+}
+
+void test_recycle_matrix()
+{
+    double const* data = nullptr;
+    {
+        blaze::DynamicMatrix<double> m(40, 41, 1.0);
+        data = m.data();
+
+        phylanx::ir::node_data<double> nd(std::move(m));
+    }
+
+    // a smaller matrix fits into the recycled memory, padding is zeroed
+    blaze::DynamicMatrix<double> m =
+        phylanx::util::pooled_matrix<double>(30, 33);
+    HPX_TEST_EQ(m.rows(), std::size_t(30));
+    HPX_TEST_EQ(m.columns(), std::size_t(33));
+    HPX_TEST(m.data() == data);
+    for (std::size_t i = 0; i != m.rows(); ++i)
+    {
+        for (std::size_t j = m.columns(); j != m.spacing(); ++j)
+        {
+            HPX_TEST_EQ(m.data(i)[j], 0.0);
+        }
+    }
+}
+
+void test_small_containers()
+{
+    using pool = phylanx::util::buffer_pool<blaze::DynamicVector<double>>;
+    pool::statistics(true);
+
+    {
+        phylanx::ir::node_data<double> nd(blaze::DynamicVector<double>(10));
+    }
+
+    HPX_TEST_EQ(pool::statistics(true).pooled_, 0);
+}
+
+void test_move_assignment()
+{
+    using pool = phylanx::util::buffer_pool<blaze::DynamicVector<double>>;
+
+    double const* data = nullptr;
+    {
+        blaze::DynamicVector<double> v(1000, 1.0);
+        data = v.data();
+
+        phylanx::ir::node_data<double> nd(std::move(v));
+        nd = phylanx::ir::node_data<double>(42.0);
+
+        HPX_TEST_EQ(pool::statistics(true).pooled_, 1);
+    }
+
+    // a smaller vector fits into the recycled memory
+    blaze::DynamicVector<double> v = phylanx::util::pooled_vector<double>(500);
+    HPX_TEST(v.data() == data);
+}
+
+void test_limit()
+{
+    using pool = phylanx::util::buffer_pool<blaze::DynamicVector<double>>;
+    using matrix_pool =
+        phylanx::util::buffer_pool<blaze::DynamicMatrix<double>>;
+
+    phylanx::util::trim_buffer_pools();
+    HPX_TEST_EQ(pool::statistics(true).bytes_, 0);
+
+    std::size_t const max_bytes = phylanx::util::buffer_pool_max_bytes();
+
+    // the pooled memory is accounted for in bytes
+    blaze::DynamicVector<double> v(1000, 1.0);
+    std::int64_t const bytes = std::int64_t(v.capacity() * sizeof(double));
+    pool::recycle(v);
+
+    auto stats = pool::statistics(true);
+    HPX_TEST_EQ(stats.pooled_, 1);
+    HPX_TEST_EQ(stats.bytes_, bytes);
+
+    // the limit applies to all container types combined
+    phylanx::util::set_buffer_pool_max_bytes(std::size_t(bytes) + 1000);
+
+    blaze::DynamicMatrix<double> m(40, 40, 1.0);
+    matrix_pool::recycle(m);
+    HPX_TEST_EQ(matrix_pool::statistics(true).pooled_, 0);
+    HPX_TEST_EQ(m.rows(), std::size_t(40));
+
+    blaze::DynamicVector<double> v1(1000, 1.0);
+    pool::recycle(v1);
+    HPX_TEST_EQ(pool::statistics(true).pooled_, 1);
+
+    // trimming releases the pooled memory
+    HPX_TEST_EQ(phylanx::util::trim_buffer_pools(), std::size_t(0));
+
+    stats = pool::statistics(true);
+    HPX_TEST_EQ(stats.pooled_, 0);
+    HPX_TEST_EQ(stats.bytes_, 0);
+
+    phylanx::util::set_buffer_pool_max_bytes(max_bytes);
+}
+
+int main(int argc, char* argv[])
+{
+    test_recycle_vector();
+    test_recycle_matrix();
+    test_small_containers();
+    test_move_assignment();
+    test_limit();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,154 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/execution_trace.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const add_code = R"(block(
+    define(add_vectors, a, b, a + b),
+    add_vectors
+))";
+
+void run_add_vectors()
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = phylanx::execution_tree::compile(
+        phylanx::ast::generate_ast(add_code), snippets);
+
+    auto add_vectors = code.run();
+
+    using phylanx::execution_tree::primitive_argument_type;
+    blaze::DynamicVector<double> v{1.0, 2.0, 3.0};
+
+    auto result = add_vectors(primitive_argument_type{v},
+        primitive_argument_type{v});
+    HPX_TEST(phylanx::execution_tree::extract_numeric_value(result) ==
+        phylanx::ir::node_data<double>(v + v));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_disabled()
+{
+    phylanx::util::enable_execution_trace(false);
+    phylanx::util::clear_execution_trace();
+
+    run_add_vectors();
+
+    std::string trace = phylanx::util::execution_trace_json();
+    HPX_TEST(trace.find("\"traceEvents\"") != std::string::npos);
+    HPX_TEST(trace.find("\"ph\":\"b\"") == std::string::npos);
+}
+
+void test_enabled()
+{
+    phylanx::util::enable_execution_trace(true);
+    phylanx::util::clear_execution_trace();
+
+    run_add_vectors();
+
+    phylanx::util::enable_execution_trace(false);
+
+    std::string trace = phylanx::util::execution_trace_json();
+    HPX_TEST(trace.find("\"name\":\"__add\"") != std::string::npos);
+    HPX_TEST(trace.find("\"shape\":[3]") != std::string::npos);
+    HPX_TEST(trace.find("\"thread_name\"") != std::string::npos);
+
+    // clearing the trace discards all recorded events
+    phylanx::util::clear_execution_trace();
+
+    trace = phylanx::util::execution_trace_json();
+    HPX_TEST(trace.find("\"ph\":\"b\"") == std::string::npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t count_events(std::string const& trace,
+    std::string const& phase = "\"ph\":\"b\"")
+{
+    std::size_t count = 0;
+    for (std::size_t pos = trace.find(phase); pos != std::string::npos;
+         pos = trace.find(phase, pos + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+
+phylanx::util::execution_trace_event make_event(std::uint64_t begin)
+{
+    phylanx::util::execution_trace_event event{begin, begin + 1,
+        phylanx::util::execution_trace_name("event", "event", "<unknown>"),
+        phylanx::util::execution_trace_worker(), -1, {}};
+    return event;
+}
+
+void test_wrap_around()
+{
+    phylanx::util::enable_execution_trace(true);
+    phylanx::util::clear_execution_trace();
+
+    // only the most recent (default: 65536) events of a thread are kept
+    std::size_t const capacity = 65536;
+    for (std::size_t i = 0; i != capacity + 10; ++i)
+    {
+        phylanx::util::record_execution_trace_event(make_event(i));
+    }
+
+    phylanx::util::enable_execution_trace(false);
+
+    std::string trace = phylanx::util::execution_trace_json();
+    HPX_TEST_EQ(count_events(trace), capacity);
+    HPX_TEST(trace.find("\"ts\":0.009,") == std::string::npos);
+    HPX_TEST(trace.find("\"ts\":0.010,") != std::string::npos);
+
+    phylanx::util::clear_execution_trace();
+}
+
+void test_non_hpx_thread()
+{
+    HPX_TEST(phylanx::util::execution_trace_worker() !=
+        phylanx::util::execution_trace_no_worker);
+
+    phylanx::util::enable_execution_trace(true);
+    phylanx::util::clear_execution_trace();
+
+    std::uint32_t worker = 0;
+    std::thread t([&]() {
+        worker = phylanx::util::execution_trace_worker();
+        phylanx::util::record_execution_trace_event(make_event(1));
+    });
+    t.join();
+
+    phylanx::util::enable_execution_trace(false);
+
+    HPX_TEST_EQ(worker, phylanx::util::execution_trace_no_worker);
+
+    std::string trace = phylanx::util::execution_trace_json();
+    HPX_TEST_EQ(count_events(trace), std::size_t(1));
+    HPX_TEST_EQ(count_events(trace, "\"ph\":\"e\""), std::size_t(1));
+    HPX_TEST(trace.find("\"name\":\"non-hpx-thread\"") != std::string::npos);
+
+    phylanx::util::clear_execution_trace();
+}
+
+int main()
+{
+    test_disabled();
+    test_enabled();
+    test_wrap_around();
+    test_non_hpx_thread();
+
+    return hpx::util::report_errors();
+}
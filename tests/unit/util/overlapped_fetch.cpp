@@ -0,0 +1,73 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/overlapped_fetch.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// parts are consumed in the order their data arrives
+void test_arrival_order()
+{
+    std::vector<hpx::lcos::local::promise<std::size_t>> promises(4);
+    std::vector<std::size_t> const arrival = {2, 3, 1, 0};
+
+    std::vector<std::size_t> consumed;
+    bool local_done = false;
+
+    phylanx::util::overlapped_fetch(promises.size(),
+        [&](std::size_t i) { return promises[i].get_future(); },
+        [&]() {
+            local_done = true;
+            promises[arrival[0]].set_value(arrival[0]);
+        },
+        [&](std::size_t i, std::size_t data) {
+            HPX_TEST(local_done);
+            HPX_TEST_EQ(i, data);
+
+            consumed.push_back(i);
+            if (consumed.size() != arrival.size())
+            {
+                std::size_t const next = arrival[consumed.size()];
+                promises[next].set_value(next);
+            }
+        });
+
+    HPX_TEST(consumed == arrival);
+}
+
+// every part is consumed exactly once
+void test_all_parts()
+{
+    std::size_t const count = 100;
+    std::vector<std::size_t> consumed(count, 0);
+
+    phylanx::util::overlapped_fetch(count,
+        [&](std::size_t i) { return hpx::make_ready_future(i); },
+        [&]() {},
+        [&](std::size_t i, std::size_t data) {
+            HPX_TEST_EQ(i, data);
+            ++consumed[i];
+        });
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(consumed[i], std::size_t(1));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    test_arrival_order();
+    test_all_parts();
+
+    return hpx::util::report_errors();
+}
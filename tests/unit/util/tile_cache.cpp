@@ -0,0 +1,101 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/tile_cache.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t fetches = 0;
+
+blaze::DynamicVector<double> cached_fetch(std::string const& name,
+    std::int64_t version, std::size_t start, std::size_t stop)
+{
+    return phylanx::util::cached_fetch<blaze::DynamicVector<double>>(name,
+        version, 1, {start, stop, 0, 1, 0, 1}, [&]() {
+            ++fetches;
+            return hpx::make_ready_future(blaze::DynamicVector<double>(
+                stop - start, double(version)));
+        }).get();
+}
+
+void test_tile_cache()
+{
+    phylanx::util::clear_tile_cache();
+    phylanx::util::get_tile_cache_statistics(true);
+
+    // objects without a version are never cached
+    cached_fetch("v", -1, 0, 4);
+    cached_fetch("v", -1, 0, 4);
+    HPX_TEST_EQ(fetches, std::size_t(2));
+
+    cached_fetch("v", 0, 0, 4);
+    cached_fetch("v", 0, 0, 4);
+    cached_fetch("v", 0, 2, 4);
+    HPX_TEST_EQ(fetches, std::size_t(4));
+
+    auto stats = phylanx::util::get_tile_cache_statistics(true);
+    HPX_TEST_EQ(stats.hits_, std::int64_t(1));
+    HPX_TEST_EQ(stats.misses_, std::int64_t(2));
+    HPX_TEST_EQ(stats.entries_, std::int64_t(2));
+    HPX_TEST_EQ(stats.bytes_, std::int64_t(6 * sizeof(double)));
+
+    // a new version evicts all tiles of the older version
+    HPX_TEST(cached_fetch("v", 1, 0, 4)[0] == 1.0);
+    HPX_TEST(cached_fetch("v", 1, 0, 4)[0] == 1.0);
+    HPX_TEST_EQ(fetches, std::size_t(5));
+
+    stats = phylanx::util::get_tile_cache_statistics(true);
+    HPX_TEST_EQ(stats.hits_, std::int64_t(1));
+    HPX_TEST_EQ(stats.entries_, std::int64_t(1));
+
+    // older versions are not served from the cache
+    HPX_TEST(cached_fetch("v", 0, 0, 4)[0] == 0.0);
+    HPX_TEST_EQ(fetches, std::size_t(6));
+
+    // storing to an object invalidates its tiles only
+    cached_fetch("w", 0, 0, 4);
+    phylanx::util::invalidate_cached_tiles("v");
+    cached_fetch("v", 1, 0, 4);
+    cached_fetch("w", 0, 0, 4);
+    HPX_TEST_EQ(fetches, std::size_t(8));
+
+    phylanx::util::clear_tile_cache();
+    stats = phylanx::util::get_tile_cache_statistics(true);
+    HPX_TEST_EQ(stats.entries_, std::int64_t(0));
+    HPX_TEST_EQ(stats.bytes_, std::int64_t(0));
+}
+
+void test_disabled()
+{
+    phylanx::util::enable_tile_cache(false);
+
+    std::size_t const count = fetches;
+    cached_fetch("v", 2, 0, 4);
+    cached_fetch("v", 2, 0, 4);
+    HPX_TEST_EQ(fetches, count + 2);
+
+    phylanx::util::enable_tile_cache(true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    phylanx::util::enable_tile_cache(true);
+
+    test_tile_cache();
+    test_disabled();
+
+    return hpx::util::report_errors();
+}
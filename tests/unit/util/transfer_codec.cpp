@@ -0,0 +1,110 @@
+//  Copyright (c) 2020 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/transfer_codec.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> round_trip(
+    std::vector<T> const& data, phylanx::util::transfer_codec codec)
+{
+    phylanx::util::transfer_block block =
+        phylanx::util::encode_block(data.data(), data.size(), codec);
+
+    std::vector<T> result(data.size());
+    phylanx::util::decode_block(block, result.data(), result.size());
+    return result;
+}
+
+void test_shuffle()
+{
+    using phylanx::util::transfer_codec;
+
+    std::vector<double> doubles(1000);
+    for (std::size_t i = 0; i != doubles.size(); ++i)
+    {
+        doubles[i] = double(i % 7) * 0.5;
+    }
+    HPX_TEST(round_trip(doubles, transfer_codec::shuffle) == doubles);
+
+    std::vector<std::int64_t> integers(1000);
+    for (std::size_t i = 0; i != integers.size(); ++i)
+    {
+        integers[i] = std::int64_t(i * 7919) - 4000000;
+    }
+    HPX_TEST(round_trip(integers, transfer_codec::shuffle) == integers);
+
+    // the float32 codec narrows double precision data only
+    HPX_TEST(round_trip(integers, transfer_codec::float32) == integers);
+
+    std::vector<std::uint8_t> bytes(1000, 1);
+    HPX_TEST(round_trip(bytes, transfer_codec::shuffle) == bytes);
+
+    std::vector<double> empty;
+    HPX_TEST(round_trip(empty, transfer_codec::shuffle) == empty);
+}
+
+void test_float32()
+{
+    using phylanx::util::transfer_codec;
+
+    std::vector<double> doubles(1000);
+    for (std::size_t i = 0; i != doubles.size(); ++i)
+    {
+        doubles[i] = 1.0 / double(i + 1);
+    }
+
+    std::vector<double> result = round_trip(doubles, transfer_codec::float32);
+    for (std::size_t i = 0; i != doubles.size(); ++i)
+    {
+        HPX_TEST_EQ(result[i], double(float(doubles[i])));
+    }
+}
+
+void test_counters()
+{
+    using phylanx::util::transfer_codec;
+
+    phylanx::util::transfer_raw_bytes(true);
+    phylanx::util::transfer_encoded_bytes(true);
+
+    // highly compressible data
+    std::vector<double> zeros(1000, 0.0);
+    round_trip(zeros, transfer_codec::shuffle);
+
+    HPX_TEST_EQ(phylanx::util::transfer_raw_bytes(true),
+        std::int64_t(zeros.size() * sizeof(double)));
+    HPX_TEST(phylanx::util::transfer_encoded_bytes(true) <
+        std::int64_t(zeros.size() * sizeof(double)) / 10);
+
+    // incompressible data is sent as is
+    std::vector<std::uint8_t> bytes(256);
+    for (std::size_t i = 0; i != bytes.size(); ++i)
+    {
+        bytes[i] = std::uint8_t(i);
+    }
+    HPX_TEST(round_trip(bytes, transfer_codec::shuffle) == bytes);
+
+    HPX_TEST_EQ(phylanx::util::transfer_raw_bytes(true), std::int64_t(256));
+    HPX_TEST_EQ(phylanx::util::transfer_encoded_bytes(true), std::int64_t(256));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_shuffle();
+    test_float32();
+    test_counters();
+
+    return hpx::util::report_errors();
+}